@@ -146,8 +146,14 @@ int App::run(int argc, char** argv)
     // Setup modules: onPreInit
     // ====================================================
     globalModule.onPreInit(runMode);
+
+    //! NOTE The profiler is set up in the global module's onPreInit,
+    //! so the startup milestones can only begin from this point
+    BEGIN_STEP_TIME("Startup");
+
     for (mu::modularity::IModuleSetup* m : m_modules) {
         m->onPreInit(runMode);
+        STEP_TIME("Startup", std::string("onPreInit: ") + m->moduleName());
     }
 
 #ifdef MUE_BUILD_APPSHELL_MODULE
@@ -164,6 +170,7 @@ int App::run(int argc, char** argv)
     globalModule.onInit(runMode);
     for (mu::modularity::IModuleSetup* m : m_modules) {
         m->onInit(runMode);
+        STEP_TIME("Startup", std::string("onInit: ") + m->moduleName());
     }
 
     // ====================================================
@@ -174,6 +181,8 @@ int App::run(int argc, char** argv)
         m->onAllInited(runMode);
     }
 
+    STEP_TIME("Startup", "modules inited");
+
     // ====================================================
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
@@ -255,6 +264,8 @@ int App::run(int argc, char** argv)
                 }
 
                 if (url == objUrl) {
+                    STEP_TIME("Startup", "main qml loaded");
+
                     // ====================================================
                     // Setup modules: onDelayedInit
                     // ====================================================
@@ -262,6 +273,7 @@ int App::run(int argc, char** argv)
                     globalModule.onDelayedInit();
                     for (mu::modularity::IModuleSetup* m : m_modules) {
                         m->onDelayedInit();
+                        STEP_TIME("Startup", std::string("onDelayedInit: ") + m->moduleName());
                     }
                 }
             }, Qt::QueuedConnection);
@@ -354,9 +366,10 @@ int App::processConverter(const CommandLineController::ConverterTask& task)
     bool forceMode = task.params[CommandLineController::ParamKey::ForceMode].toBool();
 
     switch (task.type) {
-    case CommandLineController::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
-        break;
+    case CommandLineController::ConvertType::Batch: {
+        int jobCount = task.params.value(CommandLineController::ParamKey::JobCount, 1).toInt();
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, jobCount);
+    } break;
     case CommandLineController::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
         break;
@@ -370,6 +383,9 @@ int App::processConverter(const CommandLineController::ConverterTask& task)
     case CommandLineController::ConvertType::ExportScoreMeta:
         ret = converter()->exportScoreMeta(task.inputFile, task.outputFile, stylePath, forceMode);
         break;
+    case CommandLineController::ConvertType::ExportScoreStats:
+        ret = converter()->exportScoreStats(task.inputFile, task.outputFile, stylePath, forceMode);
+        break;
     case CommandLineController::ConvertType::ExportScoreParts:
         ret = converter()->exportScoreParts(task.inputFile, task.outputFile, stylePath, forceMode);
         break;
@@ -432,6 +448,9 @@ int App::processDiagnostic(const CommandLineController::Diagnostic& task)
     case CommandLineController::DiagnosticType::DrawDataToPng:
         ret = diagnosticDrawProvider()->drawDataToPng(input.front(), output);
         break;
+    case CommandLineController::DiagnosticType::DrawDataStats:
+        ret = diagnosticDrawProvider()->drawDataStats(input.front(), output);
+        break;
     case CommandLineController::DiagnosticType::DrawDiffToPng: {
         io::path_t diffPath = input.at(0);
         io::path_t refPath;
@@ -54,6 +54,8 @@ void CommandLineController::parse(const QStringList& args)
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("jobs", "Use with '-j <file>', run the job list in the given number of parallel worker processes",
+                                          "number"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -66,6 +68,7 @@ void CommandLineController::parse(const QStringList& args)
                                           "Export all media (excepting mp3) for a given score in a single JSON file and print it to stdout"));
     m_parser.addOption(QCommandLineOption("highlight-config", "Set highlight to svg, generated from a given score", "highlight-config"));
     m_parser.addOption(QCommandLineOption("score-meta", "Export score metadata to JSON document and print it to stdout"));
+    m_parser.addOption(QCommandLineOption("score-stats", "Export score complexity statistics to JSON document and print it to stdout"));
     m_parser.addOption(QCommandLineOption("score-parts", "Generate parts data for the given score and save them to separate mscz files"));
     m_parser.addOption(QCommandLineOption("score-parts-pdf",
                                           "Generate parts data for the given score and export the data to a single JSON file, print it to stdout"));
@@ -101,6 +104,7 @@ void CommandLineController::parse(const QStringList& args)
     m_parser.addOption(QCommandLineOption("diagnostic-gen-drawdata", "Generate engraving draw data", "scores-dir"));
     m_parser.addOption(QCommandLineOption("diagnostic-com-drawdata", "Compare engraving draw data"));
     m_parser.addOption(QCommandLineOption("diagnostic-drawdata-to-png", "Convert draw data to png", "file"));
+    m_parser.addOption(QCommandLineOption("diagnostic-drawdata-stats", "Print draw call statistics for draw data", "file"));
     m_parser.addOption(QCommandLineOption("diagnostic-drawdiff-to-png", "Convert draw diff to png"));
 
     // Autobot
@@ -236,6 +240,9 @@ void CommandLineController::apply()
         application()->setRunMode(IApplication::RunMode::ConsoleApp);
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = m_parser.value("j");
+        if (m_parser.isSet("jobs")) {
+            m_converterTask.params[CommandLineController::ParamKey::JobCount] = m_parser.value("jobs").toInt();
+        }
     }
 
     if (m_parser.isSet("score-media")) {
@@ -253,6 +260,12 @@ void CommandLineController::apply()
         m_converterTask.inputFile = scorefiles[0];
     }
 
+    if (m_parser.isSet("score-stats")) {
+        application()->setRunMode(IApplication::RunMode::ConsoleApp);
+        m_converterTask.type = ConvertType::ExportScoreStats;
+        m_converterTask.inputFile = scorefiles[0];
+    }
+
     if (m_parser.isSet("score-parts")) {
         application()->setRunMode(IApplication::RunMode::ConsoleApp);
         m_converterTask.type = ConvertType::ExportScoreParts;
@@ -415,6 +428,12 @@ void CommandLineController::apply()
         m_diagnostic.input << m_parser.value("diagnostic-drawdata-to-png");
     }
 
+    if (m_parser.isSet("diagnostic-drawdata-stats")) {
+        application()->setRunMode(IApplication::RunMode::ConsoleApp);
+        m_diagnostic.type = DiagnosticType::DrawDataStats;
+        m_diagnostic.input << m_parser.value("diagnostic-drawdata-stats");
+    }
+
     if (m_parser.isSet("diagnostic-drawdiff-to-png")) {
         application()->setRunMode(IApplication::RunMode::ConsoleApp);
         m_diagnostic.type = DiagnosticType::DrawDiffToPng;
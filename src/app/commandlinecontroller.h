@@ -62,6 +62,7 @@ public:
         ConvertScoreParts,
         ExportScoreMedia,
         ExportScoreMeta,
+        ExportScoreStats,
         ExportScoreParts,
         ExportScorePartsPdf,
         ExportScoreTranspose,
@@ -75,6 +76,7 @@ public:
         ScoreSource,
         ScoreTransposeOptions,
         ForceMode,
+        JobCount,
 
         // Video
     };
@@ -93,6 +95,7 @@ public:
         GenDrawData,
         ComDrawData,
         DrawDataToPng,
+        DrawDataStats,
         DrawDiffToPng
     };
 
@@ -63,8 +63,18 @@ void SessionsManager::restore()
         return;
     }
 
-    for (const io::path_t& path : projects) {
-        dispatcher()->dispatch("file-open", actions::ActionData::make_arg1<io::path_t>(path));
+    //! NOTE The first project loads in this window; the others are
+    //! independent, so their instances are started in one batch and load
+    //! concurrently instead of each waiting out the previous startup
+    dispatcher()->dispatch("file-open", actions::ActionData::make_arg1<io::path_t>(projects.front()));
+
+    QList<QStringList> argsList;
+    for (size_t i = 1; i < projects.size(); ++i) {
+        argsList << QStringList { projects[i].toQString() };
+    }
+
+    if (!argsList.empty()) {
+        multiInstancesProvider()->openNewAppInstances(argsList);
     }
 }
 
@@ -366,6 +366,7 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
     if (globalConfiguration()->devModeEnabled()) {
         MenuItemList engravingItems {
             makeMenuItem("diagnostic-show-engraving-elements"),
+            makeMenuItem("diagnostic-engraving-elements-stat-dump"),
             makeSeparator(),
             makeMenuItem("show-element-bounding-rects"),
             makeMenuItem("color-element-shapes"),
@@ -373,7 +374,10 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
             makeMenuItem("color-segment-shapes"),
             makeMenuItem("show-skylines"),
             makeMenuItem("show-system-bounding-rects"),
-            makeMenuItem("show-corrupted-measures")
+            makeMenuItem("show-corrupted-measures"),
+            makeSeparator(),
+            makeMenuItem("diagnostic-notationview-perf-hud"),
+            makeMenuItem("diagnostic-notationview-jank-log")
         };
 
         MenuItemList autobotItems {
@@ -51,6 +51,7 @@
 #include "internal/api/diagnosticsapi.h"
 #include "internal/api/processapi.h"
 #include "internal/api/filesystemapi.h"
+#include "internal/api/perfapi.h"
 
 #include "diagnostics/idiagnosticspathsregister.h"
 
@@ -103,6 +104,7 @@ void AutobotModule::resolveImports()
         api->regApiCreator("global", "api.filesystem", new ApiCreator<FileSystemApi>());
         api->regApiCreator("autobot", "api.autobot", new ApiCreator<AutobotApi>());
         api->regApiCreator("autobot", "api.context", new ApiCreator<ContextApi>());
+        api->regApiCreator("autobot", "api.perf", new ApiCreator<PerfApi>());
         api->regApiCreator("actions", "api.dispatcher", new ApiCreator<DispatcherApi>());
         api->regApiCreator("ui", "api.navigation", new ApiCreator<NavigationApi>());
         api->regApiCreator("ui", "api.keyboard", new ApiCreator<KeyboardApi>());
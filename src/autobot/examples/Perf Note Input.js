@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Latency SLO test: open a (preferably heavy) score and check the
+// action-to-paint latency of typical interactions.
+// A measure finishes on the next painted frame, so the budget
+// check goes into a later step than its startMeasure.
+
+function main()
+{
+    var testCase = {
+        name: "Perf Note Input",
+        steps: [
+            {name: "Open Score", func: function() {
+                api.autobot.openProject("vtest_scores_7_liszt.mscz")
+            }},
+            {name: "Note input mode", func: function() {
+                api.perf.startMeasure("note-input")
+                api.dispatcher.dispatch("note-input")
+            }},
+            {name: "Put note", func: function() {
+                api.perf.checkBudget("note-input", 100)
+
+                api.perf.startMeasure("put-note")
+                api.dispatcher.dispatch("note-c")
+            }},
+            {name: "Next page", func: function() {
+                api.perf.checkBudget("put-note", 100)
+
+                api.perf.startMeasure("page-down")
+                api.shortcuts.activate("Ctrl+End")
+            }},
+            {name: "Report", func: function() {
+                api.perf.checkBudget("page-down", 100)
+                api.perf.printReport()
+            }},
+        ]
+    };
+
+    api.autobot.setInterval(1000)
+    api.autobot.runTestCase(testCase)
+}
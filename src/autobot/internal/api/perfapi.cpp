@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "perfapi.h"
+
+#include <QQuickWindow>
+
+#include "log.h"
+
+using namespace mu::api;
+
+PerfApi::PerfApi(IApiEngine* e)
+    : ApiObject(e)
+{
+}
+
+void PerfApi::startMeasure(const QString& name)
+{
+    Measure& measure = m_measures[name];
+    measure.resultMs = -1;
+    measure.timer.start();
+
+    QQuickWindow* window = qobject_cast<QQuickWindow*>(mainWindow()->qWindow());
+    IF_ASSERT_FAILED(window) {
+        return;
+    }
+
+    auto connection = std::make_shared<QMetaObject::Connection>();
+    *connection = QObject::connect(window, &QQuickWindow::frameSwapped, this, [this, name, connection]() {
+        Measure& measure = m_measures[name];
+        measure.resultMs = measure.timer.elapsed();
+        QObject::disconnect(*connection);
+    });
+}
+
+qint64 PerfApi::elapsedMs(const QString& name) const
+{
+    auto it = m_measures.constFind(name);
+    if (it == m_measures.constEnd()) {
+        return -1;
+    }
+
+    return it->resultMs;
+}
+
+bool PerfApi::checkBudget(const QString& name, qint64 budgetMs)
+{
+    qint64 result = elapsedMs(name);
+    if (result < 0) {
+        autobot()->fatal(QString("measure not finished: %1").arg(name));
+        return false;
+    }
+
+    if (result > budgetMs) {
+        autobot()->fatal(QString("budget exceeded: %1, took: %2 ms, budget: %3 ms")
+                         .arg(name).arg(result).arg(budgetMs));
+        return false;
+    }
+
+    LOGI() << "budget ok: " << name << ", took: " << result << " ms, budget: " << budgetMs << " ms";
+    return true;
+}
+
+void PerfApi::printReport() const
+{
+    for (auto it = m_measures.constBegin(); it != m_measures.constEnd(); ++it) {
+        LOGI() << "measure: " << it.key() << ", took: " << it->resultMs << " ms";
+    }
+}
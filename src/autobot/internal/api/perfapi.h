@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_API_PERFAPI_H
+#define MU_API_PERFAPI_H
+
+#include <QElapsedTimer>
+#include <QMap>
+
+#include "apiobject.h"
+
+#include "modularity/ioc.h"
+#include "autobot/iautobot.h"
+#include "ui/imainwindow.h"
+
+namespace mu::api {
+class PerfApi : public ApiObject
+{
+    Q_OBJECT
+
+    INJECT(api, autobot::IAutobot, autobot)
+    INJECT(api, ui::IMainWindow, mainWindow)
+
+public:
+    explicit PerfApi(IApiEngine* e);
+
+    //! NOTE Starts a named measurement that finishes on the next frame
+    //! painted after this call, so a step can do
+    //! api.perf.startMeasure("put note"); api.dispatcher.dispatch("note-input")
+    //! and a later step can check the action-to-paint latency
+    Q_INVOKABLE void startMeasure(const QString& name);
+
+    //! NOTE -1 while the measurement hasn't seen its frame yet
+    Q_INVOKABLE qint64 elapsedMs(const QString& name) const;
+
+    //! NOTE Fails the run (autobot fatal) if the measurement exceeded the budget
+    Q_INVOKABLE bool checkBudget(const QString& name, qint64 budgetMs);
+
+    Q_INVOKABLE void printReport() const;
+
+private:
+    struct Measure {
+        QElapsedTimer timer;
+        qint64 resultMs = -1;
+    };
+
+    QMap<QString, Measure> m_measures;
+};
+}
+
+#endif // MU_API_PERFAPI_H
@@ -80,5 +80,11 @@ void CloudModule::onInit(const framework::IApplication::RunMode& mode)
     }
 
     s_cloudConfiguration->init();
+}
+
+void CloudModule::onDelayedInit()
+{
+    //! NOTE Reading the stored tokens and requesting the account info
+    //! aren't needed for the first paint, so they wait for the main window
     s_cloudService->init();
 }
@@ -32,6 +32,7 @@ enum class Err {
 
     BatchJobFileFailedOpen = 1301,
     BatchJobFileFailedParse = 1302,
+    BatchJobsFailed = 1303,
 
     ConvertTypeUnknown = 1310,
 
@@ -35,7 +35,8 @@ public:
 
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                             bool forceMode = false) = 0;
-    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                             int jobCount = 1) = 0;
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
 
@@ -44,6 +45,8 @@ public:
                                  const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret exportScoreMeta(const io::path_t& in, const io::path_t& out,
                                 const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret exportScoreStats(const io::path_t& in, const io::path_t& out,
+                                 const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret exportScoreParts(const io::path_t& in, const io::path_t& out,
                                  const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret exportScorePartsPdfs(const io::path_t& in, const io::path_t& out,
@@ -58,6 +58,7 @@ static const std::string MIDI_WRITER_NAME = "midi";
 static const std::string MUSICXML_WRITER_NAME = "mxl";
 static const std::string MUSICXML_JSON_NAME = "mxml";
 static const std::string META_DATA_NAME = "metadata";
+static const std::string STATS_NAME = "stats";
 static const std::string DEV_INFO_NAME = "devinfo";
 
 static constexpr bool ADD_SEPARATOR = true;
@@ -117,6 +118,27 @@ Ret BackendApi::exportScoreMeta(const io::path_t& in, const io::path_t& out, con
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
+Ret BackendApi::exportScoreStats(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC
+
+    RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
+    if (!prj.ret) {
+        return prj.ret;
+    }
+
+    INotationPtr notation = prj.val->masterNotation()->notation();
+
+    QFile outputFile;
+    openOutputFile(outputFile, out);
+
+    BackendJsonWriter jsonWriter(&outputFile);
+
+    bool result = exportScoreStatsData(notation, jsonWriter);
+
+    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+}
+
 Ret BackendApi::exportScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC
@@ -450,6 +472,32 @@ Ret BackendApi::exportScoreMetaData(const INotationPtr notation, BackendJsonWrit
     return make_ret(Ret::Code::Ok);
 }
 
+Ret BackendApi::exportScoreStatsData(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
+{
+    TRACEFUNC
+
+    ScoreComplexityStats stats = notation->elements()->complexityStats();
+
+    QJsonObject statsObj;
+    statsObj["measures"] = static_cast<qint64>(stats.measureCount);
+    statsObj["notes"] = static_cast<qint64>(stats.noteCount);
+    statsObj["chordRests"] = static_cast<qint64>(stats.chordRestCount);
+    statsObj["spanners"] = static_cast<qint64>(stats.spannerCount);
+    statsObj["textChars"] = static_cast<qint64>(stats.textCharCount);
+    statsObj["totalElements"] = static_cast<qint64>(stats.totalElementCount);
+
+    QJsonObject elementsObj;
+    for (const auto& pair : stats.elementCountsByType) {
+        elementsObj[QString::fromStdString(pair.first)] = static_cast<qint64>(pair.second);
+    }
+    statsObj["elementsByType"] = elementsObj;
+
+    jsonWriter.addKey(STATS_NAME.c_str());
+    jsonWriter.addValue(QJsonDocument(statsObj).toJson(), addSeparator, true);
+
+    return make_ret(Ret::Code::Ok);
+}
+
 Ret BackendApi::devInfo(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
 {
     UNUSED(notation);
@@ -47,6 +47,7 @@ public:
     static Ret exportScoreMedia(const io::path_t& in, const io::path_t& out, const io::path_t& highlightConfigPath,
                                 const io::path_t& stylePath = "", bool forceMode = false);
     static Ret exportScoreMeta(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode = false);
+    static Ret exportScoreStats(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode = false);
     static Ret exportScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode = false);
     static Ret exportScorePartsPdfs(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode = false);
     static Ret exportScoreTranspose(const io::path_t& in, const io::path_t& out, const std::string& optionsJson,
@@ -74,6 +75,7 @@ private:
     static Ret exportScoreMidi(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static Ret exportScoreMusicXML(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static Ret exportScoreMetaData(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
+    static Ret exportScoreStatsData(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static Ret devInfo(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
 
     static mu::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtr notation);
@@ -21,13 +21,20 @@
  */
 #include "convertercontroller.h"
 
+#include <memory>
+#include <vector>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QProcess>
 
 #include "convertercodes.h"
+#include "engraving/infrastructure/mscio.h"
 #include "stringutils.h"
 #include "compat/backendapi.h"
 
@@ -40,7 +47,22 @@ using namespace mu::notation;
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 
-mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
+static constexpr int BATCH_JOB_TIMEOUT_MSECS = 10 * 60 * 1000;
+static constexpr int FARM_POLL_INTERVAL_MSECS = 10;
+
+static mu::Ret makeBatchRet(size_t total, size_t failed)
+{
+    LOGI() << "BatchConvert: total: " << total << ", ok: " << (total - failed) << ", failed: " << failed;
+
+    if (failed > 0) {
+        return make_ret(mu::converter::Err::BatchJobsFailed,
+                        std::to_string(failed) + " of " + std::to_string(total) + " jobs failed");
+    }
+
+    return mu::make_ret(mu::Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode, int jobCount)
 {
     TRACEFUNC;
 
@@ -50,16 +72,108 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
         return batchJob.ret;
     }
 
-    Ret ret = make_ret(Ret::Code::Ok);
-    for (const Job& job : batchJob.val) {
-        ret = fileConvert(job.in, job.out, stylePath, forceMode);
+    if (jobCount > 1) {
+        return convertFarm(batchJob.val, stylePath, forceMode, jobCount);
+    }
+
+    return convertSerially(batchJob.val, stylePath, forceMode);
+}
+
+mu::Ret ConverterController::convertSerially(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    //! NOTE a failed job is recorded but does not abort the batch - the
+    //! remaining jobs are still worth converting, the summary reports the losses
+    size_t failed = 0;
+    for (const Job& job : batchJob) {
+        Ret ret = fileConvert(job.in, job.out, stylePath, forceMode);
         if (!ret) {
             LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
-            break;
+            ++failed;
+        }
+    }
+
+    return makeBatchRet(batchJob.size(), failed);
+}
+
+mu::Ret ConverterController::convertFarm(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode, int jobCount) const
+{
+    TRACEFUNC;
+
+    //! NOTE every job runs in its own worker process, so a crash or a hang on
+    //! one corrupt file costs that file only; up to jobCount workers run at once
+    struct Worker {
+        std::unique_ptr<QProcess> process;
+        QElapsedTimer aliveTimer;
+        Job job;
+    };
+
+    std::vector<Job> jobs(batchJob.cbegin(), batchJob.cend());
+    std::list<Worker> workers;
+    size_t nextJobIdx = 0;
+    size_t failed = 0;
+
+    const QString selfPath = QCoreApplication::applicationFilePath();
+
+    auto startNextJob = [this, &jobs, &workers, &nextJobIdx, &selfPath, &stylePath, forceMode]() {
+        Worker worker;
+        worker.job = jobs[nextJobIdx++];
+
+        QStringList args { worker.job.in.toQString(), "-o", worker.job.out.toQString() };
+        if (!stylePath.empty()) {
+            args << "-S" << stylePath.toQString();
+        }
+        if (forceMode) {
+            args << "-f";
+        }
+
+        worker.process = std::make_unique<QProcess>();
+        worker.process->start(selfPath, args);
+        worker.aliveTimer.start();
+
+        workers.push_back(std::move(worker));
+    };
+
+    while (nextJobIdx < jobs.size() || !workers.empty()) {
+        while (nextJobIdx < jobs.size() && workers.size() < static_cast<size_t>(jobCount)) {
+            startNextJob();
+        }
+
+        for (auto it = workers.begin(); it != workers.end();) {
+            QProcess* process = it->process.get();
+
+            //! NOTE the short wait both yields the cpu and pumps this process'es
+            //! state, no event loop is running here
+            process->waitForFinished(FARM_POLL_INTERVAL_MSECS);
+
+            if (process->state() != QProcess::NotRunning) {
+                if (it->aliveTimer.elapsed() >= BATCH_JOB_TIMEOUT_MSECS) {
+                    LOGE() << "job timed out, in: " << it->job.in << ", out: " << it->job.out;
+                    process->kill();
+                    process->waitForFinished();
+                    ++failed;
+                    it = workers.erase(it);
+                    continue;
+                }
+
+                ++it;
+                continue;
+            }
+
+            if (process->exitStatus() != QProcess::NormalExit) {
+                LOGE() << "job crashed, in: " << it->job.in << ", out: " << it->job.out;
+                ++failed;
+            } else if (process->exitCode() != 0) {
+                LOGE() << "job failed, code: " << process->exitCode() << ", in: " << it->job.in << ", out: " << it->job.out;
+                ++failed;
+            }
+
+            it = workers.erase(it);
         }
     }
 
-    return ret;
+    return makeBatchRet(jobs.size(), failed);
 }
 
 mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
@@ -73,17 +187,44 @@ mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t&
     }
 
     std::string suffix = io::suffix(out);
+
+    //! NOTE migrate-and-resave: when the output is itself a MuseScore file
+    //! there is no notation writer to look up - the project is migrated to
+    //! the current version on load, so it only has to be saved again
+    if (engraving::isMuseScoreFile(suffix)) {
+        Ret ret = notationProject->load(in, stylePath, forceMode);
+        if (!ret) {
+            LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
+            return make_ret(Err::InFileFailedLoad);
+        }
+
+        ret = notationProject->save(out, SaveMode::SaveAs);
+        if (!ret) {
+            LOGE() << "failed save notation, err: " << ret.toString() << ", path: " << out;
+            return make_ret(Err::OutFileFailedWrite);
+        }
+
+        return make_ret(Ret::Code::Ok);
+    }
+
     auto writer = writers()->writer(suffix);
     if (!writer) {
         return make_ret(Err::ConvertTypeUnknown);
     }
 
+    QElapsedTimer timer;
+    timer.start();
+
     Ret ret = notationProject->load(in, stylePath, forceMode);
     if (!ret) {
         LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
         return make_ret(Err::InFileFailedLoad);
     }
 
+    //! NOTE loading includes the initial layout, so the split below is
+    //! effectively read+layout vs rendering; vtest-perf.sh parses these lines
+    qint64 loadMsecs = timer.restart();
+
     globalContext()->setCurrentProject(notationProject);
 
     if (isConvertPageByPage(suffix)) {
@@ -92,6 +233,8 @@ mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t&
         ret = convertFullNotation(writer, notationProject->masterNotation()->notation(), out);
     }
 
+    LOGI() << "ConvertPerf: in: " << in << ", load_ms: " << loadMsecs << ", export_ms: " << timer.elapsed();
+
     return make_ret(Ret::Code::Ok);
 }
 
@@ -299,6 +442,14 @@ mu::Ret ConverterController::exportScoreMeta(const mu::io::path_t& in, const mu:
     return BackendApi::exportScoreMeta(in, out, stylePath, forceMode);
 }
 
+mu::Ret ConverterController::exportScoreStats(const mu::io::path_t& in, const mu::io::path_t& out, const io::path_t& stylePath,
+                                              bool forceMode)
+{
+    TRACEFUNC;
+
+    return BackendApi::exportScoreStats(in, out, stylePath, forceMode);
+}
+
 mu::Ret ConverterController::exportScoreParts(const mu::io::path_t& in, const mu::io::path_t& out, const io::path_t& stylePath,
                                               bool forceMode)
 {
@@ -47,7 +47,8 @@ public:
 
     Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                     bool forceMode = false) override;
-    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                     int jobCount = 1) override;
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
 
@@ -56,6 +57,8 @@ public:
                          bool forceMode = false) override;
     Ret exportScoreMeta(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                         bool forceMode = false) override;
+    Ret exportScoreStats(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
+                         bool forceMode = false) override;
     Ret exportScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                          bool forceMode = false) override;
     Ret exportScorePartsPdfs(const io::path_t& in, const io::path_t& out,
@@ -78,6 +81,9 @@ private:
 
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
 
+    Ret convertSerially(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode);
+    Ret convertFarm(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode, int jobCount) const;
+
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
     Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
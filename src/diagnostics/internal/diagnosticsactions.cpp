@@ -63,6 +63,21 @@ const UiActionList DiagnosticsActions::m_actions = {
              mu::context::UiCtxAny,
              mu::context::CTX_ANY,
              TranslatableString("action", "Engraving &elements")
+             ),
+    UiAction("diagnostic-engraving-elements-stat-dump",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Engraving elements &statistics dump")
+             ),
+    UiAction("diagnostic-notationview-perf-hud",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Notation view performance &HUD")
+             ),
+    UiAction("diagnostic-notationview-jank-log",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Save notation view &jank log")
              )
 };
 
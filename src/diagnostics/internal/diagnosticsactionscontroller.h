@@ -27,6 +27,7 @@
 #include "actions/actionable.h"
 #include "iinteractive.h"
 #include "accessibility/iaccessibilitycontroller.h"
+#include "iengravingelementsprovider.h"
 #include "isavediagnosticfilesscenario.h"
 
 namespace mu::diagnostics {
@@ -35,6 +36,7 @@ class DiagnosticsActionsController : public actions::Actionable
     INJECT(diagnostics, actions::IActionsDispatcher, dispatcher)
     INJECT(diagnostics, framework::IInteractive, interactive)
     INJECT(diagnostics, diagnostics::ISaveDiagnosticFilesScenario, saveDiagnosticsScenario)
+    INJECT(diagnostics, diagnostics::IEngravingElementsProvider, engravingElementsProvider)
 
 public:
     DiagnosticsActionsController() = default;
@@ -24,6 +24,9 @@
 #include "global/io/fileinfo.h"
 #include "global/io/file.h"
 
+#include "draw/utils/drawdatarw.h"
+#include "draw/utils/drawdatastats.h"
+
 #include "drawdatagenerator.h"
 #include "drawdataconverter.h"
 #include "drawdatacomparator.h"
@@ -37,6 +40,7 @@ using namespace mu::diagnostics;
 // --diagnostic-gen-drawdata ./vtest/scores/accidental-1.mscx --diagnostic-output ./drawdata/accidental-1.json
 // --diagnostic-com-drawdata ./drawdata/accidental-1.json ./drawdata/accidental-2.json --diagnostic-output ./drawdata/accidental-1-2.diff.json
 // --diagnostic-drawdata-to-png ./drawdata/accidental-1.json --diagnostic-output ./drawdata/accidental-1.png
+// --diagnostic-drawdata-stats ./drawdata/accidental-1.json --diagnostic-output ./drawdata/accidental-1.stats.txt
 // --diagnostic-drawdiff-to-png ./drawdata/accidental-1-2.diff.json ./drawdata/accidental-1.json --diagnostic-output ./drawdata/accidental-1-2.diff.png
 // ./vtest/scores/accidental-1.mscx -o ./work/1_accidental-1.exp.png
 // ./vtest/scores/emmentaler-text-3.mscx -o ./work/emmentaler-text-3.png
@@ -87,6 +91,27 @@ Ret DiagnosticDrawProvider::drawDataToPng(const io::path_t& dataFile, const io::
     return c.drawDataToPng(dataFile, outFile);
 }
 
+Ret DiagnosticDrawProvider::drawDataStats(const io::path_t& dataFile, const io::path_t& outFile)
+{
+    LOGI() << "dataFile: " << dataFile << ", outFile: " << outFile;
+
+    RetVal<draw::DrawDataPtr> data = draw::DrawDataRW::readData(dataFile);
+    if (!data.ret) {
+        return data.ret;
+    }
+
+    String stats = draw::DrawDataStats::toString(data.val);
+    LOGI() << "\n" << stats;
+
+    //! NOTE the stats are primarily read from the log; a report file is
+    //! written only when an explicit output file is given
+    if (outFile.empty() || io::FileInfo(outFile).entryType() == io::EntryType::Dir) {
+        return make_ok();
+    }
+
+    return io::File::writeFile(outFile, stats.toUtf8());
+}
+
 Ret DiagnosticDrawProvider::drawDiffToPng(const io::path_t& diffFile, const io::path_t& refFile, const io::path_t& outFile)
 {
     LOGI() << "diffFile: " << diffFile << ", refFile: " << refFile << ", outFile: " << outFile;
@@ -21,6 +21,7 @@
  */
 #include "engravingelementsprovider.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "stringutils.h"
@@ -45,23 +46,29 @@ void EngravingElementsProvider::printStatistic(const std::string& title)
     std::stringstream stream;
     stream << "\n\n";
     stream << title << "\n";
-    stream << TITLE("Object") << TITLE("created") << TITLE("deleted") << "\n";
+    stream << TITLE("Object") << TITLE("created") << TITLE("deleted") << TITLE("live") << TITLE("peak") << "\n";
 
     int regCountTotal = 0;
     int unregCountTotal = 0;
+    int liveCountTotal = 0;
+    int peakCountTotal = 0;
     for (auto it = m_statistics.begin(); it != m_statistics.end(); ++it) {
         const ObjectStatistic& s = it->second;
         stream << FORMAT(it->first, 20)
                << VALUE(s.regCount)
                << VALUE(s.unregCount)
+               << VALUE(s.liveCount)
+               << VALUE(s.peakCount)
                << "\n";
 
         regCountTotal += s.regCount;
         unregCountTotal += s.unregCount;
+        liveCountTotal += s.liveCount;
+        peakCountTotal += s.peakCount;
     }
 
     stream << "-----------------------------------------------------\n";
-    stream << FORMAT("Total", 20) << VALUE(regCountTotal) << VALUE(unregCountTotal);
+    stream << FORMAT("Total", 20) << VALUE(regCountTotal) << VALUE(unregCountTotal) << VALUE(liveCountTotal) << VALUE(peakCountTotal);
 
     LOGD() << stream.str() << '\n';
 }
@@ -69,13 +76,20 @@ void EngravingElementsProvider::printStatistic(const std::string& title)
 void EngravingElementsProvider::reg(const mu::engraving::EngravingObject* e)
 {
     m_elements.insert(e);
-    m_statistics[e->typeName()].regCount++;
+
+    ObjectStatistic& s = m_statistics[e->typeName()];
+    s.regCount++;
+    s.liveCount++;
+    s.peakCount = std::max(s.peakCount, s.liveCount);
 }
 
 void EngravingElementsProvider::unreg(const mu::engraving::EngravingObject* e)
 {
     m_elements.erase(e);
-    m_statistics[e->typeName()].unregCount++;
+
+    ObjectStatistic& s = m_statistics[e->typeName()];
+    s.unregCount++;
+    s.liveCount--;
 }
 
 const EngravingObjectList& EngravingElementsProvider::elements() const
@@ -101,6 +115,11 @@ bool EngravingElementsProvider::isSelected(const mu::engraving::EngravingObject*
     return false;
 }
 
+const EngravingObjectList& EngravingElementsProvider::selected() const
+{
+    return m_selected;
+}
+
 mu::async::Channel<const mu::engraving::EngravingObject*, bool> EngravingElementsProvider::selectChanged() const
 {
     return m_selectChanged;
@@ -50,6 +50,7 @@ public:
     // debug draw
     void select(const mu::engraving::EngravingObject* e, bool arg) override;
     bool isSelected(const mu::engraving::EngravingObject* e) const override;
+    const EngravingObjectList& selected() const override;
     async::Channel<const mu::engraving::EngravingObject*, bool> selectChanged() const override;
 
     void checkTree(mu::engraving::Score* score);
@@ -64,6 +65,8 @@ private:
     {
         int regCount = 0;
         int unregCount = 0;
+        int liveCount = 0;
+        int peakCount = 0;
     };
 
     std::map<std::string, ObjectStatistic> m_statistics;
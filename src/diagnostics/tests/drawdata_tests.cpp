@@ -28,6 +28,7 @@
 #include "draw/bufferedpaintprovider.h"
 #include "draw/utils/drawdatarw.h"
 #include "draw/utils/drawdatacomp.h"
+#include "draw/utils/drawdatastats.h"
 
 #include "global/io/file.h"
 
@@ -294,3 +295,31 @@ TEST_F(Diagnostics_DrawDataTests, ScoreDrawDiff)
 
     saveDiff("4_diff.png", data1, diff.dataAdded);
 }
+
+TEST_F(Diagnostics_DrawDataTests, DrawStats)
+{
+    DrawDataPtr data;
+    // paint
+    {
+        std::shared_ptr<BufferedPaintProvider> prv = std::make_shared<BufferedPaintProvider>();
+        Painter p(prv, "test");
+
+        p.setViewport(RectF(0, 0, 100, 100));
+        p.beginObject("page_1");
+
+        p.drawRect(RectF(0, 0, 100, 100)); // covers the viewport
+        p.drawRect(RectF(0, 0, 50, 50));   // overdraws a quarter of it
+
+        p.endObject();
+        p.endDraw();
+
+        data = prv->drawData();
+    }
+
+    DrawDataStats::Stats stats = DrawDataStats::stats(data);
+
+    EXPECT_EQ(stats.pathCount, 2); // drawRect is recorded as a path
+    EXPECT_EQ(stats.totalCallCount(), 2);
+    EXPECT_DOUBLE_EQ(stats.viewportArea, 100.0 * 100.0);
+    EXPECT_DOUBLE_EQ(stats.overdraw(), 1.25);
+}
@@ -206,44 +206,44 @@ void EventList::insert(const Event& e)
 
 void EventMap::fixupMIDI()
 {
-    /* track info for each of the 128 possible MIDI notes */
-    struct channelInfo {
-        /* which event the first ME_NOTEON came from */
-        NPlayEvent* event[128];
-        /* how often is the note on right now? */
-        unsigned short nowPlaying[128];
-    };
-
-    /* track info for each channel (on the heap, 0-initialised) */
-    struct channelInfo* info = (struct channelInfo*)calloc(_highestChannel + 1, sizeof(struct channelInfo));
-
-    auto it = begin();
-    while (it != end()) {
+    FixupMidiState state;
+    state.channels.resize(_highestChannel + 1);
+
+    fixupMIDI(state, begin(), end());
+}
+
+void EventMap::fixupMIDI(FixupMidiState& state, const int fromTick, const int toTick)
+{
+    fixupMIDI(state, lower_bound(fromTick), lower_bound(toTick));
+}
+
+void EventMap::fixupMIDI(FixupMidiState& state, iterator it, const iterator itEnd)
+{
+    while (it != itEnd) {
         NPlayEvent& event = it->second;
         /* ME_NOTEOFF is never emitted, no need to check for it */
         if (event.type() == ME_NOTEON && !event.isMuted()) {
-            unsigned short np = info[event.channel()].nowPlaying[event.pitch()];
+            FixupMidiState::ChannelInfo& info = state.channel(event.channel());
+            unsigned short np = info.nowPlaying[event.pitch()];
             if (event.velo() == 0) {
                 /* already off (should not happen) or still playing? */
                 if (np == 0 || --np > 0) {
                     event.setDiscard(1);
                 } else {
                     /* hoist NOTEOFF to same track as NOTEON */
-                    event.setOriginatingStaff(info[event.channel()].event[event.pitch()]->getOriginatingStaff());
+                    event.setOriginatingStaff(info.noteOnStaff[event.pitch()]);
                 }
             } else {
                 if (++np > 1) {
                     /* restrike, possibly on different track */
-                    event.setDiscard(info[event.channel()].event[event.pitch()]->getOriginatingStaff() + 1);
+                    event.setDiscard(info.noteOnStaff[event.pitch()] + 1);
                 }
-                info[event.channel()].event[event.pitch()] = &event;
+                info.noteOnStaff[event.pitch()] = event.getOriginatingStaff();
             }
-            info[event.channel()].nowPlaying[event.pitch()] = np;
+            info.nowPlaying[event.pitch()] = np;
         }
 
         ++it;
     }
-
-    free((void*)info);
 }
 }
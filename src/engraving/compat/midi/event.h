@@ -182,13 +182,39 @@ class EventMap : public std::multimap<int, NPlayEvent>
 
     int _highestChannel = 15;
 public:
+    //! @brief state of a fixup pass, kept outside of the map so that the
+    //! fixup can be applied incrementally, in ascending tick windows, while
+    //! the map is still being filled (see MidiRenderer chunked rendering)
+    struct FixupMidiState {
+        struct ChannelInfo {
+            /* staff which the first ME_NOTEON came from */
+            int noteOnStaff[128] = {};
+            /* how often is the note on right now? */
+            unsigned short nowPlaying[128] = {};
+        };
+
+        ChannelInfo& channel(size_t channelIdx)
+        {
+            if (channelIdx >= channels.size()) {
+                channels.resize(channelIdx + 1);
+            }
+            return channels[channelIdx];
+        }
+
+        std::vector<ChannelInfo> channels;
+    };
+
     void fixupMIDI();
+    void fixupMIDI(FixupMidiState& state, const int fromTick, const int toTick);
     void registerChannel(int c)
     {
         if (c > _highestChannel) {
             _highestChannel = c;
         }
     }
+
+private:
+    void fixupMIDI(FixupMidiState& state, iterator it, const iterator itEnd);
 };
 
 typedef EventList::iterator iEvent;
@@ -29,6 +29,7 @@
 
 #include <set>
 #include <cmath>
+#include <limits>
 
 #include "compat/midi/event.h"
 #include "style/style.h"
@@ -1043,10 +1044,9 @@ void MidiRenderer::renderMetronome(EventMap* events, Measure const* m)
     }
 }
 
-void MidiRenderer::renderScore(EventMap* events, const Context& ctx)
+void MidiRenderer::prepareRender(const Context& ctx)
 {
     _context = ctx;
-    PitchWheelRenderer pitchWheelRender(wheelSpec);
 
     score->updateSwing();
     score->updateCapo();
@@ -1055,6 +1055,13 @@ void MidiRenderer::renderScore(EventMap* events, const Context& ctx)
 
     score->updateChannel();
     score->updateVelo();
+}
+
+void MidiRenderer::renderScore(EventMap* events, const Context& ctx)
+{
+    PitchWheelRenderer pitchWheelRender(wheelSpec);
+
+    prepareRender(ctx);
 
     // create note & other events
     for (const Staff* st : score->staves()) {
@@ -1073,6 +1080,131 @@ void MidiRenderer::renderScore(EventMap* events, const Context& ctx)
     }
 }
 
+//---------------------------------------------------------
+//   beginChunkedRender
+//---------------------------------------------------------
+
+void MidiRenderer::beginChunkedRender(EventMap* events, const Context& ctx, int chunkSizeMeasures)
+{
+    prepareRender(ctx);
+
+    _chunkedState = std::make_unique<ChunkedRenderState>();
+    _chunkedState->events = events;
+    _chunkedState->chunkSizeMeasures = std::max(chunkSizeMeasures, 1);
+    _chunkedState->lastMeasures.resize(score->nstaves(), nullptr);
+
+    for (const RepeatSegment* rs : score->repeatList()) {
+        const int tickOffset = rs->utick - rs->tick;
+
+        for (Measure const* m = rs->firstMeasure(); m; m = m->nextMeasure()) {
+            MeasureRenderJob job;
+            job.measure = m;
+            job.tickOffset = tickOffset;
+            job.startUTick = m->tick().ticks() + tickOffset;
+            _chunkedState->jobs.push_back(job);
+        }
+    }
+
+    //! NOTE the measures are not rendered in strictly ascending unrolled-tick
+    //! order, so the consumable boundary after each chunk is the minimal start
+    //! tick over all measures that are still to be rendered
+    _chunkedState->minStartUTickFromJob.resize(_chunkedState->jobs.size() + 1);
+    _chunkedState->minStartUTickFromJob.back() = std::numeric_limits<int>::max();
+
+    for (int i = static_cast<int>(_chunkedState->jobs.size()) - 1; i >= 0; --i) {
+        _chunkedState->minStartUTickFromJob[i] = std::min(_chunkedState->jobs[i].startUTick,
+                                                          _chunkedState->minStartUTickFromJob[i + 1]);
+    }
+
+    //! NOTE the sustain pedal, vibrato and metronome events are sparse, so
+    //! they are rendered upfront; the per-measure events, which dominate the
+    //! memory footprint, are rendered chunk by chunk
+    PitchWheelRenderer pitchWheelRenderer(wheelSpec);
+    renderSpanners(events, pitchWheelRenderer);
+
+    EventMap spannerPitchWheelEvents = pitchWheelRenderer.renderPitchWheel();
+    events->merge(spannerPitchWheelEvents);
+
+    if (ctx.metronome) {
+        renderMetronome(events);
+    }
+}
+
+//---------------------------------------------------------
+//   renderNextChunk
+//---------------------------------------------------------
+
+bool MidiRenderer::renderNextChunk()
+{
+    IF_ASSERT_FAILED(_chunkedState) {
+        return false;
+    }
+
+    ChunkedRenderState& state = *_chunkedState;
+
+    if (state.nextJobIdx >= state.jobs.size()) {
+        return false;
+    }
+
+    const size_t chunkEndIdx = std::min(state.nextJobIdx + static_cast<size_t>(state.chunkSizeMeasures),
+                                        state.jobs.size());
+
+    PitchWheelRenderer pitchWheelRenderer(wheelSpec);
+
+    for (const Staff* staff : score->staves()) {
+        const staff_idx_t staffIdx = staff->idx();
+
+        for (size_t jobIdx = state.nextJobIdx; jobIdx < chunkEndIdx; ++jobIdx) {
+            const MeasureRenderJob& job = state.jobs[jobIdx];
+            Measure const* m = job.measure;
+
+            if (m->isMeasureRepeatGroup(staffIdx)) {
+                MeasureRepeat* mr = m->measureRepeatElement(staffIdx);
+                Measure const* playMeasure = state.lastMeasures[staffIdx];
+                if (!playMeasure || !mr) {
+                    continue;
+                }
+
+                for (int i = m->measureRepeatCount(staffIdx); i < mr->numMeasures() && playMeasure->prevMeasure(); ++i) {
+                    playMeasure = playMeasure->prevMeasure();
+                }
+
+                int offset = (m->tick() - playMeasure->tick()).ticks();
+                collectMeasureEvents(state.events, playMeasure, staff, job.tickOffset + offset, pitchWheelRenderer);
+            } else {
+                state.lastMeasures[staffIdx] = m;
+                collectMeasureEvents(state.events, m, staff, job.tickOffset, pitchWheelRenderer);
+            }
+        }
+    }
+
+    state.nextJobIdx = chunkEndIdx;
+
+    EventMap chunkPitchWheelEvents = pitchWheelRenderer.renderPitchWheel();
+    state.events->merge(chunkPitchWheelEvents);
+
+    int boundaryUTick = state.minStartUTickFromJob[chunkEndIdx];
+    if (boundaryUTick != std::numeric_limits<int>::max()) {
+        //! NOTE grace notes before the beat sound before their chord, so the
+        //! consumable boundary keeps a margin behind the first unrendered measure
+        constexpr int graceNotesSpillMarginTicks = 4 * Constants::division;
+        boundaryUTick = std::max(boundaryUTick - graceNotesSpillMarginTicks, 0);
+    }
+
+    if (boundaryUTick > state.renderedUTick) {
+        state.events->fixupMIDI(state.fixupState, state.fixedUpToUTick, boundaryUTick);
+        state.fixedUpToUTick = boundaryUTick;
+        state.renderedUTick = boundaryUTick;
+    }
+
+    return state.nextJobIdx < state.jobs.size();
+}
+
+int MidiRenderer::renderedUTick() const
+{
+    return _chunkedState ? _chunkedState->renderedUTick : 0;
+}
+
 uint32_t MidiRenderer::getChannel(const Instrument* instr, const Note* note, MidiInstrumentEffect effect)
 {
     int subchannel = note->subchannel();
@@ -24,14 +24,15 @@
 #define __RENDERMIDI_H__
 
 #include <memory>
+#include <vector>
 
 #include "libmscore/instrument.h"
 #include "libmscore/measure.h"
 #include "libmscore/synthesizerstate.h"
+#include "event.h"
 #include "pitchwheelrenderer.h"
 
 namespace mu::engraving {
-class EventMap;
 class MasterScore;
 class Staff;
 class SynthesizerState;
@@ -77,10 +78,25 @@ public:
 
     void renderScore(EventMap* events, const Context& ctx);
 
+    //! @brief chunked streaming alternative to renderScore: the score is
+    //! rendered a group of measures at a time, so that a consumer may start
+    //! draining events before the tail of the score has been rendered and
+    //! keep peak memory bounded on long scores
+    void beginChunkedRender(EventMap* events, const Context& ctx, int chunkSizeMeasures = DEFAULT_CHUNK_SIZE_MEASURES);
+    //! @brief renders the next chunk of measures, returns false when the
+    //! whole score has been rendered
+    bool renderNextChunk();
+    //! @brief events with ticks below the returned (unrolled) tick are final:
+    //! they may be consumed and erased from the event map
+    int renderedUTick() const;
+
     static const int ARTICULATION_CONV_FACTOR { 100000 };
+    static const int DEFAULT_CHUNK_SIZE_MEASURES { 64 };
 
 private:
 
+    void prepareRender(const Context& ctx);
+
     void renderStaff(EventMap* events, const Staff* sctx, PitchWheelRenderer& pitchWheelRenderer);
 
     void renderSpanners(EventMap* events, PitchWheelRenderer& pitchWheelRenderer);
@@ -104,9 +120,34 @@ private:
 
     uint32_t getChannel(const Instrument* instr, const Note* note, MidiInstrumentEffect effect);
 
+    struct MeasureRenderJob {
+        Measure const* measure = nullptr;
+        int tickOffset = 0;
+        int startUTick = 0;
+    };
+
+    struct ChunkedRenderState {
+        EventMap* events = nullptr;
+        int chunkSizeMeasures = DEFAULT_CHUNK_SIZE_MEASURES;
+
+        std::vector<MeasureRenderJob> jobs;
+        //! NOTE minimal startUTick over the jobs from the given index on
+        std::vector<int> minStartUTickFromJob;
+        size_t nextJobIdx = 0;
+
+        //! NOTE per-staff resolution state for measure repeat groups
+        std::vector<Measure const*> lastMeasures;
+
+        EventMap::FixupMidiState fixupState;
+        int fixedUpToUTick = 0;
+        int renderedUTick = 0;
+    };
+
     Score* score = nullptr;
 
     Context _context;
+
+    std::unique_ptr<ChunkedRenderState> _chunkedState;
 };
 } // namespace mu::engraving
 
@@ -91,6 +91,13 @@ void EngravingModule::registerUiTypes()
 
 void EngravingModule::onInit(const framework::IApplication::RunMode& mode)
 {
+    //! NOTE The per-type slab allocator for engraving objects is enabled once
+    //! here, for the whole process lifetime, before any engraving object is
+    //! created. Toggling it around an EngravingProject's lifetime is not safe:
+    //! elements owned by other modules (palettes, clipboard) would then be
+    //! allocated and freed under different modes.
+    ObjectAllocator::used();
+
     if (mode == framework::IApplication::RunMode::AudioPluginProbe) {
         return;
     }
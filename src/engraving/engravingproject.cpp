@@ -57,18 +57,17 @@ std::shared_ptr<EngravingProject> EngravingProject::create(const MStyle& style)
 
 EngravingProject::EngravingProject()
 {
-    ObjectAllocator::used();
 }
 
 EngravingProject::~EngravingProject()
 {
     delete m_masterScore;
 
-    ObjectAllocator::unused();
-
     AllocatorsRegister::instance()->printStatistic("=== Destroy engraving project ===");
-    //! NOTE At the moment, the allocator is working as leak detector. No need to do cleanup, at the moment it can lead to crashes
-    // AllocatorsRegister::instance()->cleanupAll("engraving");
+    //! NOTE The allocator stays enabled for the whole process lifetime (see
+    //! EngravingModule::onInit()); freed chunks go back to the per-type free
+    //! lists and are reused by the next project. No cleanupAll() here: other
+    //! modules (palettes, clipboard) still hold live engraving objects.
 }
 
 void EngravingProject::init(const MStyle& style)
@@ -105,6 +105,16 @@ void DebugPaint::paintElementDebug(mu::draw::Painter& painter, const EngravingIt
 
 void DebugPaint::paintElementsDebug(mu::draw::Painter& painter, const std::vector<EngravingItem*>& elements)
 {
+    auto options = configuration()->debuggingOptions();
+
+    //! NOTE Called on every frame, so it should cost nothing when
+    //! no element overlay is enabled and nothing is selected in the
+    //! diagnostics elements tree
+    if (!options.showElementBoundingRects && !options.colorElementShapes
+        && elementsProvider()->selected().empty()) {
+        return;
+    }
+
     // Setup debug provider
     auto originalProvider = painter.provider();
     std::shared_ptr<PaintDebugger> debugger = std::make_shared<PaintDebugger>(originalProvider);
@@ -135,12 +145,25 @@ void DebugPaint::paintPageDebug(Painter& painter, const Page* page)
         return;
     }
 
+    auto options = configuration()->debuggingOptions();
+
+    //! NOTE Called on every frame, so it should cost nothing when
+    //! no page overlay is enabled (showCorruptedMeasures is painted
+    //! in debug builds only, see below)
+    bool anyEnabled = options.showSystemBoundingRects || options.showSkylines
+                      || options.colorSegmentShapes || options.showSegmentShapes;
+#ifndef NDEBUG
+    anyEnabled |= options.showCorruptedMeasures;
+#endif
+
+    if (!anyEnabled) {
+        return;
+    }
+
     double scaling = painter.worldTransform().m11() / configuration()->guiScaling();
 
     painter.save();
 
-    auto options = configuration()->debuggingOptions();
-
     if (options.showSystemBoundingRects) {
         painter.setBrush(BrushStyle::NoBrush);
         painter.setPen(Pen(Color::BLACK, 3.0 / scaling));
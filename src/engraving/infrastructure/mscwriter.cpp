@@ -94,7 +94,7 @@ MscWriter::IWriter* MscWriter::writer() const
     if (!m_writer) {
         switch (m_params.mode) {
         case MscIoMode::Zip:
-            m_writer = new ZipFileWriter();
+            m_writer = new ZipFileWriter(m_params.compressionLevel);
             break;
         case MscIoMode::Dir:
             m_writer = new DirWriter();
@@ -269,6 +269,7 @@ bool MscWriter::ZipFileWriter::open(io::IODevice* device, const path_t& filePath
     }
 
     m_zip = new ZipWriter(m_device);
+    m_zip->setCompressionLevel(m_compressionLevel);
 
     return true;
 }
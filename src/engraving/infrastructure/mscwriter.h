@@ -43,6 +43,7 @@ public:
         io::path_t filePath;
         String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+        int compressionLevel = -1; // zip mode only: -1 default, 1 fastest .. 9 smallest
     };
 
     MscWriter() = default;
@@ -80,6 +81,8 @@ private:
 
     struct ZipFileWriter : public IWriter
     {
+        explicit ZipFileWriter(int compressionLevel)
+            : m_compressionLevel(compressionLevel) {}
         ~ZipFileWriter() override;
         bool open(io::IODevice* device, const io::path_t& filePath) override;
         void close() override;
@@ -90,6 +93,7 @@ private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
         ZipWriter* m_zip = nullptr;
+        int m_compressionLevel = -1;
     };
 
     struct DirWriter : public IWriter
@@ -126,15 +126,20 @@ void Paint::paintScore(draw::Painter* painter, Score* score, const Options& opt)
             // Draw page elements
             painter->setClipping(true);
             painter->setClipRect(pageRect);
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintElements(*painter, elements, opt.isPrinting);
+            if (!opt.isPrinting) {
+                //! NOTE On screen the same pages are repainted over and over
+                //! while panning/zooming; reuse the page's cached paint order
+                //! instead of querying the BSP tree and re-sorting each frame
+                paintPageElements(*painter, page, drawRect.translated(-pagePos), opt.isPrinting);
+            } else {
+                std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
+                paintElements(*painter, elements, opt.isPrinting);
+            }
             painter->setClipping(false);
 
-#ifdef MUE_ENABLE_ENGRAVING_PAINT_DEBUGGER
             if (!opt.isPrinting) {
                 engraving::DebugPaint::paintPageDebug(*painter, page);
             }
-#endif
 
             if (opt.isMultiPage) {
                 painter->translate(-pagePos);
@@ -196,11 +201,33 @@ void Paint::paintElements(mu::draw::Painter& painter, const std::vector<Engravin
         paintElement(painter, element);
     }
 
-#ifdef MUE_ENABLE_ENGRAVING_PAINT_DEBUGGER
     if (!isPrinting) {
         DebugPaint::paintElementsDebug(painter, sortedElements);
     }
-#else
-    UNUSED(isPrinting);
-#endif
+}
+
+void Paint::paintPageElements(mu::draw::Painter& painter, Page* page, const RectF& drawRect, bool isPrinting)
+{
+    TRACEFUNC;
+    const std::vector<EngravingItem*>& all = page->elementsInPaintOrder();
+
+    std::vector<EngravingItem*> visible;
+    visible.reserve(all.size());
+    for (EngravingItem* element : all) {
+        if (!element->isInteractionAvailable()) {
+            continue;
+        }
+        if (!element->pageBoundingRect().intersects(drawRect)) {
+            continue;
+        }
+        visible.push_back(element);
+    }
+
+    for (const EngravingItem* element : visible) {
+        paintElement(painter, element);
+    }
+
+    if (!isPrinting) {
+        DebugPaint::paintElementsDebug(painter, visible);
+    }
 }
@@ -28,6 +28,7 @@
 
 namespace mu::engraving {
 class EngravingItem;
+class Page;
 class Score;
 
 class Paint
@@ -54,6 +55,7 @@ public:
     static void paintScore(draw::Painter* painter, Score* score, const Options& opt);
     static void paintElement(draw::Painter& painter, const EngravingItem* element);
     static void paintElements(draw::Painter& painter, const std::vector<EngravingItem*>& elements, bool isPrinting);
+    static void paintPageElements(draw::Painter& painter, Page* page, const RectF& drawRect, bool isPrinting);
 
     static SizeF pageSizeInch(Score* score);
 
@@ -52,6 +52,7 @@ EngravingFont::EngravingFont(const std::string& name, const std::string& family,
 
 EngravingFont::EngravingFont(const EngravingFont& other)
 {
+    m_registered = false;
     m_loaded = false;
     m_symbols  = other.m_symbols;
     m_name     = other.m_name;
@@ -87,9 +88,9 @@ double EngravingFont::textEnclosureThickness()
 // Load
 // =============================================
 
-void EngravingFont::ensureLoad()
+void EngravingFont::ensureRegistered()
 {
-    if (m_loaded) {
+    if (m_registered) {
         return;
     }
 
@@ -104,6 +105,20 @@ void EngravingFont::ensureLoad()
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
+    m_registered = true;
+}
+
+void EngravingFont::ensureLoad()
+{
+    if (m_loaded) {
+        return;
+    }
+
+    ensureRegistered();
+    if (!m_registered) {
+        return;
+    }
+
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
@@ -674,18 +689,44 @@ void EngravingFont::draw(SymId id, Painter* painter, double mag, const PointF& p
 
 void EngravingFont::draw(const SymIdList& ids, Painter* painter, double mag, const PointF& startPos) const
 {
-    PointF pos(startPos);
-    for (SymId id : ids) {
-        draw(id, painter, mag, pos);
-        pos.setX(pos.x() + advance(id, mag));
-    }
+    draw(ids, painter, SizeF(mag, mag), startPos);
 }
 
 void EngravingFont::draw(const SymIdList& ids, Painter* painter, const SizeF& mag, const PointF& startPos) const
 {
+    //! NOTE When every symbol of the run is a plain valid glyph, set up the
+    //! painter once for the whole run; a save/scale/setFont/restore cycle per
+    //! glyph dominated the cost of drawing long symbol lists (key signatures,
+    //! compound time signatures, multi-glyph ornaments)
+    bool batchable = true;
+    for (SymId id : ids) {
+        const Sym& s = sym(id);
+        if (s.isCompound() || !s.isValid()) {
+            batchable = false;
+            break;
+        }
+    }
+
+    if (!batchable) {
+        PointF pos(startPos);
+        for (SymId id : ids) {
+            draw(id, painter, mag, pos);
+            pos.setX(pos.x() + advance(id, mag.width()));
+        }
+        return;
+    }
+
+    painter->save();
+    double size = 20.0 * MScore::pixelRatio;
+    m_font.setPointSizeF(size);
+    painter->scale(mag.width(), mag.height());
+    painter->setFont(m_font);
+
     PointF pos(startPos);
     for (SymId id : ids) {
-        draw(id, painter, mag, pos);
+        painter->drawSymbol(PointF(pos.x() / mag.width(), pos.y() / mag.height()), symCode(id));
         pos.setX(pos.x() + advance(id, mag.width()));
     }
+
+    painter->restore();
 }
@@ -86,6 +86,7 @@ public:
     void draw(const SymIdList& ids, draw::Painter* p, double mag, const PointF& pos) const override;
     void draw(const SymIdList& ids, draw::Painter* p, const SizeF& mag, const PointF& pos) const override;
 
+    void ensureRegistered();
     void ensureLoad();
 
 private:
@@ -122,6 +123,7 @@ private:
 
     bool useFallbackFont(SymId id) const;
 
+    bool m_registered = false;
     bool m_loaded = false;
     std::vector<Sym> m_symbols;
     mutable draw::Font m_font;
@@ -99,7 +99,12 @@ bool EngravingFontsProvider::isFallbackFont(const IEngravingFont* f) const
 
 void EngravingFontsProvider::loadAllFonts()
 {
+    //! NOTE Only the font-database registration is needed up front, so that
+    //! text using these families draws correctly. Computing the glyph metrics
+    //! and parsing the SMuFL metadata takes hundreds of milliseconds per font
+    //! and is deferred until a font is first requested (fontByName and
+    //! fallbackFont call ensureLoad)
     for (std::shared_ptr<EngravingFont>& f : m_symbolFonts) {
-        f->ensureLoad();
+        f->ensureRegistered();
     }
 }
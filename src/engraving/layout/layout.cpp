@@ -213,6 +213,12 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
 
     ctx.prevMeasure = 0;
 
+    if (layoutAll) {
+        // compute the measure-local metrics (tremolo connections etc.) across
+        // the worker pool; horizontal spacing and system breaking stay serial
+        LayoutMeasure::preLayoutRange(options, ctx);
+    }
+
     LayoutMeasure::getNextMeasure(options, ctx);
     ctx.curSystem = LayoutSystem::collectSystem(options, ctx, m_score);
 
@@ -232,6 +238,12 @@ void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
             lmb = nullptr;
         }
 
+        if (options.stopAfterEndTick && lmb && lmb->endTick() >= lc.endTick) {
+            // progressive layout: the requested range is on screen now,
+            // the measures behind it will be laid out by a continuation
+            break;
+        }
+
         // we can stop collecting pages when:
         // 1) we reach the end of score (curSystem is nullptr)
         // or
@@ -506,3 +506,54 @@ void LayoutBeams::layoutNonCrossBeams(Segment* s)
         }
     }
 }
+
+/************************************************************
+ * layoutNonCrossBeams() (range batch)
+ * collect all non-cross-staff beams starting in the given
+ * segments into one flat work list and lay them out in a
+ * single tight loop, instead of beam-by-beam inside the
+ * segment walk. Shapes are recreated once afterwards.
+ * **********************************************************/
+
+void LayoutBeams::layoutNonCrossBeams(const std::vector<Segment*>& segments)
+{
+    std::vector<Beam*> worklist;
+    for (Segment* s : segments) {
+        if (!s->isChordRestType()) {
+            continue;
+        }
+        for (EngravingItem* e : s->elist()) {
+            if (!e || !e->isChordRest() || !e->score()->staff(e->staffIdx())->show()) {
+                // the beam and its system may still be referenced when selecting all,
+                // even if the staff is invisible. The old system is invalid and does cause problems in #284012
+                if (e && e->isChordRest() && !e->score()->staff(e->staffIdx())->show() && toChordRest(e)->beam()) {
+                    toChordRest(e)->beam()->resetExplicitParent();
+                }
+                continue;
+            }
+            ChordRest* cr = toChordRest(e);
+            if (isTopBeam(cr)) {
+                worklist.push_back(cr->beam());
+            }
+            if (!cr->isChord()) {
+                continue;
+            }
+            for (Chord* grace : toChord(cr)->graceNotes()) {
+                if (isTopBeam(grace)) {
+                    worklist.push_back(grace->beam());
+                }
+            }
+        }
+    }
+
+    for (Beam* b : worklist) {
+        b->layout();
+    }
+
+    // Must recreate the shapes because stem lengths may have been changed!
+    for (Segment* s : segments) {
+        if (s->isChordRestType()) {
+            s->createShapes();
+        }
+    }
+}
@@ -42,6 +42,7 @@ public:
     static void restoreBeams(Measure* m);
     static void breakCrossMeasureBeams(const LayoutContext& ctx, Measure* measure);
     static void layoutNonCrossBeams(Segment* s);
+    static void layoutNonCrossBeams(const std::vector<Segment*>& segments);
 
 private:
     static void beamGraceNotes(Score* score, Chord* mainNote, bool after);
@@ -743,8 +743,15 @@ static std::pair<double, double> layoutAccidental(const MStyle& style, AcEl* me,
     }
 
     // clear left notes
+    // leftNotes is ordered by ascending line (the early break below already
+    // relies on this), so instead of scanning from the top, sweep from the
+    // first note whose bottom can vertically reach this accidental
     size_t lns = leftNotes.size();
-    for (size_t i = 0; i < lns; ++i) {
+    size_t firstLn = std::lower_bound(leftNotes.begin(), leftNotes.end(), me->top - pnd,
+                                      [sp](const Note* n, double limit) {
+        return (n->line() - 1) * 0.5 * sp + sp < limit;
+    }) - leftNotes.begin();
+    for (size_t i = firstLn; i < lns; ++i) {
         Note* ln = leftNotes[i];
         int lnLine = ln->line();
         double lnTop = (lnLine - 1) * 0.5 * sp;
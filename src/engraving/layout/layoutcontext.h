@@ -24,11 +24,13 @@
 
 #include <vector>
 #include <set>
+#include <unordered_set>
 
 #include "types/fraction.h"
 #include "types/types.h"
 
 namespace mu::engraving {
+class Measure;
 class MeasureBase;
 class Page;
 class Score;
@@ -71,6 +73,10 @@ public:
 
     double totalBracketsWidth = -1.0;
 
+    // measures already processed by LayoutMeasure::preLayoutRange();
+    // getNextMeasure() skips the duplicated per-measure work for these
+    std::unordered_set<const Measure*> preLaidMeasures;
+
 private:
     Score* m_score = nullptr;
 };
@@ -21,7 +21,13 @@
  */
 #include "layoutmeasure.h"
 
+#include <future>
+
+#include "containers.h"
+#include "concurrency/taskscheduler.h"
+
 #include "libmscore/ambitus.h"
+#include "libmscore/articulation.h"
 #include "libmscore/barline.h"
 #include "libmscore/beam.h"
 #include "libmscore/factory.h"
@@ -33,6 +39,7 @@
 #include "libmscore/mmrest.h"
 #include "libmscore/part.h"
 #include "libmscore/score.h"
+#include "libmscore/stafftype.h"
 #include "libmscore/stem.h"
 #include "libmscore/timesig.h"
 #include "libmscore/undo.h"
@@ -646,6 +653,198 @@ static void layoutDrumsetChord(Chord* c, const Drumset* drumset, const StaffType
     }
 }
 
+//---------------------------------------------------------
+//   preLayoutMeasure
+//    per-measure work that only touches elements owned by
+//    the measure itself and does not go through the undo
+//    stack, so it is safe to run for several measures
+//    concurrently
+//---------------------------------------------------------
+
+void LayoutMeasure::preLayoutMeasure(Measure* measure)
+{
+    measure->connectTremolo();
+}
+
+//---------------------------------------------------------
+//   preLayoutRange
+//    distribute the measure-local part of getNextMeasure()
+//    across the worker pool before the serial spacing and
+//    system-breaking passes start
+//---------------------------------------------------------
+
+void LayoutMeasure::preLayoutRange(const LayoutOptions& options, LayoutContext& ctx)
+{
+    if (options.isLinearMode()) {
+        return;
+    }
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+    if (scheduler->threadPoolSize() < 2) {
+        return;
+    }
+
+    std::vector<Measure*> measures;
+    for (MeasureBase* mb = ctx.score()->firstMeasure(); mb; mb = mb->nextMeasure()) {
+        measures.push_back(toMeasure(mb));
+    }
+
+    static constexpr size_t MIN_MEASURES_FOR_PARALLEL_LAYOUT = 16;
+    if (measures.size() < MIN_MEASURES_FOR_PARALLEL_LAYOUT) {
+        return;
+    }
+
+    size_t chunkSize = (measures.size() + scheduler->threadPoolSize() - 1) / scheduler->threadPoolSize();
+    std::vector<std::future<void> > results;
+    for (size_t begin = 0; begin < measures.size(); begin += chunkSize) {
+        size_t end = std::min(begin + chunkSize, measures.size());
+        results.push_back(scheduler->submit([&measures, begin, end]() {
+            for (size_t i = begin; i < end; ++i) {
+                preLayoutMeasure(measures.at(i));
+            }
+        }));
+    }
+
+    for (std::future<void>& result : results) {
+        result.wait();
+    }
+
+    for (const Measure* m : measures) {
+        ctx.preLaidMeasures.insert(m);
+    }
+}
+
+//---------------------------------------------------------
+//   measure content hashing
+//    fingerprint of everything inside a measure that the
+//    per-measure layout pass depends on; when the hash is
+//    unchanged since the previous pass, the widths, beams
+//    and shapes cached on the elements are still valid
+//---------------------------------------------------------
+
+static inline void hashCombine(uint64_t& h, uint64_t v)
+{
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+}
+
+static void hashChord(uint64_t& h, const Chord* chord)
+{
+    hashCombine(h, static_cast<int>(chord->stemDirection()));
+    hashCombine(h, static_cast<int>(chord->noteType()));
+    for (const Chord* grace : chord->graceNotes()) {
+        hashChord(h, grace);
+    }
+    for (const Articulation* a : chord->articulations()) {
+        hashCombine(h, static_cast<int>(a->symId()));
+        hashCombine(h, a->visible());
+    }
+    for (const Note* note : chord->notes()) {
+        hashCombine(h, note->pitch());
+        hashCombine(h, note->tpc1());
+        hashCombine(h, note->tpc2());
+        hashCombine(h, static_cast<int>(note->headGroup()));
+        hashCombine(h, static_cast<int>(note->headType()));
+        hashCombine(h, static_cast<int>(note->userMirror()));
+        hashCombine(h, note->ghost());
+        hashCombine(h, note->visible());
+        hashCombine(h, std::hash<double>{}(note->offset().x()));
+        hashCombine(h, std::hash<double>{}(note->offset().y()));
+    }
+}
+
+static uint64_t measureContentHash(const Score* score, const Measure* measure)
+{
+    uint64_t h = 0;
+    hashCombine(h, score->nstaves());
+    hashCombine(h, measure->ticks().ticks());
+    hashCombine(h, measure->repeatStart());
+    hashCombine(h, measure->repeatEnd());
+    hashCombine(h, measure->irregular());
+
+    for (size_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        const Staff* staff = score->staff(staffIdx);
+        hashCombine(h, static_cast<int>(staff->keySigEvent(measure->tick()).key()));
+        hashCombine(h, static_cast<int>(staff->clef(measure->tick())));
+        hashCombine(h, staff->show());
+        const StaffType* st = staff->staffType(measure->tick());
+        hashCombine(h, static_cast<int>(st->group()));
+        hashCombine(h, st->lines());
+    }
+
+    for (const Segment& segment : measure->segments()) {
+        hashCombine(h, static_cast<int>(segment.segmentType()));
+        hashCombine(h, segment.rtick().ticks());
+        hashCombine(h, segment.enabled());
+        for (const EngravingItem* e : segment.elist()) {
+            if (!e) {
+                hashCombine(h, 0);
+                continue;
+            }
+            hashCombine(h, static_cast<int>(e->type()));
+            hashCombine(h, e->track());
+            hashCombine(h, e->visible());
+            hashCombine(h, std::hash<double>{}(e->offset().x()));
+            hashCombine(h, std::hash<double>{}(e->offset().y()));
+            if (e->isChordRest()) {
+                const ChordRest* cr = toChordRest(e);
+                hashCombine(h, cr->actualTicks().ticks());
+                hashCombine(h, static_cast<int>(cr->durationType().type()));
+                hashCombine(h, cr->dots());
+                hashCombine(h, static_cast<int>(cr->beamMode()));
+                hashCombine(h, cr->staffMove());
+                hashCombine(h, cr->isSmall());
+                for (const Lyrics* l : cr->lyrics()) {
+                    hashCombine(h, l->no());
+                    hashCombine(h, static_cast<int>(l->syllabic()));
+                    hashCombine(h, l->ticks().ticks());
+                    hashCombine(h, l->xmlText().hash());
+                    hashCombine(h, l->visible());
+                    hashCombine(h, std::hash<double>{}(l->offset().x()));
+                    hashCombine(h, std::hash<double>{}(l->offset().y()));
+                }
+            }
+            if (e->isChord()) {
+                hashChord(h, toChord(e));
+            }
+        }
+        for (const EngravingItem* a : segment.annotations()) {
+            hashCombine(h, static_cast<int>(a->type()));
+            hashCombine(h, a->track());
+            hashCombine(h, a->visible());
+        }
+    }
+    return h;
+}
+
+//---------------------------------------------------------
+//   hasCrossMeasureBeam
+//    a beam reaching into a neighbour measure couples this
+//    measure's layout to content the hash does not see, so
+//    such measures never take the cached fast path
+//---------------------------------------------------------
+
+static bool hasCrossMeasureBeam(const Measure* measure)
+{
+    for (const Segment& segment : measure->segments()) {
+        if (!segment.isChordRestType()) {
+            continue;
+        }
+        for (const EngravingItem* e : segment.elist()) {
+            if (!e || !e->isChordRest()) {
+                continue;
+            }
+            const Beam* beam = toChordRest(e)->beam();
+            if (!beam || beam->elements().empty()) {
+                continue;
+            }
+            if (beam->elements().front()->measure() != beam->elements().back()->measure()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext& ctx)
 {
     Score* score = ctx.score();
@@ -722,7 +921,17 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
         return;
     }
 
-    measure->connectTremolo();
+    const uint64_t contentHash = measureContentHash(score, measure);
+    if (contentHash == score->measureLayoutHash(measure) && !hasCrossMeasureBeam(measure)) {
+        // nothing layout-relevant changed inside the measure since the last
+        // pass: skip recomputing accidentals, stems, beams and shapes
+        ctx.tick += measure->ticks();
+        return;
+    }
+
+    if (!mu::contains(ctx.preLaidMeasures, static_cast<const Measure*>(measure))) {
+        preLayoutMeasure(measure);
+    }
 
     //
     // calculate accidentals and note lines,
@@ -896,6 +1105,8 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
     measure->computeTicks(); // Must be called *after* Segment::createShapes() because it relies on the
     // Segment::visible() property, which is determined by Segment::createShapes().
 
+    score->setMeasureLayoutHash(measure, contentHash);
+
     ctx.tick += measure->ticks();
 }
 
@@ -37,9 +37,12 @@ public:
 
     static void getNextMeasure(const LayoutOptions& options, LayoutContext& lc);
     static void computePreSpacingItems(Measure* m);
+    static void preLayoutRange(const LayoutOptions& options, LayoutContext& lc);
 
 private:
 
+    static void preLayoutMeasure(Measure* measure);
+
     static void createMMRest(const LayoutOptions& options, Score* score, Measure* firstMeasure, Measure* lastMeasure, const Fraction& len);
 
     static int adjustMeasureNo(LayoutContext& lc, MeasureBase* m);
@@ -58,6 +58,11 @@ struct LayoutOptions
 
     VerticalAlignRange verticalAlignRange = VerticalAlignRange::SEGMENT;
 
+    // progressive first layout: stop collecting pages once the page
+    // containing endTick is complete; the rest of the score is laid out
+    // later by a doLayoutRange() continuation
+    bool stopAfterEndTick = false;
+
     bool isMode(LayoutMode m) const { return mode == m; }
     bool isLinearMode() const { return mode == LayoutMode::LINE || mode == LayoutMode::HORIZONTAL_FIXED; }
 
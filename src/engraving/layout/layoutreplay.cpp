@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutreplay.h"
+
+#include <atomic>
+#include <cstdlib>
+
+#include "io/file.h"
+
+#include "libmscore/measure.h"
+#include "libmscore/part.h"
+#include "libmscore/score.h"
+#include "libmscore/staff.h"
+#include "rw/staffrw.h"
+#include "rw/xmlwriter.h"
+
+#include "layoutoptions.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static constexpr const char* REPLAY_DIR_ENV = "MUSESCORE_LAYOUT_REPLAY_DIR";
+static constexpr const char* REPLAY_THRESHOLD_ENV = "MUSESCORE_LAYOUT_REPLAY_THRESHOLD_MS";
+static constexpr int64_t DEFAULT_THRESHOLD_MS = 500;
+
+static const char* replayDir()
+{
+    static const char* dir = std::getenv(REPLAY_DIR_ENV);
+    return dir;
+}
+
+static int64_t thresholdMs()
+{
+    static const int64_t threshold = []() {
+        const char* value = std::getenv(REPLAY_THRESHOLD_ENV);
+        return value ? std::strtoll(value, nullptr, 10) : DEFAULT_THRESHOLD_MS;
+    }();
+    return threshold;
+}
+
+bool LayoutReplay::enabled()
+{
+    return replayDir() != nullptr;
+}
+
+void LayoutReplay::capture(Score* score, const LayoutOptions& options, const Fraction& st, const Fraction& et, int64_t elapsedMs)
+{
+    if (!enabled() || elapsedMs < thresholdMs()) {
+        return;
+    }
+
+    static std::atomic_int captureNumber { 0 };
+    String path = String(u"%1/layout_replay_%2.xml").arg(String::fromUtf8(replayDir())).arg(++captureNumber);
+
+    io::File file(path);
+    if (!file.open(io::IODevice::WriteOnly)) {
+        LOGE() << "failed to open layout replay file: " << path;
+        return;
+    }
+
+    // the range is laid out measure-wise, so the extract covers whole
+    // measures around [st, et)
+    MeasureBase* measureStart = st > Fraction(0, 1) ? score->tick2measure(st) : score->first();
+    MeasureBase* measureEnd = nullptr;
+    if (et >= Fraction(0, 1)) {
+        Measure* lastMeasure = score->tick2measure(et);
+        measureEnd = lastMeasure ? lastMeasure->next() : nullptr;
+    }
+
+    XmlWriter xml(&file);
+    xml.startDocument();
+    xml.startElement("museScore", { { "version", MSC_VERSION } });
+    xml.startElement("LayoutReplay", { { "startTick", st.toString() }, { "endTick", et.toString() }, { "elapsedMs", elapsedMs } });
+
+    xml.startElement("Options");
+    xml.tag("mode", int(options.mode));
+    xml.tag("showVBox", options.showVBox);
+    xml.tag("stopAfterEndTick", options.stopAfterEndTick);
+    xml.endElement();
+
+    // only the deltas from the built-in defaults; the replay applies them
+    // on top of DefaultStyle
+    score->style().save(xml, true);
+
+    xml.startElement("Extract");
+    for (const Part* part : score->parts()) {
+        part->write(xml);
+    }
+    xml.context()->setCurTrack(0);
+    if (measureStart) {
+        for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+            rw::StaffRW::writeStaff(score->staff(staffIdx), xml, measureStart, measureEnd, 0, staffIdx, false);
+        }
+    }
+    xml.endElement(); // Extract
+
+    xml.endElement(); // LayoutReplay
+    xml.endElement(); // museScore
+
+    LOGI() << "layout replay captured: " << path << " (" << elapsedMs << " ms)";
+}
@@ -0,0 +1,54 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_LAYOUTREPLAY_H
+#define MU_ENGRAVING_LAYOUTREPLAY_H
+
+#include <cstdint>
+
+#include "types/fraction.h"
+
+namespace mu::engraving {
+class Score;
+struct LayoutOptions;
+
+//---------------------------------------------------------
+//   LayoutReplay
+//    capture mode for slow-layout bug reports: when
+//    MUSESCORE_LAYOUT_REPLAY_DIR is set, every
+//    doLayoutRange() call slower than
+//    MUSESCORE_LAYOUT_REPLAY_THRESHOLD_MS (default 500) is
+//    written out as an XML capture holding the layout
+//    options, the style deltas from the built-in defaults
+//    and a measure-range extract of the laid out ticks —
+//    enough to replay the slow call offline without asking
+//    the user for the full score.
+//---------------------------------------------------------
+
+class LayoutReplay
+{
+public:
+    static bool enabled();
+    static void capture(Score* score, const LayoutOptions& options, const Fraction& st, const Fraction& et, int64_t elapsedMs);
+};
+}
+
+#endif // MU_ENGRAVING_LAYOUTREPLAY_H
@@ -102,6 +102,9 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     Fraction prevMaxTicks = Fraction(1, 1);
     bool maxSysTicksChanged = false;
     static constexpr double squeezability = 0.3; // We may consider exposing in Style settings (M.S.)
+    // Tolerance band for keeping the previous layout's break decisions past the
+    // edited range (see below, where doBreak is computed)
+    const double breakDecisionTolerance = 0.1 * score->spatium();
     double oldStretch = 1.0;
     double oldWidth = 0.0;
     System* oldSystem = nullptr;
@@ -204,6 +207,19 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
         /* acceptanceRange allows some systems to be initially slightly larger than the margins and be
          * justified by squeezing instead of stretching. Allows to make much better choices of how many
          * measures to fit per system. */
+        if (ctx.systemOldMeasure && ctx.prevMeasure && system->measures().size() > 1
+            && ctx.endTick < ctx.curMeasure->tick()) {
+            // Past the edited range the previous layout's break decisions are the best
+            // prediction we have. When the packing sum lands within tolerance of the
+            // boundary the fresh decision is low-confidence - sub-pixel width drift
+            // could flip it either way - so keep the old decision. Without this, a
+            // marginal flip here cascades a speculative reflow of every following
+            // system before the rangeDone convergence check can stop the layout.
+            double margin = (curSysWidth + ww) - (targetSystemWidth + acceptanceRange);
+            if (std::abs(margin) < breakDecisionTolerance) {
+                doBreak = (ctx.prevMeasure == ctx.systemOldMeasure);
+            }
+        }
         if (doBreak) {
             breakMeasure = ctx.curMeasure;
             system->removeLastMeasure();
@@ -705,14 +721,7 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
     //  may change.
     //-------------------------------------------------------------
 
-    for (Segment* s : sl) {
-        if (!s->isChordRestType()) {
-            continue;
-        }
-        LayoutBeams::layoutNonCrossBeams(s);
-        // Must recreate the shapes because stem lengths may have been changed!
-        s->createShapes();
-    }
+    LayoutBeams::layoutNonCrossBeams(sl);
 
     //-------------------------------------------------------------
     //    create skylines
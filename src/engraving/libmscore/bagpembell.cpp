@@ -52,22 +52,39 @@ BagpipeNoteInfo BagpipeEmbellishment::BagpipeNoteInfoList[] = {
 
 noteList BagpipeEmbellishment::getNoteList() const
 {
-    noteList nl;
-
-    StringList notes = TConv::embellishmentNotes(_embelType);
-    int noteInfoSize = sizeof(BagpipeNoteInfoList) / sizeof(*BagpipeNoteInfoList);
-    for (const String& note : notes) {
-        // search for note in BagpipeNoteInfoList
-        for (int i = 0; i < noteInfoSize; ++i) {
-            if (String::fromAscii(BagpipeNoteInfoList[i].name.ascii()) == note) {
-                // found it, append to list
-                nl.push_back(i);
-                break;
+    // the embellishment definitions are static data, but decoding them means
+    // splitting the note string and comparing names; pipe band scores lay out
+    // the same few shapes thousands of times, so decode every type once into
+    // a table and serve lookups from it. The lambda runs under the magic-static
+    // guard, so concurrent first calls (e.g. from parallel layout) all see the
+    // fully built table.
+    static const std::vector<noteList> decoded = []() {
+        std::vector<noteList> table;
+        size_t count = TConv::embellishmentsCount();
+        table.resize(count);
+        int noteInfoSize = sizeof(BagpipeNoteInfoList) / sizeof(*BagpipeNoteInfoList);
+        for (size_t type = 0; type < count; ++type) {
+            StringList notes = TConv::embellishmentNotes(EmbellishmentType(type));
+            for (const String& note : notes) {
+                // search for note in BagpipeNoteInfoList
+                for (int i = 0; i < noteInfoSize; ++i) {
+                    if (String::fromAscii(BagpipeNoteInfoList[i].name.ascii()) == note) {
+                        // found it, append to list
+                        table[type].push_back(i);
+                        break;
+                    }
+                }
             }
         }
+        return table;
+    }();
+
+    size_t idx = static_cast<size_t>(_embelType);
+    if (idx >= decoded.size()) {
+        return noteList();
     }
 
-    return nl;
+    return decoded[idx];
 }
 
 //---------------------------------------------------------
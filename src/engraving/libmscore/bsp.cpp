@@ -144,6 +144,85 @@ void BspTree::remove(EngravingItem* element)
     climbTree(&removeVisitor, element->pageBoundingRect());
 }
 
+//---------------------------------------------------------
+//   bulkInsert
+//    distribute the items over the subtree at index by
+//    top-down partitioning; consumes the input list
+//---------------------------------------------------------
+
+void BspTree::bulkInsert(std::vector<std::pair<RectF, EngravingItem*> >& items, int index)
+{
+    if (nodes.empty() || items.empty()) {
+        return;
+    }
+
+    Node* node = &nodes[index];
+    int childIndex = firstChildIndex(index);
+
+    switch (node->type) {
+    case Node::Type::LEAF: {
+        std::list<EngravingItem*>& leaf = leaves[node->leafIndex];
+        for (const auto& i : items) {
+            leaf.push_front(i.second);
+        }
+        break;
+    }
+    case Node::Type::VERTICAL: {
+        std::vector<std::pair<RectF, EngravingItem*> > first, second;
+        for (const auto& i : items) {
+            if (i.first.left() < node->offset) {
+                first.push_back(i);
+                if (i.first.right() >= node->offset) {
+                    second.push_back(i);
+                }
+            } else {
+                second.push_back(i);
+            }
+        }
+        items.clear();
+        bulkInsert(first, childIndex);
+        bulkInsert(second, childIndex + 1);
+        break;
+    }
+    case Node::Type::HORIZONTAL: {
+        std::vector<std::pair<RectF, EngravingItem*> > first, second;
+        for (const auto& i : items) {
+            if (i.first.top() < node->offset) {
+                first.push_back(i);
+                if (i.first.bottom() >= node->offset) {
+                    second.push_back(i);
+                }
+            } else {
+                second.push_back(i);
+            }
+        }
+        items.clear();
+        bulkInsert(first, childIndex);
+        bulkInsert(second, childIndex + 1);
+        break;
+    }
+    }
+}
+
+//---------------------------------------------------------
+//   rebuild
+//    bulk-build path: the bounding rect of every item is
+//    computed once and all items descend the tree together,
+//    instead of one climbTree() pass per item
+//---------------------------------------------------------
+
+void BspTree::rebuild(const RectF& rec, const std::vector<EngravingItem*>& items)
+{
+    initialize(rec, int(items.size()));
+
+    std::vector<std::pair<RectF, EngravingItem*> > itemRects;
+    itemRects.reserve(items.size());
+    for (EngravingItem* item : items) {
+        itemRects.emplace_back(item->pageBoundingRect(), item);
+    }
+    bulkInsert(itemRects, 0);
+}
+
 //---------------------------------------------------------
 //   items
 //---------------------------------------------------------
@@ -24,6 +24,8 @@
 #define __BSP_H__
 
 #include <list>
+#include <utility>
+#include <vector>
 
 #include "global/allocator.h"
 #include "types/string.h"
@@ -65,6 +67,8 @@ private:
     void findItems(std::list<EngravingItem*>* foundItems, const mu::PointF& pos, int index);
     mu::RectF rectForIndex(int index) const;
 
+    void bulkInsert(std::vector<std::pair<mu::RectF, EngravingItem*> >& items, int index);
+
     std::vector<Node> nodes;
     std::vector<std::list<EngravingItem*> > leaves;
     int leafCnt;
@@ -78,6 +82,7 @@ public:
 
     void insert(EngravingItem* item);
     void remove(EngravingItem* item);
+    void rebuild(const mu::RectF& rect, const std::vector<EngravingItem*>& items);
 
     std::vector<EngravingItem*> items(const mu::RectF& rect);
     std::vector<EngravingItem*> items(const mu::PointF& pos);
@@ -27,6 +27,7 @@
 
 #include "changeMap.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cassert>
 
@@ -141,34 +142,38 @@ int ChangeMap::val(Fraction tick)
         cleanup();
     }
 
-    auto eventIter = upper_bound(tick);
-    if (eventIter == begin()) {
+    if (queryTable.empty() || tick < queryTable.front().tick) {
         return DEFAULT_VALUE;
     }
 
-    eventIter--;
-    bool foundRamp = false;
-    ChangeEvent& rampFound = eventIter->second;         // only used to init
-    Fraction rampFoundStartTick = eventIter->first;
-    auto values = this->equal_range(rampFoundStartTick);
-    for (auto it = values.first; it != values.second; ++it) {
-        auto& event = it->second;
-        if (event.type == ChangeEventType::RAMP) {
-            foundRamp = true;
-            rampFound = event;
+    // The playback model asks for values in ascending tick order, so first
+    // try to resume from the entry the previous query ended on
+    size_t idx = queryTable.size();
+    if (queryCursor < queryTable.size() && !(tick < queryTable[queryCursor].tick)) {
+        if (queryCursor + 1 == queryTable.size() || tick < queryTable[queryCursor + 1].tick) {
+            idx = queryCursor;
+        } else if (queryCursor + 2 == queryTable.size() || tick < queryTable[queryCursor + 2].tick) {
+            idx = queryCursor + 1;
         }
     }
+    if (idx == queryTable.size()) {
+        auto it = std::upper_bound(queryTable.begin(), queryTable.end(), tick,
+                                   [](const Fraction& t, const QueryEntry& e) { return t < e.tick; });
+        idx = static_cast<size_t>(it - queryTable.begin()) - 1;
+    }
+    queryCursor = idx;
 
-    if (!foundRamp) {
-        // Last event must be a fix, since there are max two events at one tick
-        return eventIter->second.value;
+    QueryEntry& entry = queryTable[idx];
+    ChangeEvent& event = entry.event;
+    if (event.type != ChangeEventType::RAMP) {
+        return event.value;
     }
 
-    if (tick >= (rampFoundStartTick + rampFound.length)) {
-        return rampFound.cachedEndVal;
+    if (tick >= (entry.tick + event.length)) {
+        return event.cachedEndVal;
     } else {
         // Do some maths!
-        return interpolate(rampFoundStartTick, rampFound, tick);        // NOTE:JT check should rampFound be eventIter.value()
+        return interpolate(entry.tick, event, tick);
     }
 }
 
@@ -434,6 +439,45 @@ void ChangeMap::cleanupStage3()
     }
 }
 
+//---------------------------------------------------------
+//   cleanupStage4
+///   compile the flat query table
+//---------------------------------------------------------
+
+void ChangeMap::cleanupStage4()
+{
+    queryTable.clear();
+    queryCursor = 0;
+
+    for (auto i = begin(); i != end();) {
+        const Fraction tick = i->first;
+        ChangeEvent entryEvent = i->second;
+        bool foundRamp = false;
+        for (; i != end() && i->first == tick; ++i) {
+            auto& event = i->second;
+            if (event.type == ChangeEventType::RAMP) {
+                entryEvent = event;
+                foundRamp = true;
+            } else if (!foundRamp) {
+                entryEvent = event;
+            }
+        }
+        queryTable.push_back({ tick, entryEvent });
+    }
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void ChangeMap::clear()
+{
+    std::multimap<Fraction, ChangeEvent>::clear();
+    queryTable.clear();
+    queryCursor = 0;
+    cleanedUp = false;
+}
+
 //---------------------------------------------------------
 //   cleanup
 //---------------------------------------------------------
@@ -450,6 +494,7 @@ void ChangeMap::cleanup()
     cleanupStage0();
     cleanupStage1();
     cleanupStage3();
+    cleanupStage4();
     cleanedUp = true;
 
     // LOGD() << "After cleanup:";
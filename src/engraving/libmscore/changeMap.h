@@ -24,6 +24,7 @@
 #define __CHANGEMAP_H__
 
 #include <map>
+#include <vector>
 
 #include "global/allocator.h"
 #include "types/types.h"
@@ -85,12 +86,23 @@ class ChangeMap : public std::multimap<Fraction, ChangeEvent>
         const char* name;
     };
 
+    ///   flat table compiled by cleanup(): one entry per tick, with a ramp
+    ///   taking precedence over a fix at the same tick, so queries need no
+    ///   equal_range scans; the cursor makes ascending queries O(1)
+    struct QueryEntry {
+        Fraction tick;
+        ChangeEvent event;
+    };
+    std::vector<QueryEntry> queryTable;
+    size_t queryCursor   { 0 };
+
     static bool compareRampEvents(ChangeEvent& a, ChangeEvent& b) { return a.length > b.length; }
 
     void cleanupStage0();
     void cleanupStage1();
     void cleanupStage2(std::vector<bool>& startsInRamp, EndPointsVector& endPoints);
     void cleanupStage3();
+    void cleanupStage4();
 
 public:
     ChangeMap() {}
@@ -99,6 +111,7 @@ public:
 
     void addFixed(Fraction tick, int value);
     void addRamp(Fraction stick, Fraction etick, int change, ChangeMethod method, ChangeDirection direction);
+    void clear();
     void cleanup();
 
     static int interpolate(Fraction& eventTick, ChangeEvent& event, Fraction& tick);
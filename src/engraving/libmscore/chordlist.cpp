@@ -1754,6 +1754,7 @@ void ChordList::read(XmlReader& e)
             cd.complete(0, this);
             // add to list
             insert({ id, cd });
+            _indexDirty = true;
         } else if (tag == "renderRoot") {
             readRenderList(e.readText(), renderListRoot);
         } else if (tag == "renderFunction") {
@@ -1924,6 +1925,7 @@ void ChordList::unload()
     renderListBase.clear();
     chordTokenList.clear();
     _autoAdjust = false;
+    _indexDirty = true;
 }
 
 const ChordDescription* ChordList::description(int id) const
@@ -1935,6 +1937,60 @@ const ChordDescription* ChordList::description(int id) const
     return &it->second;
 }
 
+//---------------------------------------------------------
+//   description
+//    look up description by name,
+//    optionally by parsed chord as fallback
+//---------------------------------------------------------
+
+const ChordDescription* ChordList::description(const String& name, const ParsedChord* pc) const
+{
+    if (_indexDirty || _indexedCount != size()) {
+        buildIndex();
+    }
+    auto i = _nameIndex.find(name);
+    if (i != _nameIndex.end()) {
+        return description(i->second);
+    }
+    if (pc) {
+        auto j = _parsedIndex.find(pc->handle());
+        if (j != _parsedIndex.end()) {
+            return description(j->second);
+        }
+    }
+    return nullptr;
+}
+
+//---------------------------------------------------------
+//   buildIndex
+//    compile the description list into hash tables keyed
+//    by name and by parsed-chord handle, so that lookups
+//    need not scan every description
+//---------------------------------------------------------
+
+void ChordList::buildIndex() const
+{
+    _nameIndex.clear();
+    _parsedIndex.clear();
+    for (const auto& p : *this) {
+        const ChordDescription& cd = p.second;
+        for (const String& s : cd.names) {
+            // on a name collision the lowest id wins, as in a scan
+            _nameIndex.insert({ s, cd.id });
+        }
+        if (cd.names.empty()) {
+            // a scan never reaches the parsed forms of a nameless description
+            continue;
+        }
+        for (const ParsedChord& pc : cd.parsedChords) {
+            // on a parsed-form collision the highest id wins, as in a scan
+            _parsedIndex[pc.handle()] = cd.id;
+        }
+    }
+    _indexedCount = size();
+    _indexDirty = false;
+}
+
 void ChordList::checkChordList(const MStyle& style)
 {
     // make sure we have a chordlist
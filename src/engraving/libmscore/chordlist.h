@@ -24,6 +24,7 @@
 #define __CHORDLIST_H__
 
 #include <map>
+#include <unordered_map>
 
 #include "global/allocator.h"
 #include "types/string.h"
@@ -271,6 +272,15 @@ class ChordList : public std::map<int, ChordDescription>
     INJECT(engraving, IEngravingConfiguration, configuration)
 
     std::map<String, ChordSymbol> symbols;
+
+    // hash indexes over the description names and parsed-chord handles,
+    // compiled on first lookup and recompiled after the list changes;
+    // lookups by name used to scan every description
+    mutable std::unordered_map<String, int> _nameIndex;
+    mutable std::unordered_map<String, int> _parsedIndex;
+    mutable size_t _indexedCount = 0;
+    mutable bool _indexDirty = true;
+
     bool _autoAdjust = false;
     double _nmag = 1.0, _nadjust = 0.0;
     double _emag = 1.0, _eadjust = 0.0;
@@ -300,6 +310,7 @@ public:
     void unload();
 
     const ChordDescription* description(int id) const;
+    const ChordDescription* description(const String& name, const ParsedChord* pc) const;
     ChordSymbol symbol(const String& s) const { return mu::value(symbols, s); }
 
     void setCustomChordList(bool t) { _customChordList = t; }
@@ -313,6 +324,8 @@ private:
 
     void read(XmlReader&);
     void write(XmlWriter& xml) const;
+
+    void buildIndex() const;
 };
 } // namespace mu::engraving
 #endif
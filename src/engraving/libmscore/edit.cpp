@@ -1545,6 +1545,7 @@ ChordRest* Score::searchNote(const Fraction& tick, track_idx_t track) const
 void Score::regroupNotesAndRests(const Fraction& startTick, const Fraction& endTick, track_idx_t track)
 {
     Segment* inputSegment = _is.segment();   // store this so we can get back to it later.
+    bool tiesChanged = false;   // defer tie reconnection to a single ranged pass at the end
     Segment* seg = tick2segment(startTick, true, SegmentType::ChordRest);
     for (Measure* msr = seg->measure(); msr && msr->tick() < endTick; msr = msr->nextMeasure()) {
         Fraction maxTick = endTick > msr->endTick() ? msr->endTick() : endTick;
@@ -1727,12 +1728,18 @@ void Score::regroupNotesAndRests(const Fraction& startTick, const Fraction& endT
                         }
                     }
                     if (tie) {         // at least one tie was created
-                        connectTies();
+                        tiesChanged = true;
                     }
                 }
             }
         }
     }
+    if (tiesChanged) {
+        // all ties created above carry both endpoints; what needs fixing up are their
+        // clones in linked staves, and one ranged pass over the rewritten region covers
+        // every group at once (doing this per group used to rescan the whole score)
+        connectTies(startTick, endTick);
+    }
     // now put the input state back where it was before
     _is.setSegment(inputSegment);
 }
@@ -4562,6 +4569,56 @@ void Score::undoChangeStyleVal(Sid idx, const PropertyValue& v)
     undo(new ChangeStyleVal(this, idx, v));
 }
 
+//---------------------------------------------------------
+//   undoChangeProperties
+//    batched variant of EngravingObject::undoChangeProperty
+//    for applying the same change to a large selection: the
+//    simple cases are recorded as one ChangeProperties node
+//    instead of one command per element
+//---------------------------------------------------------
+
+void Score::undoChangeProperties(const std::vector<EngravingObject*>& elements, Pid id, const PropertyValue& v, PropertyFlags ps)
+{
+    //! NOTE Several element types hook extra behaviour into specific property
+    //! ids (BarLine::BARLINE_TYPE, Chord::VISIBLE, Lyrics::VERSE, ...), and
+    //! linked elements need a command per link. Those go through the
+    //! per-element path; everything else is batched.
+    static const std::set<Pid> complexPids {
+        Pid::PLACEMENT, Pid::HAIRPIN_TYPE, Pid::TEXT_STYLE, Pid::OFFSET, Pid::AUTOPLACE,
+        Pid::VISIBLE, Pid::VERSE, Pid::OTTAVA_TYPE, Pid::NUMBERS_ONLY, Pid::BARLINE_TYPE,
+        Pid::GENERATED
+    };
+
+    const bool complex = propertyLink(id) || complexPids.find(id) != complexPids.end();
+
+    std::vector<EngravingObject*> batched;
+    std::vector<EngravingObject*> generated;
+
+    for (EngravingObject* e : elements) {
+        if (!e) {
+            continue;
+        }
+        if (complex || e->isBracketItem()) {
+            e->undoChangeProperty(id, v, ps);
+            continue;
+        }
+        if (e->getProperty(id) == v && e->propertyFlags(id) == ps) {
+            continue;
+        }
+        batched.push_back(e);
+        if (e->getProperty(Pid::GENERATED).toBool()) {
+            generated.push_back(e);
+        }
+    }
+
+    if (!batched.empty()) {
+        undo(new ChangeProperties(batched, id, v, ps));
+    }
+    if (!generated.empty()) {
+        undo(new ChangeProperties(generated, Pid::GENERATED, false, PropertyFlags::NOSTYLE));
+    }
+}
+
 //---------------------------------------------------------
 //   undoChangePageNumberOffset
 //---------------------------------------------------------
@@ -183,10 +183,25 @@ void EngravingItem::notifyAboutNameChanged()
         return;
     }
 
-    if (m_accessible) {
-        doInitAccessible();
-        m_accessible->accessibleRoot()->notifyAboutFocusedElementNameChanged();
+    if (!m_accessible) {
+        return;
     }
+
+    doInitAccessible();
+
+    AccessibleRoot* root = m_accessible->accessibleRoot();
+    if (!root) {
+        return;
+    }
+
+    //! NOTE only the focused element's name is voiced; without this check
+    //! a batch mutation of a range selection (e.g. transpose) re-announced
+    //! the focused element once per renamed note
+    if (root->focusedElement().lock() != m_accessible) {
+        return;
+    }
+
+    root->notifyAboutFocusedElementNameChanged();
 }
 
 #endif
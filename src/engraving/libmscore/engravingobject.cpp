@@ -388,9 +388,23 @@ static void changeProperty(EngravingObject* e, Pid t, const PropertyValue& st, P
 
 static void changeProperties(EngravingObject* e, Pid t, const PropertyValue& st, PropertyFlags ps)
 {
-    if (propertyLink(t)) {
-        for (EngravingObject* ee : e->linkList()) {
-            changeProperty(ee, t, st, ps);
+    if (propertyLink(t) && e->links()) {
+        //! NOTE record the propagation to all linked clones as one bulk
+        //! command instead of one command per clone; with many parts the
+        //! per-clone commands dominated the cost of every linked edit
+        std::vector<EngravingObject*> changed;
+        changed.reserve(e->links()->size());
+        for (EngravingObject* ee : *e->links()) {
+            if (ee->isBracketItem()) {
+                changeProperty(ee, t, st, ps);
+            } else if (ee->getProperty(t) != st || ee->propertyFlags(t) != ps) {
+                changed.push_back(ee);
+            }
+        }
+        if (changed.size() == 1) {
+            changeProperty(changed.front(), t, st, ps);
+        } else if (!changed.empty()) {
+            e->score()->undo(new ChangeProperties(changed, t, st, ps));
         }
     } else {
         changeProperty(e, t, st, ps);
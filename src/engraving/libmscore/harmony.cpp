@@ -1276,25 +1276,10 @@ const ChordDescription* Harmony::descr() const
 const ChordDescription* Harmony::descr(const String& name, const ParsedChord* pc) const
 {
     const ChordList* cl = score()->chordList();
-    const ChordDescription* match = 0;
-    if (cl) {
-        for (const auto& p : *cl) {
-            const ChordDescription& cd = p.second;
-            for (const String& s : cd.names) {
-                if (s == name) {
-                    return &cd;
-                } else if (pc) {
-                    for (const ParsedChord& sParsed : cd.parsedChords) {
-                        if (sParsed == *pc) {
-                            match = &cd;
-                        }
-                    }
-                }
-            }
-        }
+    if (!cl) {
+        return nullptr;
     }
-    // exact match failed, so fall back on parsed match if one was found
-    return match;
+    return cl->description(name, pc);
 }
 
 //---------------------------------------------------------
@@ -72,7 +72,6 @@ Image::Image(const Image& img)
     : BSymbol(img)
 {
     imageType        = img.imageType;
-    buffer           = img.buffer;
     _size            = img._size;
     _lockAspectRatio = img._lockAspectRatio;
     _autoScale       = img._autoScale;
@@ -174,14 +173,38 @@ void Image::draw(mu::draw::Painter* painter) const
                 Size ss = Size(s.width() * t.m11(), s.height() * t.m22());
                 t.setMatrix(1.0, t.m12(), t.m13(), t.m21(), 1.0, t.m23(), t.m31(), t.m32(), t.m33());
                 painter->setWorldTransform(t);
-                if ((buffer.size() != ss || _dirty) && rasterDoc && !rasterDoc->isNull()) {
-                    buffer = imageProvider()->scaled(*rasterDoc, ss);
+
+                if (_dirty) {
+                    _scaledCache.clear();
                     _dirty = false;
                 }
-                if (buffer.isNull()) {
+
+                //! NOTE keep a scaled buffer per zoom level (small LRU), so
+                //! switching back to a recent zoom redraws from the cache
+                //! instead of rescaling the source again
+                static constexpr size_t MAX_SCALED_BUFFERS = 4;
+
+                const Pixmap* scaled = nullptr;
+                for (auto it = _scaledCache.begin(); it != _scaledCache.end(); ++it) {
+                    if (it->first == ss) {
+                        _scaledCache.splice(_scaledCache.begin(), _scaledCache, it);
+                        scaled = &_scaledCache.front().second;
+                        break;
+                    }
+                }
+
+                if (!scaled && rasterDoc && !rasterDoc->isNull()) {
+                    _scaledCache.emplace_front(ss, imageProvider()->scaled(*rasterDoc, ss));
+                    while (_scaledCache.size() > MAX_SCALED_BUFFERS) {
+                        _scaledCache.pop_back();
+                    }
+                    scaled = &_scaledCache.front().second;
+                }
+
+                if (!scaled || scaled->isNull()) {
                     emptyImage = true;
                 } else {
-                    painter->drawPixmap(PointF(0.0, 0.0), buffer);
+                    painter->drawPixmap(PointF(0.0, 0.0), *scaled);
                 }
             }
             painter->restore();
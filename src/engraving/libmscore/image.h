@@ -23,6 +23,8 @@
 #ifndef __IMAGE_H__
 #define __IMAGE_H__
 
+#include <list>
+
 #include "bsymbol.h"
 
 #include "modularity/ioc.h"
@@ -101,7 +103,10 @@ protected:
     String _storePath;             // the path of the img in the ImageStore
     String _linkPath;              // the path of an external linked img
     bool _linkIsValid;              // whether _linkPath file exists or not
-    mutable mu::draw::Pixmap buffer;         ///< cached rendering
+    //! NOTE scaled renderings cached per target pixel size (i.e. per zoom
+    //! level), most recently used first; toggling between zoom levels reuses
+    //! the buffers instead of rescaling the source on every change
+    mutable std::list<std::pair<mu::Size, mu::draw::Pixmap> > _scaledCache;
     mu::SizeF _size;                   // in mm or spatium units
     bool _lockAspectRatio;
     bool _autoScale;                ///< fill parent frame
@@ -403,7 +403,11 @@ void LyricsLineSegment::layout()
         ryoffset() = lyr->offset().y();
     } else {
         // use Y position of *next* syllable if there is one on same system
-        Lyrics* nextLyr1 = searchNextLyrics(lyr->segment(), lyr->staffIdx(), lyr->no(), lyr->placement());
+        // (for dashes the next syllable was already searched by LyricsLine::layout(),
+        // so reuse it instead of walking the segments a second time)
+        Lyrics* nextLyr1 = isEndMelisma
+                           ? searchNextLyrics(lyr->segment(), lyr->staffIdx(), lyr->no(), lyr->placement())
+                           : lyricsLine()->nextLyrics();
         if (nextLyr1 && nextLyr1->segment()->system() == system()) {
             setPosY(nextLyr1->ipos().y());
             ryoffset() = nextLyr1->offset().y();
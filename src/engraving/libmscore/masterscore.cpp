@@ -482,6 +482,11 @@ void MasterScore::setUpdateAll()
 
 void MasterScore::setLayoutAll(staff_idx_t staff, const EngravingItem* e)
 {
+    // a full-score invalidation costs seconds on big scores, so leave a trace
+    // in the debug log; commands still taking the lazy path instead of the
+    // ranged setLayout() show up here
+    LOGD() << "full-score layout invalidation, trigger: " << (e ? e->typeName() : "unknown");
+
     _cmdState.setTick(Fraction(0, 1));
     _cmdState.setTick(measures()->last() ? measures()->last()->endTick() : Fraction(0, 1));
 
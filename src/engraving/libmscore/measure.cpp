@@ -355,6 +355,8 @@ MMRestRange* Measure::mmRangeText(staff_idx_t staffIdx) const
 
 Measure::~Measure()
 {
+    score()->invalidateMeasureLayoutHash(this);
+    score()->invalidateTickToMeasureIndexes();
     for (Segment* s = first(); s;) {
         Segment* ns = s->next();
         delete s;
@@ -2925,6 +2927,18 @@ PropertyValue Measure::propertyDefault(Pid propertyId) const
     return MeasureBase::propertyDefault(propertyId);
 }
 
+//-------------------------------------------------------------------
+//   setMMRest
+//    changes the multi measure rest chain, so the tick ->
+//    measure lookup index built over it must be rebuilt
+//-------------------------------------------------------------------
+
+void Measure::setMMRest(Measure* m)
+{
+    m_mmRest = m;
+    score()->invalidateTickToMeasureIndexes();
+}
+
 //-------------------------------------------------------------------
 //   mmRestFirst
 //    this is a multi measure rest
@@ -1117,9 +1117,7 @@ double Note::tabHeadWidth(const StaffType* tab) const
 {
     double val;
     if (tab && tab->isTabStaff() && _fret != INVALID_FRET_INDEX && _string != INVALID_STRING_INDEX) {
-        mu::draw::Font f    = tab->fretFont();
-        f.setPointSizeF(tab->fretFontSize());
-        val  = mu::draw::FontMetrics::width(f, _fretString) * magS();
+        val  = tab->fretMarkWidth(_fretString) * magS();
     } else {
         val = headWidth();
     }
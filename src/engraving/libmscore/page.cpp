@@ -22,6 +22,9 @@
 
 #include "page.h"
 
+#include <algorithm>
+#include <list>
+
 #include "rw/xml.h"
 
 #include "factory.h"
@@ -44,6 +47,15 @@ namespace mu::engraving {
 //extern String revision;
 static String revision;
 
+//! NOTE the BSP tree and the paint order cache of a page are materialized
+//! lazily, on its first paint or hit test (i.e. when it scrolls into view).
+//! Without an upper bound every page ever shown keeps these structures alive
+//! for the life of the score, which adds up in book-sized scores. The pages
+//! materialized most recently are kept in an LRU list and the oldest beyond
+//! the cap are released; a released page simply rebuilds on its next access
+static constexpr size_t MAX_MATERIALIZED_PAGES = 32;
+static std::list<Page*> materializedPages;
+
 //---------------------------------------------------------
 //   Page
 //---------------------------------------------------------
@@ -54,6 +66,43 @@ Page::Page(RootItem* parent)
     bspTreeValid = false;
 }
 
+Page::~Page()
+{
+    materializedPages.remove(this);
+}
+
+//---------------------------------------------------------
+//   touchMaterialized
+//    move this page to the front of the LRU list and
+//    release the paint structures of pages beyond the cap
+//---------------------------------------------------------
+
+void Page::touchMaterialized()
+{
+    if (materializedPages.empty() || materializedPages.front() != this) {
+        materializedPages.remove(this);
+        materializedPages.push_front(this);
+    }
+
+    while (materializedPages.size() > MAX_MATERIALIZED_PAGES) {
+        materializedPages.back()->releasePaintStructures();
+        materializedPages.pop_back();
+    }
+}
+
+//---------------------------------------------------------
+//   releasePaintStructures
+//---------------------------------------------------------
+
+void Page::releasePaintStructures()
+{
+    bspTree = BspTree();
+    bspTreeValid = false;
+
+    std::vector<EngravingItem*>().swap(_paintOrderCache);
+    _paintOrderValid = false;
+}
+
 //---------------------------------------------------------
 //   items
 //---------------------------------------------------------
@@ -63,6 +112,7 @@ std::vector<EngravingItem*> Page::items(const RectF& rect)
     if (!bspTreeValid) {
         doRebuildBspTree();
     }
+    touchMaterialized();
     return bspTree.items(rect);
 }
 
@@ -71,6 +121,7 @@ std::vector<EngravingItem*> Page::items(const mu::PointF& point)
     if (!bspTreeValid) {
         doRebuildBspTree();
     }
+    touchMaterialized();
     return bspTree.items(point);
 }
 
@@ -319,17 +370,12 @@ void Page::scanElements(void* data, void (* func)(void*, EngravingItem*), bool a
 }
 
 //---------------------------------------------------------
-//   bspInsert
+//   bspCollect
 //---------------------------------------------------------
 
-static void bspInsert(void* bspTree, EngravingItem* e)
-{
-    ((BspTree*)bspTree)->insert(e);
-}
-
-static void countElements(void* data, EngravingItem* /*e*/)
+static void bspCollect(void* data, EngravingItem* e)
 {
-    ++(*(int*)data);
+    ((std::vector<EngravingItem*>*)data)->push_back(e);
 }
 
 //---------------------------------------------------------
@@ -338,8 +384,8 @@ static void countElements(void* data, EngravingItem* /*e*/)
 
 void Page::doRebuildBspTree()
 {
-    int n = 0;
-    scanElements(&n, countElements, false);
+    std::vector<EngravingItem*> elements;
+    scanElements(&elements, bspCollect, false);
 
     RectF r;
     if (score()->linearMode()) {
@@ -357,11 +403,29 @@ void Page::doRebuildBspTree()
         r = abbox();
     }
 
-    bspTree.initialize(r, n);
-    scanElements(&bspTree, &bspInsert, false);
+    bspTree.rebuild(r, elements);
     bspTreeValid = true;
 }
 
+//---------------------------------------------------------
+//   elementsInPaintOrder
+//    all elements of the page, sorted once into painting
+//    order; repaints while panning/zooming reuse the list
+//    until the next layout pass invalidates it
+//---------------------------------------------------------
+
+const std::vector<EngravingItem*>& Page::elementsInPaintOrder()
+{
+    if (!_paintOrderValid) {
+        _paintOrderCache.clear();
+        scanElements(&_paintOrderCache, bspCollect, false);
+        std::sort(_paintOrderCache.begin(), _paintOrderCache.end(), elementLessThan);
+        _paintOrderValid = true;
+    }
+    touchMaterialized();
+    return _paintOrderCache;
+}
+
 //---------------------------------------------------------
 //   replaceTextMacros
 //   (keep in sync with toolTipHeaderFooter in EditStyle::EditStyle())
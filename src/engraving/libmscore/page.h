@@ -53,7 +53,13 @@ class Page final : public EngravingItem
     BspTree bspTree;
     bool bspTreeValid;
 
+    //! NOTE full element list of the page in painting (z) order, shared
+    //! between repaints; rebuilt on the same invalidation as the BSP tree
+    std::vector<EngravingItem*> _paintOrderCache;
+    bool _paintOrderValid = false;
+
     void doRebuildBspTree();
+    void touchMaterialized();
 
     friend class Factory;
     Page(RootItem* parent);
@@ -67,6 +73,8 @@ public:
     EngravingObject* scanParent() const override;
     EngravingObjectList scanChildren() const override;
 
+    ~Page() override;
+
     Page* clone() const override { return new Page(*this); }
     const std::vector<System*>& systems() const { return _systems; }
     std::vector<System*>& systems() { return _systems; }
@@ -92,7 +100,15 @@ public:
 
     std::vector<EngravingItem*> items(const mu::RectF& r);
     std::vector<EngravingItem*> items(const mu::PointF& p);
-    void invalidateBspTree() { bspTreeValid = false; }
+    const std::vector<EngravingItem*>& elementsInPaintOrder();
+
+    void invalidateBspTree()
+    {
+        bspTreeValid = false;
+        _paintOrderValid = false;
+    }
+
+    void releasePaintStructures();
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     mu::RectF tbbox();                             // tight bounding box, excluding white space
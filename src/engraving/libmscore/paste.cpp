@@ -503,8 +503,11 @@ bool Score::pasteStaff(XmlReader& e, Segment* dst, staff_idx_t dstStaff, Fractio
         }
     }
 
+    //! NOTE only the pasted range can contain dangling ties, everything
+    //! outside it was consistent before the paste; a full-score pass per
+    //! linked score made large pastes quadratic in practice
     for (Score* s : scoreList()) {     // for all parts
-        s->connectTies();
+        s->connectTies(dstTick, dstTick + tickLen);
     }
 
     if (pasted) {                         //select only if we pasted something
@@ -588,8 +588,6 @@ static int penalty(int lof1, int lof2, int k)
     return penalty;
 }
 
-static const int WINDOW       = 9;
-
 //---------------------------------------------------------
 //   tpc
 //---------------------------------------------------------
@@ -705,61 +703,77 @@ void changeAllTpcs(Note* n, int tpc1)
 
 //---------------------------------------------------------
 //   spell
+//    batch respell: a single dynamic-programming pass over
+//    the whole note list instead of re-evaluating 512 bit
+//    patterns per overlapping 9-note window. Each note
+//    picks one of its four candidate spellings (sharp/flat
+//    table, two variants each); the transition cost is the
+//    same penalty() model computeWindow() uses, so this
+//    finds the global optimum of that model in O(n).
 //---------------------------------------------------------
 
 void Score::spellNotelist(std::vector<Note*>& notes)
 {
-    int n = int(notes.size());
+    const int n = int(notes.size());
+    if (n == 0) {
+        return;
+    }
 
-    int start = 0;
-    while (start < n) {
-        int end = start + WINDOW;
-        if (end > n) {
-            end = n;
-        }
-        int opt = computeWindow(notes, start, end);
-        const int* tab;
-        if (opt < 0) {
-            tab = tab2;
-            opt *= -1;
-        } else {
-            tab = tab1;
+    static const int CANDIDATES = 4;
+
+    std::vector<int> tpcs(n * CANDIDATES);
+    std::vector<int> keys(n);
+
+    for (int i = 0; i < n; ++i) {
+        int pitch = notes[i]->pitch() % 12;
+        tpcs[i * CANDIDATES + 0] = tab1[pitch * 2];
+        tpcs[i * CANDIDATES + 1] = tab1[pitch * 2 + 1];
+        tpcs[i * CANDIDATES + 2] = tab2[pitch * 2];
+        tpcs[i * CANDIDATES + 3] = tab2[pitch * 2 + 1];
+
+        Fraction tick = notes[i]->chord()->tick();
+        keys[i] = int(notes[i]->staff()->key(tick)) + 7;
+        if (keys[i] < 0 || keys[i] > 14) {
+            LOGD("illegal key at tick %d: %d", tick.ticks(), keys[i] - 7);
+            return;
         }
+    }
 
-        if (start == 0) {
-            changeAllTpcs(notes[0], tab[(notes[0]->pitch() % 12) * 2 + (opt & 1)]);
-            if (n > 1) {
-                changeAllTpcs(notes[1], tab[(notes[1]->pitch() % 12) * 2 + ((opt & 2) >> 1)]);
+    std::vector<int> cost(n * CANDIDATES, 0);
+    std::vector<int> parent(n * CANDIDATES, 0);
+
+    for (int i = 1; i < n; ++i) {
+        for (int c = 0; c < CANDIDATES; ++c) {
+            int best     = -1;
+            int bestCost = 0;
+            for (int p = 0; p < CANDIDATES; ++p) {
+                int t = cost[(i - 1) * CANDIDATES + p]
+                        + penalty(tpcs[(i - 1) * CANDIDATES + p], tpcs[i * CANDIDATES + c], keys[i]);
+                if (best == -1 || t < bestCost) {
+                    best     = p;
+                    bestCost = t;
+                }
             }
-            if (n > 2) {
-                changeAllTpcs(notes[2], tab[(notes[2]->pitch() % 12) * 2 + ((opt & 4) >> 2)]);
-            }
-        }
-        if ((end - start) >= 6) {
-            changeAllTpcs(notes[start + 3], tab[(notes[start + 3]->pitch() % 12) * 2 + ((opt & 8) >> 3)]);
-            changeAllTpcs(notes[start + 4], tab[(notes[start + 4]->pitch() % 12) * 2 + ((opt & 16) >> 4)]);
-            changeAllTpcs(notes[start + 5], tab[(notes[start + 5]->pitch() % 12) * 2 + ((opt & 32) >> 5)]);
+            cost[i * CANDIDATES + c]   = bestCost;
+            parent[i * CANDIDATES + c] = best;
         }
-        if (end == n) {
-            int n1 = end - start;
-            int k;
-            switch (n1 - 6) {
-            case 3:
-                k = end - start - 3;
-                changeAllTpcs(notes[end - 3], tab[(notes[end - 3]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
-            // FALLTHROUGH
-            case 2:
-                k = end - start - 2;
-                changeAllTpcs(notes[end - 2], tab[(notes[end - 2]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
-            // FALLTHROUGH
-            case 1:
-                k = end - start - 1;
-                changeAllTpcs(notes[end - 1], tab[(notes[end - 1]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
-            }
-            break;
+    }
+
+    int c = 0;
+    for (int k = 1; k < CANDIDATES; ++k) {
+        if (cost[(n - 1) * CANDIDATES + k] < cost[(n - 1) * CANDIDATES + c]) {
+            c = k;
         }
-        // advance to next window
-        start += 3;
+    }
+
+    std::vector<int> chosen(n);
+    for (int i = n - 1; i >= 0; --i) {
+        chosen[i] = c;
+        c = parent[i * CANDIDATES + c];
+    }
+
+    for (int i = 0; i < n; ++i) {
+        changeAllTpcs(notes[i], tpcs[i * CANDIDATES + chosen[i]]);
     }
 }
 
@@ -216,7 +216,34 @@ void RealizedHarmony::update(int rootTpc, int bassTpc, int transposeOffset /*= 0
     }
 
     if (tpcIsValid(rootTpc)) {
+        //gather everything the realization depends on: besides the passed pitches
+        //that is our own chord text and, for the jazz interpretation, the next chord
+        RealizationContext context;
+        context.valid = true;
+        context.rootTpc = rootTpc;
+        context.bassTpc = bassTpc;
+        context.transposeOffset = transposeOffset;
+        context.literal = _literal;
+        context.voicing = _voicing;
+        context.textName = _harmony->hTextName();
+        if (!_literal) {
+            Harmony* next = _harmony->findNext();
+            if (next && tpcIsValid(next->rootTpc())) {
+                context.nextRootTpc = next->rootTpc();
+                context.nextQuality = next->parsedForm()->quality();
+                context.nextExtension = next->parsedForm()->extension();
+            }
+        }
+
+        //the dirty flag is set conservatively (e.g. for every chord symbol on a capo
+        //update or a backward cascade), so skip regenerating when nothing changed
+        if (!_notes.empty() && context == _lastContext) {
+            _dirty = false;
+            return;
+        }
+
         _notes = generateNotes(rootTpc, bassTpc, _literal, _voicing, transposeOffset);
+        _lastContext = context;
     }
     _dirty = false;
 }
@@ -27,6 +27,7 @@
 
 #include "containers.h"
 #include "types/fraction.h"
+#include "types/string.h"
 
 namespace mu::engraving {
 class Harmony;
@@ -64,10 +65,42 @@ public:
     using PitchMap = std::multimap<int, int>;   //map from pitch to tpc
 
 private:
+    //everything the last realization depended on besides the dirty flag,
+    //so that a conservatively set dirty flag (capo updates, backward cascades)
+    //does not force regenerating a note map that would come out identical
+    struct RealizationContext {
+        bool valid = false;
+        int rootTpc = 0;
+        int bassTpc = 0;
+        int transposeOffset = 0;
+        bool literal = false;
+        Voicing voicing = Voicing::INVALID;
+        String textName;
+        int nextRootTpc = 0;
+        String nextQuality;
+        String nextExtension;
+
+        bool operator==(const RealizationContext& o) const
+        {
+            return valid && o.valid
+                   && rootTpc == o.rootTpc
+                   && bassTpc == o.bassTpc
+                   && transposeOffset == o.transposeOffset
+                   && literal == o.literal
+                   && voicing == o.voicing
+                   && textName == o.textName
+                   && nextRootTpc == o.nextRootTpc
+                   && nextQuality == o.nextQuality
+                   && nextExtension == o.nextExtension;
+        }
+    };
+
     Harmony* _harmony;
 
     PitchMap _notes;
 
+    RealizationContext _lastContext;
+
     Voicing _voicing = Voicing::AUTO;
     HDuration _duration = HDuration::INVALID;
 
@@ -145,6 +145,78 @@ int RepeatList::ticks() const
     return 0;
 }
 
+//---------------------------------------------------------
+//   structureHash
+//    fingerprint of everything the unwound list depends on:
+//    the measure chain (pointers and ticks), repeat
+//    barlines and counts, section breaks with their pause,
+//    jumps, markers and voltas
+//---------------------------------------------------------
+
+static inline void hashCombine(uint64_t& h, uint64_t v)
+{
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+}
+
+static inline void hashString(uint64_t& h, const String& s)
+{
+    hashCombine(h, s.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+        hashCombine(h, s.at(i).unicode());
+    }
+}
+
+uint64_t RepeatList::structureHash() const
+{
+    uint64_t h = 0;
+
+    for (const MeasureBase* mb = _score->firstMeasure(); mb; mb = mb->next()) {
+        hashCombine(h, reinterpret_cast<uintptr_t>(mb));
+        hashCombine(h, mb->tick().ticks());
+        hashCombine(h, mb->ticks().ticks());
+        hashCombine(h, mb->repeatStart());
+        hashCombine(h, mb->repeatEnd());
+        hashCombine(h, mb->sectionBreak());
+        if (const LayoutBreak* sectionBreak = mb->sectionBreakElement()) {
+            hashCombine(h, std::hash<double>{}(sectionBreak->pause()));
+        }
+        if (mb->isMeasure()) {
+            hashCombine(h, toMeasure(mb)->repeatCount());
+        }
+        for (const EngravingItem* e : mb->el()) {
+            if (e->isJump()) {
+                const Jump* jump = toJump(e);
+                hashCombine(h, reinterpret_cast<uintptr_t>(e));
+                hashString(h, jump->jumpTo());
+                hashString(h, jump->playUntil());
+                hashString(h, jump->continueAt());
+                hashCombine(h, jump->playRepeats());
+            } else if (e->isMarker()) {
+                const Marker* marker = toMarker(e);
+                hashCombine(h, reinterpret_cast<uintptr_t>(e));
+                hashString(h, marker->label());
+                hashCombine(h, static_cast<int>(marker->align().horizontal));
+            }
+        }
+    }
+
+    for (const auto& spannerEntry : _score->spanner()) {
+        const Spanner* spanner = spannerEntry.second;
+        if (!spanner->isVolta()) {
+            continue;
+        }
+        hashCombine(h, reinterpret_cast<uintptr_t>(spanner));
+        hashCombine(h, spanner->tick().ticks());
+        hashCombine(h, spanner->tick2().ticks());
+        hashCombine(h, static_cast<int>(spanner->getProperty(Pid::END_HOOK_TYPE).value<HookType>()));
+        for (int ending : toVolta(spanner)->endings()) {
+            hashCombine(h, ending);
+        }
+    }
+
+    return h;
+}
+
 //---------------------------------------------------------
 //   update
 //---------------------------------------------------------
@@ -155,12 +227,24 @@ void RepeatList::update(bool expand)
         return;
     }
 
+    //! NOTE setPlaylistDirty() is raised by many edits that cannot alter the
+    //! repeat structure (note input, dynamics, tempo changes...). Fingerprint
+    //! the structure first: when it is unchanged, keep the unwound segments
+    //! and only refresh the time offsets from the (possibly changed) tempomap.
+    const uint64_t hash = structureHash();
+    if (expand == _expanded && !this->empty() && hash == _structureHash) {
+        updateTempo();
+        _scoreChanged = false;
+        return;
+    }
+
     if (expand) {
         unwind();
     } else {
         flatten();
     }
 
+    _structureHash = hash;
     _scoreChanged = false;
 }
 
@@ -175,16 +259,18 @@ void RepeatList::updateTempo()
         return;
     }
 
+    _tempoCursor.setMap(tl);
+
     int utick = 0;
     double t  = 0;
 
     for (RepeatSegment* s : *this) {
         s->utick      = utick;
         s->utime      = t;
-        double ct      = tl->tick2time(s->tick);
+        double ct      = _tempoCursor.tick2time(s->tick);
         s->timeOffset = t - ct;
         utick        += s->len();
-        t            += tl->tick2time(s->tick + s->len()) - ct;
+        t            += _tempoCursor.tick2time(s->tick + s->len()) - ct;
     }
 }
 
@@ -241,7 +327,8 @@ double RepeatList::utick2utime(int tick) const
     for (unsigned i = ii; i < n; ++i) {
         if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
             int t     = tick - (at(i)->utick - at(i)->tick);
-            double tt = _score->tempomap()->tick2time(t) + at(i)->timeOffset;
+            _tempoCursor.setMap(_score->tempomap());
+            double tt = _tempoCursor.tick2time(t) + at(i)->timeOffset;
             return tt;
         }
     }
@@ -259,7 +346,8 @@ int RepeatList::utime2utick(double secs) const
     for (unsigned i = ii; i < repeatSegmentsCount; ++i) {
         if ((secs >= at(i)->utime) && ((i + 1 == repeatSegmentsCount) || (secs < at(i + 1)->utime))) {
             idx2 = i;
-            return _score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
+            _tempoCursor.setMap(_score->tempomap());
+            return _tempoCursor.time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
         }
     }
 
@@ -23,12 +23,15 @@
 #ifndef __REPEATLIST_H__
 #define __REPEATLIST_H__
 
+#include <cstdint>
 #include <set>
 #include <vector>
 
 #include "global/allocator.h"
 #include "types/string.h"
 
+#include "tempo.h"
+
 namespace mu::engraving {
 class Score;
 class Measure;
@@ -81,9 +84,13 @@ class RepeatList : public std::vector<RepeatSegment*>
 
     Score* _score = nullptr;
     mutable unsigned idx1, idx2;     // cached values
+    mutable TempoCursor _tempoCursor;     // amortizes the sequential tick<->time queries
 
     bool _expanded = false;
     bool _scoreChanged = true;
+    uint64_t _structureHash = 0;   // fingerprint of the repeat structure as of the last rebuild
+
+    uint64_t structureHash() const;
 
     std::set<std::pair<Jump const* const, int> > _jumpsTaken;     // take the jumps only once, so track them during unwind
     std::vector<RepeatListElementList> _rlElements;   // all elements of the score that influence the RepeatList
@@ -27,12 +27,15 @@
 
 #include "score.h"
 
+#include <chrono>
 #include <cmath>
 #include <map>
 
 #include "containers.h"
 
+#include "layout/layoutreplay.h"
 #include "style/style.h"
+#include "style/styleimpact.h"
 #include "style/defaultstyle.h"
 #include "compat/dummyelement.h"
 #include "rw/xml.h"
@@ -192,6 +195,7 @@ void MeasureBaseList::push_front(MeasureBase* e)
 
 void MeasureBaseList::add(MeasureBase* e)
 {
+    ++_generation;
     MeasureBase* el = e->next();
     if (el == 0) {
         push_back(e);
@@ -213,6 +217,7 @@ void MeasureBaseList::add(MeasureBase* e)
 
 void MeasureBaseList::remove(MeasureBase* el)
 {
+    ++_generation;
     --_size;
     if (el->prev()) {
         el->prev()->setNext(el->next());
@@ -232,6 +237,7 @@ void MeasureBaseList::remove(MeasureBase* el)
 
 void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 {
+    ++_generation;
     ++_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         ++_size;
@@ -256,6 +262,7 @@ void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 {
+    ++_generation;
     --_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         --_size;
@@ -280,6 +287,7 @@ void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::change(MeasureBase* ob, MeasureBase* nb)
 {
+    ++_generation;
     nb->setPrev(ob->prev());
     nb->setNext(ob->next());
     if (ob->prev()) {
@@ -591,6 +599,8 @@ void Score::setUpTempoMap()
         tick += measureTicks;
     }
 
+    invalidateTickToMeasureIndexes();
+
     if (isMaster()) {
         for (const auto& pair : spanner()) {
             const Spanner* spannerItem = pair.second;
@@ -747,6 +757,179 @@ void Score::rebuildTempoAndTimeSigMaps(Measure* measure)
     }
 }
 
+//---------------------------------------------------------
+//   setUpTempoMapOnInsertedMeasures
+//    incremental version of setUpTempoMap() for measures
+//    that were just added to the measure list: instead of
+//    rebuilding the maps from the beginning of the score,
+//    shift everything behind the insertion and rebuild the
+//    maps only around the inserted range; falls back to
+//    the full rebuild when the context is not simple
+//---------------------------------------------------------
+
+void Score::setUpTempoMapOnInsertedMeasures(MeasureBase* fmb, MeasureBase* lmb)
+{
+    TRACEFUNC;
+
+    MeasureBase* pmb = fmb->prev();
+    MeasureBase* nmb = lmb->next();
+
+    // inserting at the very beginning changes the initial sig map entry,
+    // let the full rebuild handle that
+    if (!pmb || !fmb->prevMeasure()) {
+        setUpTempoMap();
+        return;
+    }
+
+    const Fraction startTick = pmb->endTick();
+
+    // the shift below cannot restore the easing curves of gradual tempo
+    // changes, rebuild from scratch when one could be affected
+    if (isMaster()) {
+        for (const auto& pair : spanner()) {
+            const Spanner* sp = pair.second;
+            if (sp && sp->isGradualTempoChange() && sp->tick2() >= startTick) {
+                setUpTempoMap();
+                return;
+            }
+        }
+    }
+
+    // the measures behind the insertion must actually start at the
+    // insertion point, otherwise the tree was inconsistent before
+    if (nmb && nmb->tick() != startTick) {
+        setUpTempoMap();
+        return;
+    }
+
+    // set the ticks of the inserted measures
+    Fraction tick = startTick;
+    for (MeasureBase* mb = fmb; mb != nmb; mb = mb->next()) {
+        if (!mb->isMeasure()) {
+            mb->setTick(tick);
+            continue;
+        }
+        Measure* m = toMeasure(mb);
+        Fraction diff = tick - m->tick();
+        m->moveTicks(diff);
+        if (m->mmRest()) {
+            m->mmRest()->moveTicks(diff);
+        }
+        tick += m->ticks();
+    }
+
+    // shift everything behind the insertion
+    const Fraction len = tick - startTick;
+    for (MeasureBase* mb = nmb; mb; mb = mb->next()) {
+        if (!mb->isMeasure()) {
+            mb->setTick(mb->tick() + len);
+            continue;
+        }
+        Measure* m = toMeasure(mb);
+        m->moveTicks(len);
+        if (m->mmRest()) {
+            m->mmRest()->moveTicks(len);
+        }
+    }
+
+    invalidateTickToMeasureIndexes();
+
+    if (isMaster()) {
+        tempomap()->insertTime(startTick.ticks(), len.ticks());
+        sigmap()->insertTime(startTick.ticks(), len.ticks());
+    }
+    for (Staff* staff : _staves) {
+        staff->moveTimeSigs(startTick, len);
+    }
+
+    // create the map entries for the inserted measures; the first measure
+    // behind them has a new predecessor, so its entries change as well
+    for (MeasureBase* mb = fmb; mb != nmb; mb = mb->next()) {
+        if (mb->isMeasure()) {
+            rebuildTempoAndTimeSigMaps(toMeasure(mb));
+        }
+    }
+    for (MeasureBase* mb = nmb; mb; mb = mb->next()) {
+        if (mb->isMeasure()) {
+            rebuildTempoAndTimeSigMaps(toMeasure(mb));
+            break;
+        }
+    }
+
+    masterScore()->updateRepeatListTempo();
+}
+
+//---------------------------------------------------------
+//   setUpTempoMapOnRemovedMeasures
+//    counterpart of setUpTempoMapOnInsertedMeasures() for
+//    measures that were just removed from the measure
+//    list; nmb is the measure base that followed the
+//    removed range
+//---------------------------------------------------------
+
+void Score::setUpTempoMapOnRemovedMeasures(const Fraction& tick, const Fraction& len, MeasureBase* nmb)
+{
+    TRACEFUNC;
+
+    MeasureBase* pmb = nmb ? nmb->prev() : last();
+    Measure* pm = !pmb ? nullptr : (pmb->isMeasure() ? toMeasure(pmb) : pmb->prevMeasure());
+
+    // removing the first measure changes the initial sig map entry, let
+    // the full rebuild handle that; also rebuild when the measures around
+    // the removed range do not line up with it
+    if (!pm || pmb->endTick() != tick || (nmb && nmb->tick() != tick + len)) {
+        setUpTempoMap();
+        return;
+    }
+
+    if (isMaster()) {
+        for (const auto& pair : spanner()) {
+            const Spanner* sp = pair.second;
+            if (sp && sp->isGradualTempoChange() && sp->tick2() >= tick) {
+                setUpTempoMap();
+                return;
+            }
+        }
+    }
+
+    // shift everything behind the removed range
+    for (MeasureBase* mb = nmb; mb; mb = mb->next()) {
+        if (!mb->isMeasure()) {
+            mb->setTick(mb->tick() - len);
+            continue;
+        }
+        Measure* m = toMeasure(mb);
+        m->moveTicks(-len);
+        if (m->mmRest()) {
+            m->mmRest()->moveTicks(-len);
+        }
+    }
+
+    invalidateTickToMeasureIndexes();
+
+    if (isMaster()) {
+        tempomap()->insertTime(tick.ticks(), -len.ticks());
+        sigmap()->insertTime(tick.ticks(), -len.ticks());
+        if (tempomap()->empty()) {
+            tempomap()->setTempo(0, Constants::defaultTempo);
+        }
+    }
+    for (Staff* staff : _staves) {
+        staff->moveTimeSigs(tick, -len);
+    }
+
+    // the first measure behind the removed range has a new predecessor,
+    // so its map entries change
+    for (MeasureBase* mb = nmb; mb; mb = mb->next()) {
+        if (mb->isMeasure()) {
+            rebuildTempoAndTimeSigMaps(toMeasure(mb));
+            break;
+        }
+    }
+
+    masterScore()->updateRepeatListTempo();
+}
+
 //---------------------------------------------------------
 //   pos2measure
 //     Return measure for canvas relative position \a p.
@@ -1463,6 +1646,13 @@ static void spatiumHasChanged(void* data, EngravingItem* e)
 {
     double* val = (double*)data;
     e->spatiumChanged(val[0], val[1]);
+
+    // also refresh the style-dependent caches here: a spatium change is
+    // always followed by styleChanged(Sid::spatium), which then skips its
+    // own scan - one combined pass over a big score instead of two
+    bool v = e->generated();
+    e->styleChanged();
+    e->setGenerated(v);
 }
 
 //---------------------------------------------------------
@@ -1479,7 +1669,8 @@ void Score::spatiumChanged(double oldValue, double newValue)
         staff->spatiumChanged(oldValue, newValue);
     }
     _noteHeadWidth = m_engravingFont->width(SymId::noteheadBlack, newValue / SPATIUM20);
-    createPaddingTable();
+    // the padding table is rebuilt by the styleChanged(Sid::spatium) call
+    // that follows every spatium change
 }
 
 //---------------------------------------------------------
@@ -1500,7 +1691,23 @@ static void updateStyle(void*, EngravingItem* e)
 
 void Score::styleChanged()
 {
-    scanElements(0, updateStyle);
+    styleChanged(Sid::NOSTYLE);
+}
+
+//---------------------------------------------------------
+//   styleChanged
+//    variant for a single known style change; keeps the
+//    per-measure layout caches when the changed style id
+//    cannot influence the content of a measure
+//---------------------------------------------------------
+
+void Score::styleChanged(Sid changedSid)
+{
+    if (changedSid != Sid::spatium) {
+        // for a spatium change the styleChanged() refresh already ran as
+        // part of the spatiumChanged() element scan
+        scanElements(0, updateStyle);
+    }
     for (int i = 0; i < MAX_HEADERS; i++) {
         if (headerText(i)) {
             headerText(i)->styleChanged();
@@ -1512,9 +1719,66 @@ void Score::styleChanged()
         }
     }
     createPaddingTable();
+    if (styleChangeAffectsMeasureLayout(changedSid)) {
+        clearMeasureLayoutHashes();
+    }
+    invalidateTickToMeasureIndexes();   // Sid::createMultiMeasureRests changes the MM chain
     setLayoutAll();
 }
 
+//---------------------------------------------------------
+//   measureLayoutHash
+//    content hash of the measure as of its last layout
+//    pass, or 0 if the measure was never laid out (or the
+//    cache was invalidated since)
+//---------------------------------------------------------
+
+uint64_t Score::measureLayoutHash(const Measure* m) const
+{
+    auto it = m_measureLayoutHashes.find(m);
+    return it != m_measureLayoutHashes.end() ? it->second : 0;
+}
+
+void Score::setMeasureLayoutHash(const Measure* m, uint64_t hash)
+{
+    m_measureLayoutHashes[m] = hash;
+}
+
+void Score::invalidateMeasureLayoutHash(const Measure* m)
+{
+    m_measureLayoutHashes.erase(m);
+}
+
+//---------------------------------------------------------
+//   invalidateMeasureLayoutHashes
+//    drop the cached content hashes of all measures in the
+//    tick range; called whenever a layout is requested for
+//    the range, so that the skip in getNextMeasure() never
+//    acts on content modified since the last pass
+//---------------------------------------------------------
+
+void Score::invalidateMeasureLayoutHashes(const Fraction& tick1, const Fraction& tick2)
+{
+    if (m_measureLayoutHashes.empty() || tick1 < Fraction(0, 1)) {
+        return;
+    }
+
+    for (Measure* m = tick2measure(tick1); m; m = m->nextMeasure()) {
+        m_measureLayoutHashes.erase(m);
+        if (m->mmRest()) {
+            m_measureLayoutHashes.erase(m->mmRest());
+        }
+        if (m->endTick() >= tick2) {
+            break;
+        }
+    }
+}
+
+void Score::clearMeasureLayoutHashes()
+{
+    m_measureLayoutHashes.clear();
+}
+
 //---------------------------------------------------------
 //   getCreateMeasure
 //    - return Measure for tick
@@ -2186,9 +2450,12 @@ bool Score::appendScore(Score* score, bool addPageBreak, bool addSectionBreak)
     }
 
     // clone the measures
+    Fraction tickOfAppend = last()->endTick();
     appendMeasuresFromScore(score, Fraction(0, 1), score->last()->endTick());
 
-    setLayoutAll();
+    // only the appended measures (and the break edits on the old last
+    // measure, which registered their own invalidation) need layout
+    setLayout(tickOfAppend, last()->endTick(), 0, nstaves() - 1, nullptr);
     return true;
 }
 
@@ -5401,7 +5668,9 @@ void Score::changeSelectedNotesVoice(voice_idx_t voice)
     }
 
     select(el, SelectType::ADD, mu::nidx);
-    setLayoutAll();
+    // no blanket invalidation needed: every chord/rest moved above went
+    // through undoAddElement/undoRemoveElement, which register tick-ranged
+    // layout for the affected measures
 }
 
 std::set<ID> Score::partIdsFromRange(const track_idx_t trackFrom, const track_idx_t trackTo) const
@@ -5654,15 +5923,29 @@ void Score::scanElements(void* data, void (* func)(void*, EngravingItem*), bool
 //---------------------------------------------------------
 
 void Score::connectTies(bool silent)
+{
+    connectTies(Fraction(0, 1), Fraction(-1, 1), silent);
+}
+
+//---------------------------------------------------------
+//   connectTies (ranged)
+//    only considers chords starting in [tick1, tick2);
+//    a negative tick2 means "up to the end of the score"
+//---------------------------------------------------------
+
+void Score::connectTies(const Fraction& tick1, const Fraction& tick2, bool silent)
 {
     size_t tracks = nstaves() * VOICES;
-    Measure* m = firstMeasure();
+    Measure* m = tick1 > Fraction(0, 1) ? tick2measure(tick1) : firstMeasure();
     if (!m) {
         return;
     }
 
     SegmentType st = SegmentType::ChordRest;
     for (Segment* s = m->first(st); s; s = s->next1(st)) {
+        if (tick2 >= Fraction(0, 1) && s->tick() >= tick2) {
+            break;
+        }
         for (track_idx_t i = 0; i < tracks; ++i) {
             EngravingItem* e = s->element(i);
             if (e == 0 || !e->isChord()) {
@@ -5733,6 +6016,23 @@ void Score::doLayout()
     doLayoutRange(Fraction(0, 1), Fraction(-1, 1));
 }
 
+//---------------------------------------------------------
+//   doLayoutUpTo
+//    progressive first layout: lay out from the beginning
+//    until the page containing endTick is complete. The
+//    caller is responsible for finishing the score with a
+//    doLayoutRange() continuation afterwards.
+//---------------------------------------------------------
+
+void Score::doLayoutUpTo(const Fraction& endTick)
+{
+    TRACEFUNC;
+
+    m_layoutOptions.stopAfterEndTick = true;
+    doLayoutRange(Fraction(0, 1), endTick);
+    m_layoutOptions.stopAfterEndTick = false;
+}
+
 void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 {
     TRACEFUNC;
@@ -5741,7 +6041,15 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     _noteHeadWidth = m_engravingFont->width(SymId::noteheadBlack, spatium() / SPATIUM20);
 
     m_layoutOptions.updateFromStyle(style());
-    m_layout.doLayoutRange(m_layoutOptions, st, et);
+
+    if (LayoutReplay::enabled()) {
+        auto startTime = std::chrono::steady_clock::now();
+        m_layout.doLayoutRange(m_layoutOptions, st, et);
+        int64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+        LayoutReplay::capture(this, m_layoutOptions, st, et, elapsedMs);
+    } else {
+        m_layout.doLayoutRange(m_layoutOptions, st, et);
+    }
 
     if (_resetAutoplace) {
         _resetAutoplace = false;
@@ -5752,6 +6060,8 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
         _resetDefaults = false;
         resetDefaults();
     }
+
+    ++m_layoutGeneration;
 }
 
 void Score::createPaddingTable()
@@ -5963,10 +6273,21 @@ async::Channel<ScoreChangesRange> Score::changesChannel() const { return _master
 
 void Score::setUpdateAll() { _masterScore->setUpdateAll(); }
 
-void Score::setLayoutAll(staff_idx_t staff, const EngravingItem* e) { _masterScore->setLayoutAll(staff, e); }
-void Score::setLayout(const Fraction& tick, staff_idx_t staff, const EngravingItem* e) { _masterScore->setLayout(tick, staff, e); }
+void Score::setLayoutAll(staff_idx_t staff, const EngravingItem* e)
+{
+    clearMeasureLayoutHashes();
+    _masterScore->setLayoutAll(staff, e);
+}
+
+void Score::setLayout(const Fraction& tick, staff_idx_t staff, const EngravingItem* e)
+{
+    invalidateMeasureLayoutHashes(tick, tick);
+    _masterScore->setLayout(tick, staff, e);
+}
+
 void Score::setLayout(const Fraction& tick1, const Fraction& tick2, staff_idx_t staff1, staff_idx_t staff2, const EngravingItem* e)
 {
+    invalidateMeasureLayoutHashes(tick1, tick2);
     _masterScore->setLayout(tick1, tick2, staff1, staff2, e);
 }
 
@@ -30,6 +30,7 @@
 
 #include <set>
 #include <memory>
+#include <unordered_map>
 
 #include "async/channel.h"
 #include "io/iodevice.h"
@@ -166,6 +167,7 @@ class MeasureBaseList
     int _size;
     MeasureBase* _first = nullptr;
     MeasureBase* _last = nullptr;
+    unsigned _generation = 0;   // bumped by every mutation, see Score::tickToMeasureIndex()
 
     void push_back(MeasureBase* e);
     void push_front(MeasureBase* e);
@@ -174,7 +176,7 @@ public:
     MeasureBaseList();
     MeasureBase* first() const { return _first; }
     MeasureBase* last()  const { return _last; }
-    void clear() { _first = _last = 0; _size = 0; }
+    void clear() { _first = _last = 0; _size = 0; ++_generation; }
     void add(MeasureBase*);
     void remove(MeasureBase*);
     void insert(MeasureBase*, MeasureBase*);
@@ -182,6 +184,7 @@ public:
     void change(MeasureBase* o, MeasureBase* n);
     int size() const { return _size; }
     bool empty() const { return _size == 0; }
+    unsigned generation() const { return _generation; }
 };
 
 //---------------------------------------------------------
@@ -496,6 +499,23 @@ private:
     double _minimumPaddingUnit = 0.1 * spatium(); // Maybe style setting in future
     bool _updatesLocked = false;
 
+    std::unordered_map<const Measure*, uint64_t> m_measureLayoutHashes;
+
+    unsigned m_layoutGeneration = 0;   // bumped after every doLayoutRange()
+
+    //! NOTE sorted tick -> measure index for O(log n) tick2measure lookups;
+    //! rebuilt lazily when the measure list or the measure ticks change
+    struct TickToMeasureIndex {
+        std::vector<std::pair<int, Measure*> > entries;
+        unsigned generation = 0;
+        bool valid = false;
+    };
+
+    mutable TickToMeasureIndex m_tickToMeasureIndex;
+    mutable TickToMeasureIndex m_tickToMeasureIndexMM;
+
+    const std::vector<std::pair<int, Measure*> >& tickToMeasureIndex(bool mmRests) const;
+
 protected:
     int _fileDivision;   ///< division of current loading *.msc file
     SynthesizerState _synthesizerState;
@@ -664,6 +684,7 @@ public:
     void undoRemoveStaff(Staff* staff);
     void undoInsertStaff(Staff* staff, staff_idx_t idx, bool createRests=true);
     void undoChangeVisible(EngravingItem* item, bool visible);
+    void undoChangeProperties(const std::vector<EngravingObject*>& elements, Pid id, const PropertyValue& v, PropertyFlags ps);
     void undoChangeTuning(Note*, double);
     void undoChangeUserMirror(Note*, DirectionH);
     void undoChangeKeySig(Staff* ostaff, const Fraction& tick, KeySigEvent);
@@ -844,6 +865,8 @@ public:
 
     void setUpTempoMapLater();
     void setUpTempoMap();
+    void setUpTempoMapOnInsertedMeasures(MeasureBase* fmb, MeasureBase* lmb);
+    void setUpTempoMapOnRemovedMeasures(const Fraction& tick, const Fraction& len, MeasureBase* nmb);
 
     EngravingItem* nextElement();
     EngravingItem* prevElement();
@@ -931,6 +954,7 @@ public:
 
     void spatiumChanged(double oldValue, double newValue);
     void styleChanged() override;
+    void styleChanged(Sid changedSid);
 
     void cmdPaste(const IMimeData* ms, MuseScoreView* view, Fraction scale = Fraction(1, 1));
     bool pasteStaff(XmlReader&, Segment* dst, staff_idx_t staffIdx, Fraction scale = Fraction(1, 1));
@@ -1030,6 +1054,7 @@ public:
     Segment* lastSegmentMM() const;
 
     void connectTies(bool silent = false);
+    void connectTies(const Fraction& tick1, const Fraction& tick2, bool silent = false);
 
     double point(const Spatium sp) const { return sp.val() * spatium(); }
 
@@ -1050,6 +1075,7 @@ public:
     void removeAudio();
 
     void doLayout();
+    void doLayoutUpTo(const Fraction& endTick);
     void doLayoutRange(const Fraction& st, const Fraction& et);
 
     SynthesizerState& synthesizerState() { return _synthesizerState; }
@@ -1100,6 +1126,26 @@ public:
     void setLayoutMode(LayoutMode lm) { m_layoutOptions.mode = lm; }
     void setShowVBox(bool v) { m_layoutOptions.showVBox = v; }
 
+    // per-measure layout cache: content hash of a measure as of its last
+    // layout pass, so unchanged measures can skip re-layout (see
+    // LayoutMeasure::getNextMeasure())
+    uint64_t measureLayoutHash(const Measure* m) const;
+    void setMeasureLayoutHash(const Measure* m, uint64_t hash);
+    void invalidateMeasureLayoutHash(const Measure* m);
+    void invalidateMeasureLayoutHashes(const Fraction& tick1, const Fraction& tick2);
+    void clearMeasureLayoutHashes();
+
+    //! NOTE cheap validity token for caches of engraved positions (e.g. the
+    //! selection highlight rects in the notation module): if the generation
+    //! is unchanged, no layout pass has run and cached geometry is still valid
+    unsigned layoutGeneration() const { return m_layoutGeneration; }
+
+    void invalidateTickToMeasureIndexes() const
+    {
+        m_tickToMeasureIndex.valid = false;
+        m_tickToMeasureIndexMM.valid = false;
+    }
+
     // temporary methods
     bool isLayoutMode(LayoutMode lm) const { return m_layoutOptions.isMode(lm); }
     LayoutMode layoutMode() const { return m_layoutOptions.mode; }
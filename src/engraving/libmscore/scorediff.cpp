@@ -0,0 +1,373 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scorediff.h"
+
+#include <map>
+#include <tuple>
+#include <unordered_map>
+
+#include "measure.h"
+#include "note.h"
+#include "score.h"
+
+using namespace mu;
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   isLayoutArtifact
+//    elements the layout derives from the notation itself;
+//    they carry no information of their own, so comparing
+//    them would only duplicate (or, worse, fabricate)
+//    changes
+//---------------------------------------------------------
+
+static bool isLayoutArtifact(const EngravingItem* item)
+{
+    switch (item->type()) {
+    case ElementType::STEM:
+    case ElementType::HOOK:
+    case ElementType::BEAM:
+    case ElementType::LEDGER_LINE:
+    case ElementType::STEM_SLASH:
+    case ElementType::STAFF_LINES:
+    case ElementType::SYSTEM_DIVIDER:
+        return true;
+    default:
+        return item->generated();
+    }
+}
+
+//---------------------------------------------------------
+//   hashCombine
+//---------------------------------------------------------
+
+static void hashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+//---------------------------------------------------------
+//   ScoreDiff
+//---------------------------------------------------------
+
+ScoreDiff::ScoreDiff(const Score* before, const Score* after)
+    : m_before(before), m_after(after)
+{
+}
+
+//---------------------------------------------------------
+//   collectItems
+//    depth first walk over the scan tree below obj,
+//    skipping generated and layout-only elements
+//---------------------------------------------------------
+
+void ScoreDiff::collectItems(const EngravingObject* obj, std::vector<const EngravingItem*>& items)
+{
+    for (EngravingObject* child : obj->scanChildren()) {
+        if (child->isEngravingItem()) {
+            const EngravingItem* item = static_cast<const EngravingItem*>(child);
+            if (!isLayoutArtifact(item) && !item->isSegment()) {
+                items.push_back(item);
+            }
+        }
+
+        collectItems(child, items);
+    }
+}
+
+//---------------------------------------------------------
+//   measureHash
+//    structural fingerprint of a measure's content, used
+//    to align the measure sequences; property level
+//    changes are found by the per measure comparison, so
+//    the hash only has to identify "the same measure"
+//    reliably enough for anchoring
+//---------------------------------------------------------
+
+size_t ScoreDiff::measureHash(const Measure* m)
+{
+    std::vector<const EngravingItem*> items;
+    collectItems(m, items);
+
+    size_t seed = items.size();
+    for (const EngravingItem* item : items) {
+        hashCombine(seed, size_t(item->type()));
+        hashCombine(seed, size_t(item->track()));
+        hashCombine(seed, size_t((item->tick() - m->tick()).ticks()));
+
+        if (item->type() == ElementType::NOTE) {
+            hashCombine(seed, size_t(static_cast<const Note*>(item)->pitch()));
+        }
+    }
+
+    return seed;
+}
+
+//---------------------------------------------------------
+//   changedProperties
+//---------------------------------------------------------
+
+std::vector<Pid> ScoreDiff::changedProperties(const EngravingItem* before, const EngravingItem* after)
+{
+    std::vector<Pid> result;
+
+    for (int i = 0; i < int(Pid::END); ++i) {
+        Pid pid = Pid(i);
+
+        switch (pid) {
+        //! NOTE positional bookkeeping; it legitimately shifts when measures
+        //! are inserted or removed in front, which is not a change of the
+        //! element itself
+        case Pid::TICK:
+        case Pid::TRACK:
+        case Pid::VOICE:
+        case Pid::POSITION:
+        case Pid::GENERATED:
+        case Pid::SELECTED:
+            continue;
+        default:
+            break;
+        }
+
+        if (!(before->getProperty(pid) == after->getProperty(pid))) {
+            result.push_back(pid);
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   addEntry
+//---------------------------------------------------------
+
+void ScoreDiff::addEntry(ScoreDiffType type, const EngravingItem* before, const EngravingItem* after, std::vector<Pid>&& pids)
+{
+    ScoreDiffEntry entry;
+    entry.type = type;
+    entry.before = before;
+    entry.after = after;
+    entry.changedProperties = std::move(pids);
+    m_entries.push_back(std::move(entry));
+}
+
+//---------------------------------------------------------
+//   diffMeasures
+//---------------------------------------------------------
+
+void ScoreDiff::diffMeasures(const Measure* before, const Measure* after)
+{
+    std::vector<Pid> measurePids = changedProperties(before, after);
+    if (!measurePids.empty()) {
+        addEntry(ScoreDiffType::Changed, before, after, std::move(measurePids));
+    }
+
+    std::vector<const EngravingItem*> beforeItems;
+    std::vector<const EngravingItem*> afterItems;
+    collectItems(before, beforeItems);
+    collectItems(after, afterItems);
+
+    //! NOTE elements are matched by type, track and position within their
+    //! measure, so reflowed but otherwise identical content pairs up even
+    //! when the measures sit at different ticks
+    using ItemKey = std::tuple<int, int, int>;
+    auto keyOf = [](const EngravingItem* item, const Measure* m) {
+        return ItemKey(int(item->type()), int(item->track()), (item->tick() - m->tick()).ticks());
+    };
+
+    std::multimap<ItemKey, size_t> beforeByKey;
+    for (size_t i = 0; i < beforeItems.size(); ++i) {
+        beforeByKey.emplace(keyOf(beforeItems[i], before), i);
+    }
+
+    std::vector<bool> matched(beforeItems.size(), false);
+
+    for (const EngravingItem* afterItem : afterItems) {
+        auto range = beforeByKey.equal_range(keyOf(afterItem, after));
+        const EngravingItem* beforeItem = nullptr;
+        for (auto it = range.first; it != range.second; ++it) {
+            if (!matched[it->second]) {
+                matched[it->second] = true;
+                beforeItem = beforeItems[it->second];
+                break;
+            }
+        }
+
+        if (!beforeItem) {
+            addEntry(ScoreDiffType::Added, nullptr, afterItem);
+            continue;
+        }
+
+        std::vector<Pid> pids = changedProperties(beforeItem, afterItem);
+        if (!pids.empty()) {
+            addEntry(ScoreDiffType::Changed, beforeItem, afterItem, std::move(pids));
+        }
+    }
+
+    for (size_t i = 0; i < beforeItems.size(); ++i) {
+        if (!matched[i]) {
+            addEntry(ScoreDiffType::Removed, beforeItems[i], nullptr);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   compute
+//---------------------------------------------------------
+
+void ScoreDiff::compute()
+{
+    m_entries.clear();
+
+    std::vector<const Measure*> a;
+    std::vector<const Measure*> b;
+    for (const Measure* m = m_before->firstMeasure(); m; m = m->nextMeasure()) {
+        a.push_back(m);
+    }
+    for (const Measure* m = m_after->firstMeasure(); m; m = m->nextMeasure()) {
+        b.push_back(m);
+    }
+
+    std::vector<size_t> ha(a.size());
+    std::vector<size_t> hb(b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        ha[i] = measureHash(a[i]);
+    }
+    for (size_t j = 0; j < b.size(); ++j) {
+        hb[j] = measureHash(b[j]);
+    }
+
+    //! NOTE alignment in the spirit of Heckel's diff: measures whose content
+    //! hash is unique on both sides become anchors, anchors are extended over
+    //! equal neighbours, and whatever remains between anchors is paired up in
+    //! order. All passes are linear(ish), no quadratic edit distance
+    struct Occurrence {
+        int count = 0;
+        size_t first = 0;
+    };
+
+    std::unordered_map<size_t, Occurrence> occA;
+    std::unordered_map<size_t, Occurrence> occB;
+    for (size_t i = 0; i < a.size(); ++i) {
+        Occurrence& o = occA[ha[i]];
+        ++o.count;
+        o.first = i;
+    }
+    for (size_t j = 0; j < b.size(); ++j) {
+        Occurrence& o = occB[hb[j]];
+        ++o.count;
+        o.first = j;
+    }
+
+    static constexpr int UNMATCHED = -1;
+    std::vector<int> matchA(a.size(), UNMATCHED);
+    std::vector<int> matchB(b.size(), UNMATCHED);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        auto ia = occA.find(ha[i]);
+        auto ib = occB.find(ha[i]);
+        if (ia->second.count == 1 && ib != occB.end() && ib->second.count == 1) {
+            matchA[i] = int(ib->second.first);
+            matchB[ib->second.first] = int(i);
+        }
+    }
+
+    // drop crossing anchors so the alignment stays monotonic
+    int lastJ = UNMATCHED;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (matchA[i] == UNMATCHED) {
+            continue;
+        }
+        if (matchA[i] <= lastJ) {
+            matchB[matchA[i]] = UNMATCHED;
+            matchA[i] = UNMATCHED;
+        } else {
+            lastJ = matchA[i];
+        }
+    }
+
+    // extend anchors over equal unmatched neighbours, forwards...
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (matchA[i] == UNMATCHED) {
+            continue;
+        }
+        size_t i2 = i + 1;
+        size_t j2 = size_t(matchA[i]) + 1;
+        while (i2 < a.size() && j2 < b.size()
+               && matchA[i2] == UNMATCHED && matchB[j2] == UNMATCHED
+               && ha[i2] == hb[j2]) {
+            matchA[i2] = int(j2);
+            matchB[j2] = int(i2);
+            ++i2;
+            ++j2;
+        }
+    }
+
+    // ...and backwards
+    for (size_t i = a.size(); i > 0; --i) {
+        if (matchA[i - 1] == UNMATCHED) {
+            continue;
+        }
+        size_t i2 = i - 1;
+        size_t j2 = size_t(matchA[i - 1]);
+        while (i2 > 0 && j2 > 0
+               && matchA[i2 - 1] == UNMATCHED && matchB[j2 - 1] == UNMATCHED
+               && ha[i2 - 1] == hb[j2 - 1]) {
+            matchA[i2 - 1] = int(j2 - 1);
+            matchB[j2 - 1] = int(i2 - 1);
+            --i2;
+            --j2;
+        }
+    }
+
+    // in-order sweep: emit added/removed measures, compare the rest pairwise
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.size() || j < b.size()) {
+        if (i < a.size() && matchA[i] != UNMATCHED) {
+            while (j < size_t(matchA[i])) {
+                addEntry(ScoreDiffType::Added, nullptr, b[j]);
+                ++j;
+            }
+            diffMeasures(a[i], b[j]);
+            ++i;
+            ++j;
+            continue;
+        }
+
+        bool afterFree = j < b.size() && matchB[j] == UNMATCHED;
+
+        if (i < a.size() && afterFree) {
+            diffMeasures(a[i], b[j]);
+            ++i;
+            ++j;
+        } else if (i < a.size()) {
+            addEntry(ScoreDiffType::Removed, a[i], nullptr);
+            ++i;
+        } else {
+            addEntry(ScoreDiffType::Added, nullptr, b[j]);
+            ++j;
+        }
+    }
+}
+} // namespace mu::engraving
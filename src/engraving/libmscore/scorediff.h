@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SCOREDIFF_H
+#define MU_ENGRAVING_SCOREDIFF_H
+
+#include <vector>
+
+#include "property.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class EngravingObject;
+class Measure;
+class Score;
+
+//---------------------------------------------------------
+//   ScoreDiffType
+//---------------------------------------------------------
+
+enum class ScoreDiffType : char {
+    Added,
+    Removed,
+    Changed
+};
+
+//---------------------------------------------------------
+//   ScoreDiffEntry
+//    one structural change; the item pointers refer into
+//    the compared scores and stay valid only as long as
+//    those scores do
+//---------------------------------------------------------
+
+struct ScoreDiffEntry {
+    ScoreDiffType type = ScoreDiffType::Changed;
+    const EngravingItem* before = nullptr;     // Removed, Changed
+    const EngravingItem* after = nullptr;      // Added, Changed
+    std::vector<Pid> changedProperties;        // Changed only
+};
+
+//---------------------------------------------------------
+//   ScoreDiff
+//    structural diff of two scores over the engraving
+//    tree: measures are aligned by content hash (so
+//    inserted or removed measures do not spoil everything
+//    behind them), aligned measures are compared element
+//    by element via the property system. Runs in near
+//    linear time in the total number of elements.
+//---------------------------------------------------------
+
+class ScoreDiff
+{
+public:
+    ScoreDiff(const Score* before, const Score* after);
+
+    void compute();
+
+    const std::vector<ScoreDiffEntry>& entries() const { return m_entries; }
+    bool equal() const { return m_entries.empty(); }
+
+private:
+    void diffMeasures(const Measure* before, const Measure* after);
+
+    void addEntry(ScoreDiffType type, const EngravingItem* before, const EngravingItem* after, std::vector<Pid>&& pids = {});
+
+    static void collectItems(const EngravingObject* obj, std::vector<const EngravingItem*>& items);
+    static size_t measureHash(const Measure* m);
+    static std::vector<Pid> changedProperties(const EngravingItem* before, const EngravingItem* after);
+
+    const Score* m_before = nullptr;
+    const Score* m_after = nullptr;
+
+    std::vector<ScoreDiffEntry> m_entries;
+};
+} // namespace mu::engraving
+
+#endif // MU_ENGRAVING_SCOREDIFF_H
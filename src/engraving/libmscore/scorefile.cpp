@@ -21,6 +21,7 @@
  */
 
 #include <cmath>
+#include <map>
 
 #include "io/file.h"
 #include "io/fileinfo.h"
@@ -492,7 +493,11 @@ void Score::writeSegments(XmlWriter& xml, track_idx_t strack, track_idx_t etrack
         }
     }
 
-    std::list<Spanner*> spanners;
+    // bucket the spanners by anchor tick, so the segment loop below only has to
+    // look at the ones anchored on the current segment instead of scanning the
+    // whole list for every track of every segment
+    std::multimap<Fraction, Spanner*> spannerStarts;
+    std::multimap<Fraction, Spanner*> spannerEnds;
     auto sl = spannerMap().findOverlapping(sseg->tick().ticks(), endTick.ticks());
     for (auto i : sl) {
         Spanner* s = i.value;
@@ -503,7 +508,8 @@ void Score::writeSegments(XmlWriter& xml, track_idx_t strack, track_idx_t etrack
         if (clip && s->isVolta() && s->systemFlag()) {
             continue;
         }
-        spanners.push_back(s);
+        spannerStarts.emplace(s->tick(), s);
+        spannerEnds.emplace(s->tick2(), s);
     }
 
     int lastTrackWritten = static_cast<int>(strack - 1);   // for counting necessary <voice> tags
@@ -576,24 +582,30 @@ void Score::writeSegments(XmlWriter& xml, track_idx_t strack, track_idx_t etrack
             // don't write spanners for multi measure rests
 
             if ((!(m && m->isMMRest())) && segment->isChordRestType()) {
-                for (Spanner* s : spanners) {
-                    if (s->track() == track) {
-                        bool end = false;
-                        if (s->anchor() == Spanner::Anchor::CHORD || s->anchor() == Spanner::Anchor::NOTE) {
-                            end = s->tick2() < endTick;
-                        } else {
-                            end = s->tick2() <= endTick;
-                        }
-                        if (s->tick() == segment->tick() && (!clip || end) && !s->isSlur()) {
-                            if (needMove) {
-                                voiceTagWritten |= writeVoiceMove(xml, segment, startTick, track, &lastTrackWritten);
-                                needMove = false;
-                            }
-                            s->writeSpannerStart(xml, segment, track);
+                auto startRange = spannerStarts.equal_range(segment->tick());
+                for (auto it = startRange.first; it != startRange.second; ++it) {
+                    Spanner* s = it->second;
+                    if (s->track() != track || s->isSlur()) {
+                        continue;
+                    }
+                    bool end = false;
+                    if (s->anchor() == Spanner::Anchor::CHORD || s->anchor() == Spanner::Anchor::NOTE) {
+                        end = s->tick2() < endTick;
+                    } else {
+                        end = s->tick2() <= endTick;
+                    }
+                    if (!clip || end) {
+                        if (needMove) {
+                            voiceTagWritten |= writeVoiceMove(xml, segment, startTick, track, &lastTrackWritten);
+                            needMove = false;
                         }
+                        s->writeSpannerStart(xml, segment, track);
                     }
-                    if ((s->tick2() == segment->tick())
-                        && !s->isSlur()
+                }
+                auto endRange = spannerEnds.equal_range(segment->tick());
+                for (auto it = endRange.first; it != endRange.second; ++it) {
+                    Spanner* s = it->second;
+                    if (!s->isSlur()
                         && (s->effectiveTrack2() == track)
                         && (!clip || s->tick() >= sseg->tick())
                         ) {
@@ -666,9 +678,10 @@ void Score::writeSegments(XmlWriter& xml, track_idx_t strack, track_idx_t etrack
 
         //write spanner ending after the last segment, on the last tick
         if (clip || eseg == 0) {
-            for (Spanner* s : spanners) {
-                if ((s->tick2() == endTick)
-                    && !s->isSlur()
+            auto endRange = spannerEnds.equal_range(endTick);
+            for (auto it = endRange.first; it != endRange.second; ++it) {
+                Spanner* s = it->second;
+                if (!s->isSlur()
                     && (s->track2() == track || (s->track2() == mu::nidx && s->track() == track))
                     && (!clip || s->tick() >= sseg->tick())
                     ) {
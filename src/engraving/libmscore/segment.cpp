@@ -249,6 +249,7 @@ void Segment::init()
     size_t tracks = staves * VOICES;
     _elist.assign(tracks, 0);
     _preAppendedItems.assign(tracks, 0);
+    ++_shapesVersion;
     _shapes.assign(staves, Shape());
 }
 
@@ -505,6 +506,7 @@ void Segment::insertStaff(staff_idx_t staff)
         _elist.insert(_elist.begin() + track, 0);
         _preAppendedItems.insert(_preAppendedItems.begin() + track, 0);
     }
+    ++_shapesVersion;
     _shapes.insert(_shapes.begin() + staff, Shape());
 
     for (EngravingItem* e : _annotations) {
@@ -524,6 +526,7 @@ void Segment::removeStaff(staff_idx_t staff)
     track_idx_t track = staff * VOICES;
     _elist.erase(_elist.begin() + track, _elist.begin() + track + VOICES);
     _preAppendedItems.erase(_preAppendedItems.begin() + track, _preAppendedItems.begin() + track + VOICES);
+    ++_shapesVersion;
     _shapes.erase(_shapes.begin() + staff);
 
     for (EngravingItem* e : _annotations) {
@@ -2256,6 +2259,7 @@ void Segment::createShapes()
 
 void Segment::createShape(staff_idx_t staffIdx)
 {
+    ++_shapesVersion;
     Shape& s = _shapes[staffIdx];
     s.clear();
 
@@ -2528,11 +2532,16 @@ double Segment::spacing() const
 
 double Segment::minHorizontalCollidingDistance(Segment* ns) const
 {
+    if (shapeDistanceCacheValid(_collidingDistanceCache, ns)) {
+        return _collidingDistanceCache.distance;
+    }
+
     double w = -100000.0; // This can remain negative in some cases (for instance, mid-system clefs)
     for (unsigned staffIdx = 0; staffIdx < _shapes.size(); ++staffIdx) {
         double d = staffShape(staffIdx).minHorizontalDistance(ns->staffShape(staffIdx), score());
         w       = std::max(w, d);
     }
+    storeShapeDistanceCache(_collidingDistanceCache, ns, w);
     return w;
 }
 
@@ -2621,15 +2630,24 @@ double Segment::minHorizontalDistance(Segment* ns, bool systemHeaderGap) const
         return minWidth;
     }
     double ww = -1000000.0;          // can remain negative
-    double d = 0.0;
-    for (unsigned staffIdx = 0; staffIdx < _shapes.size(); ++staffIdx) {
-        d = ns ? staffShape(staffIdx).minHorizontalDistance(ns->staffShape(staffIdx), score()) : 0.0;
-        // first chordrest of a staff should clear the widest header for any staff
-        // so make sure segment is as wide as it needs to be
-        if (systemHeaderGap) {
-            d = std::max(d, staffShape(staffIdx).right());
+    if (!systemHeaderGap && ns && shapeDistanceCacheValid(_minDistanceCache, ns)) {
+        ww = _minDistanceCache.distance;
+    } else {
+        double d = 0.0;
+        for (unsigned staffIdx = 0; staffIdx < _shapes.size(); ++staffIdx) {
+            d = ns ? staffShape(staffIdx).minHorizontalDistance(ns->staffShape(staffIdx), score()) : 0.0;
+            // first chordrest of a staff should clear the widest header for any staff
+            // so make sure segment is as wide as it needs to be
+            if (systemHeaderGap) {
+                d = std::max(d, staffShape(staffIdx).right());
+            }
+            ww      = std::max(ww, d);
+        }
+        //! NOTE the header variant mixes in staffShape(...).right(), so only the
+        //! common non-header result is cached
+        if (!systemHeaderGap && ns) {
+            storeShapeDistanceCache(_minDistanceCache, ns, ww);
         }
-        ww      = std::max(ww, d);
     }
     double w = std::max(ww, 0.0);        // non-negative
 
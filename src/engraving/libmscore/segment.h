@@ -101,6 +101,35 @@ class Segment final : public EngravingItem
 
     CrossBeamType _crossBeamType; // Will affect segment-to-segment horizontal spacing
 
+    //! NOTE The shape-vs-shape distance to a neighbouring segment is queried
+    //! repeatedly while a system is being stretched and justified, but it only
+    //! changes when the shapes of one of the two segments change. Every shape
+    //! mutation bumps _shapesVersion; a cached distance is valid while the
+    //! versions recorded at computation time still match on both sides.
+    struct ShapeDistanceCache {
+        const Segment* to = nullptr;
+        unsigned version = 0;
+        unsigned toVersion = 0;
+        double distance = 0.0;
+    };
+
+    mutable unsigned _shapesVersion = 0;
+    mutable ShapeDistanceCache _minDistanceCache;
+    mutable ShapeDistanceCache _collidingDistanceCache;
+
+    bool shapeDistanceCacheValid(const ShapeDistanceCache& cache, const Segment* ns) const
+    {
+        return cache.to == ns && cache.version == _shapesVersion && cache.toVersion == ns->_shapesVersion;
+    }
+
+    void storeShapeDistanceCache(ShapeDistanceCache& cache, const Segment* ns, double distance) const
+    {
+        cache.to = ns;
+        cache.version = _shapesVersion;
+        cache.toVersion = ns->_shapesVersion;
+        cache.distance = distance;
+    }
+
     friend class Factory;
     Segment(Measure* m = 0);
     Segment(Measure*, SegmentType, const Fraction&);
@@ -269,7 +298,7 @@ public:
     std::vector<Shape> shapes() { return _shapes; }
     const std::vector<Shape>& shapes() const { return _shapes; }
     const Shape& staffShape(staff_idx_t staffIdx) const { return _shapes[staffIdx]; }
-    Shape& staffShape(staff_idx_t staffIdx) { return _shapes[staffIdx]; }
+    Shape& staffShape(staff_idx_t staffIdx) { ++_shapesVersion; return _shapes[staffIdx]; }
     void createShapes();
     void createShape(staff_idx_t staffIdx);
     double minRight() const;
@@ -474,7 +474,7 @@ void Selection::appendChord(Chord* chord)
         LOGE() << "selection locked, reason: " << lockReason();
         return;
     }
-    if (chord->beam() && !mu::contains(_el, static_cast<EngravingItem*>(chord->beam()))) {
+    if (chord->beam() && _appendedBeams.insert(chord->beam()).second) {
         _el.push_back(chord->beam());
     }
     if (chord->stem()) {
@@ -564,6 +564,7 @@ void Selection::updateSelectedElements()
         e->setSelected(false);
     }
     _el.clear();
+    _appendedBeams.clear();
 
     // assert:
     size_t staves = _score->nstaves();
@@ -576,19 +577,27 @@ void Selection::updateSelectedElements()
     track_idx_t startTrack = _staffStart * VOICES;
     track_idx_t endTrack   = _staffEnd * VOICES;
 
-    for (track_idx_t st = startTrack; st < endTrack; ++st) {
-        if (!canSelectVoice(st)) {
+    //! NOTE the filter is applied while traversing, not after: the segment
+    //! chain is walked once (instead of once per track), a segment's
+    //! annotation list is scanned a single time, and fully filtered voices
+    //! are skipped per track slot. With the common "voice 1 only" filter the
+    //! traversal cost now drops with the number of filtered voices
+    for (Segment* s = _startSegment; s && (s != _endSegment); s = s->next1MM()) {
+        if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
             continue;
         }
-        for (Segment* s = _startSegment; s && (s != _endSegment); s = s->next1MM()) {
-            if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
+        for (EngravingItem* e : s->annotations()) {
+            if (e->track() < startTrack || e->track() >= endTrack) {
                 continue;
             }
-            for (EngravingItem* e : s->annotations()) {
-                if (e->track() != st) {
-                    continue;
-                }
-                appendFiltered(e);
+            if (!canSelectVoice(e->track())) {
+                continue;
+            }
+            appendFiltered(e);
+        }
+        for (track_idx_t st = startTrack; st < endTrack; ++st) {
+            if (!canSelectVoice(st)) {
+                continue;
             }
             EngravingItem* e = s->element(st);
             if (!e || e->generated() || e->isTimeSig() || e->isKeySig()) {
@@ -23,12 +23,15 @@
 #ifndef __SELECT_H__
 #define __SELECT_H__
 
+#include <set>
+
 #include "durationtype.h"
 #include "mscore.h"
 #include "pitchspelling.h"
 #include "types.h"
 
 namespace mu::engraving {
+class Beam;
 class Score;
 class Page;
 class System;
@@ -174,6 +177,11 @@ class Selection
 
     String _lockReason;
 
+    //! NOTE scratch set, only valid while updateSelectedElements() runs;
+    //! beams are shared between chords, so they need deduplication, and
+    //! scanning _el for each of them made range selection quadratic
+    std::set<const Beam*> _appendedBeams;
+
     mu::ByteArray staffMimeData() const;
     mu::ByteArray symbolListMimeData() const;
     SelectionFilter selectionFilter() const;
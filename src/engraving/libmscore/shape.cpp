@@ -22,6 +22,8 @@
 
 #include "shape.h"
 
+#include <vector>
+
 #include "score.h"
 
 #include "draw/painter.h"
@@ -143,22 +145,44 @@ double Shape::minVerticalDistance(const Shape& a) const
         return 0.0;
     }
 
+    // This is the hottest function of layout. Gather the coordinates of the
+    // non-degenerate rects into flat arrays once, so that the pairwise
+    // comparison below runs branch-free over contiguous doubles and the
+    // compiler can vectorize it. The buffers are reused across calls to
+    // avoid allocating on every invocation.
+    static thread_local std::vector<double> ax1;
+    static thread_local std::vector<double> ax2;
+    static thread_local std::vector<double> ay2;
+    ax1.clear();
+    ax2.clear();
+    ay2.clear();
+    for (const RectF& r1 : *this) {
+        if (r1.height() <= 0.0) {
+            continue;
+        }
+        ax1.push_back(r1.left());
+        ax2.push_back(r1.right());
+        ay2.push_back(r1.bottom());
+    }
+
     double dist = -1000000.0; // min real
+    const size_t n = ax1.size();
     for (const RectF& r2 : a) {
         if (r2.height() <= 0.0) {
             continue;
         }
-        double bx1 = r2.left();
-        double bx2 = r2.right();
-        for (const RectF& r1 : *this) {
-            if (r1.height() <= 0.0) {
-                continue;
-            }
-            double ax1 = r1.left();
-            double ax2 = r1.right();
-            if (mu::engraving::intersects(ax1, ax2, bx1, bx2, 0.0)) {
-                dist = std::max(dist, r1.bottom() - r2.top());
-            }
+        const double bx1 = r2.left();
+        const double bx2 = r2.right();
+        if (bx1 == bx2) { // zero width, cannot overlap horizontally
+            continue;
+        }
+        const double by1 = r2.top();
+        for (size_t i = 0; i < n; ++i) {
+            // same test as mu::engraving::intersects(ax1, ax2, bx1, bx2, 0.0),
+            // written so that the loop body has no early exits
+            const bool overlaps = (ax2[i] > bx1) && (ax1[i] < bx2) && (ax1[i] != ax2[i]);
+            const double d = ay2[i] - by1;
+            dist = (overlaps && d > dist) ? d : dist;
         }
     }
     return dist;
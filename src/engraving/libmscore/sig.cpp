@@ -21,6 +21,9 @@
  */
 
 #include "sig.h"
+
+#include <algorithm>
+
 #include "rw/xml.h"
 
 #include "log.h"
@@ -268,6 +271,29 @@ void TimeSigMap::clearRange(int tick1, int tick2)
     normalize();
 }
 
+//---------------------------------------------------------
+//   insertTime
+//    Moves all events at or after tick by len. For negative
+//    len the events in the removed range are deleted first.
+//---------------------------------------------------------
+
+void TimeSigMap::insertTime(int tick, int len)
+{
+    if (len == 0) {
+        return;
+    }
+    if (len < 0) {
+        erase(lower_bound(tick), lower_bound(tick - len));
+    }
+    std::map<int, SigEvent> shifted;
+    for (auto i = lower_bound(tick); i != end();) {
+        shifted[i->first + len] = i->second;
+        erase(i++);
+    }
+    insert(shifted.begin(), shifted.end());
+    normalize();
+}
+
 //---------------------------------------------------------
 //   TimeSigMap::normalize
 //---------------------------------------------------------
@@ -287,6 +313,7 @@ void TimeSigMap::normalize()
         tick = i->first;
         tm   = ticks_measure(e.timesig());
     }
+    ++_serial;
 }
 
 //---------------------------------------------------------
@@ -580,4 +607,72 @@ int TimeSigFrac::dUnitTicks() const
 {
     return (4 * Constants::division) / denominator();
 }
+
+//---------------------------------------------------------
+//   TimeSigCursor::sync
+//    rebuild the flattened snapshot if the map changed
+//---------------------------------------------------------
+
+void TimeSigCursor::sync()
+{
+    if (m_serial == m_map->serial()) {
+        return;
+    }
+
+    m_spans.clear();
+    m_spans.reserve(m_map->size());
+
+    for (const auto& p : *m_map) {
+        Span s;
+        s.tick   = p.first;
+        s.bar    = p.second.bar();
+        s.ticksB = ticks_beat(p.second.timesig().denominator());
+        s.ticksM = s.ticksB * p.second.timesig().numerator();
+        m_spans.push_back(s);
+    }
+
+    m_pos = 0;
+    m_serial = m_map->serial();
+}
+
+//---------------------------------------------------------
+//   TimeSigCursor::tickValues
+//---------------------------------------------------------
+
+void TimeSigCursor::tickValues(int t, int* bar, int* beat, int* tick)
+{
+    sync();
+
+    if (m_spans.empty()) {
+        *bar  = 0;
+        *beat = 0;
+        *tick = 0;
+        return;
+    }
+
+    // reposition: O(1) amortized going forward, O(log n) after a jump back
+    if (t < m_spans[m_pos].tick) {
+        auto it = std::upper_bound(m_spans.begin(), m_spans.end(), t, [](int tk, const Span& s) {
+            return tk < s.tick;
+        });
+        m_pos = (it == m_spans.begin()) ? 0 : size_t(it - m_spans.begin() - 1);
+    }
+    while (m_pos + 1 < m_spans.size() && m_spans[m_pos + 1].tick <= t) {
+        ++m_pos;
+    }
+
+    const Span& s = m_spans[m_pos];
+    if (s.ticksM == 0) {
+        *bar  = 0;
+        *beat = 0;
+        *tick = 0;
+        return;
+    }
+
+    int delta = t - s.tick;
+    *bar      = s.bar + delta / s.ticksM;
+    int rest  = delta % s.ticksM;
+    *beat     = rest / s.ticksB;
+    *tick     = rest % s.ticksB;
+}
 }
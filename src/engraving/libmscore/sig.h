@@ -24,6 +24,7 @@
 #define __AL_SIG_H__
 
 #include <map>
+#include <vector>
 #include <cassert>
 
 #include "global/allocator.h"
@@ -145,17 +146,22 @@ class TimeSigMap : public std::map<int, SigEvent>
 {
     OBJECT_ALLOCATOR(engraving, TimeSigMap)
 
+    int _serial = 1;   // serial no to track time signature changes
+
     void normalize();
 
 public:
     TimeSigMap() {}
 
+    int serial() const { return _serial; }
+
     void add(int tick, const Fraction&);
     void add(int tick, const SigEvent& ev);
 
     void del(int tick);
 
     void clearRange(int tick1, int tick2);
+    void insertTime(int tick, int len);
 
     void read(XmlReader&, int fileDiv);
     void write(XmlWriter&) const;
@@ -173,5 +179,39 @@ public:
     unsigned raster2(unsigned tick, int raster) const;      // round up
     int rasterStep(unsigned tick, int raster) const;
 };
+
+//---------------------------------------------------------
+//   TimeSigCursor
+//    bar/beat/tick decomposition for consumers that query
+//    in (mostly) increasing tick order, e.g. the timeline.
+//    Works like TempoCursor: the map is flattened into an
+//    array snapshot carried with a position between calls,
+//    revalidated against the map's serial number on every
+//    query.
+//---------------------------------------------------------
+
+class TimeSigCursor
+{
+public:
+    explicit TimeSigCursor(const TimeSigMap* map)
+        : m_map(map) {}
+
+    void tickValues(int t, int* bar, int* beat, int* tick);
+
+private:
+    struct Span {
+        int tick = 0;     // tick of the time signature event
+        int bar = 0;      // precomputed bar index at tick
+        int ticksB = 0;   // ticks per beat
+        int ticksM = 0;   // ticks per measure
+    };
+
+    void sync();
+
+    const TimeSigMap* m_map = nullptr;
+    int m_serial = -1;
+    std::vector<Span> m_spans;
+    size_t m_pos = 0;
+};
 } // namespace mu::engraving
 #endif
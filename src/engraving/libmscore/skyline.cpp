@@ -78,9 +78,8 @@ int findSpan(const ShapeElement& r)
 
 void Skyline::add(const ShapeElement& r)
 {
-    int span = findSpan(r);
-    _north.add(r.x(), r.top(), r.width(), span);
-    _south.add(r.x(), r.bottom(), r.width(), span);
+    _north.add(r);
+    _south.add(r);
 }
 
 //---------------------------------------------------------
@@ -139,11 +138,8 @@ void SkylineLine::add(const Shape& s)
 void SkylineLine::add(const ShapeElement& r)
 {
     int span = findSpan(r);
-    if (north) {
-        add(r.x(), r.top(), r.width(), span);
-    } else {
-        add(r.x(), r.bottom(), r.width(), span);
-    }
+    const double y = north ? r.top() : r.bottom();
+    merge(r.x(), y, r.width(), span);
 }
 
 void Skyline::add(const Shape& s)
@@ -154,6 +150,16 @@ void Skyline::add(const Shape& s)
 }
 
 void SkylineLine::add(double x, double y, double w, int span)
+{
+    merge(x, y, w, span);
+}
+
+//---------------------------------------------------------
+//   merge
+//    fold one contribution into the envelope
+//---------------------------------------------------------
+
+void SkylineLine::merge(double x, double y, double w, int span)
 {
 //      assert(w >= 0.0);
     if (x < 0.0) {
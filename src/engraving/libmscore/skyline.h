@@ -65,6 +65,8 @@ class SkylineLine
     SegIter find(double x);
     SegConstIter find(double x) const;
 
+    void merge(double x, double y, double w, int span);
+
 public:
     SkylineLine(bool n)
         : north(n) {}
@@ -21,6 +21,9 @@
  */
 
 #include "spannermap.h"
+
+#include <algorithm>
+
 #include "spanner.h"
 #include "part.h"
 
@@ -53,16 +56,59 @@ void SpannerMap::update() const
 
     tree = interval_tree::IntervalTree<Spanner*>(regularIntervals);
     collisionFreeTree = interval_tree::IntervalTree<Spanner*>(collisionFreeIntervals);
+    pendingAdded.clear();
+    pendingRemoved.clear();
     dirty = false;
 }
 
+//---------------------------------------------------------
+//   pendingOverflow
+//    once the overlay gets big the per-query linear scan
+//    costs more than a rebuild would
+//---------------------------------------------------------
+
+bool SpannerMap::pendingOverflow() const
+{
+    static constexpr size_t MAX_PENDING_CHANGES = 64;
+    return pendingAdded.size() + pendingRemoved.size() > MAX_PENDING_CHANGES;
+}
+
+//---------------------------------------------------------
+//   applyPendingToResults
+//    patch a tree query result with the changes that are
+//    not in the tree yet
+//---------------------------------------------------------
+
+void SpannerMap::applyPendingToResults(int start, int stop, bool contained) const
+{
+    if (!pendingRemoved.empty()) {
+        results.erase(std::remove_if(results.begin(), results.end(), [this](const interval_tree::Interval<Spanner*>& in) {
+            return pendingRemoved.find(in.value) != pendingRemoved.end();
+        }), results.end());
+    }
+
+    for (Spanner* s : pendingAdded) {
+        const int sstart = s->tick().ticks();
+        const int sstop = s->tick2().ticks();
+        const bool matches = contained
+                             ? (sstart >= start && sstop <= stop)
+                             : (sstop >= start && sstart <= stop);
+        if (matches) {
+            results.push_back(interval_tree::Interval<Spanner*>(sstart, sstop, s));
+        }
+    }
+}
+
 //---------------------------------------------------------
 //   findContained
 //---------------------------------------------------------
 
 const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
+    //!Note The collision trimming in collectIntervals() depends on the whole
+    //!     neighbourhood of a spanner, so collision-free queries cannot be
+    //!     patched from the overlay and force a rebuild instead.
+    if (dirty || (excludeCollisions && hasPendingChanges())) {
         update();
     }
 
@@ -72,6 +118,7 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
         collisionFreeTree.findContained(start, stop, results);
     } else {
         tree.findContained(start, stop, results);
+        applyPendingToResults(start, stop, true);
     }
 
     return results;
@@ -83,7 +130,7 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
 
 const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
+    if (dirty || (excludeCollisions && hasPendingChanges())) {
         update();
     }
 
@@ -93,6 +140,7 @@ const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop,
         collisionFreeTree.findOverlapping(start, stop, results);
     } else {
         tree.findOverlapping(start, stop, results);
+        applyPendingToResults(start, stop, false);
     }
 
     return results;
@@ -149,7 +197,13 @@ void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList&
 void SpannerMap::addSpanner(Spanner* s)
 {
     insert(std::pair<int, Spanner*>(s->tick().ticks(), s));
-    dirty = true;
+    if (dirty) {
+        return; // the tree will be rebuilt on the next query anyway
+    }
+    pendingAdded.push_back(s);
+    if (pendingOverflow()) {
+        dirty = true;
+    }
 }
 
 //---------------------------------------------------------
@@ -161,7 +215,17 @@ bool SpannerMap::removeSpanner(Spanner* s)
     for (auto i = begin(); i != end(); ++i) {
         if (i->second == s) {
             erase(i);
-            dirty = true;
+            if (!dirty) {
+                auto added = std::find(pendingAdded.begin(), pendingAdded.end(), s);
+                if (added != pendingAdded.end()) {
+                    pendingAdded.erase(added);
+                } else {
+                    pendingRemoved.insert(s);
+                }
+                if (pendingOverflow()) {
+                    dirty = true;
+                }
+            }
             return true;
         }
     }
@@ -24,6 +24,7 @@
 #define __SPANNERMAP_H__
 
 #include <map>
+#include <set>
 #include "thirdparty/intervaltree/IntervalTree.h"
 
 namespace mu::engraving {
@@ -40,6 +41,16 @@ class SpannerMap : std::multimap<int, Spanner*>
     mutable interval_tree::IntervalTree<Spanner*> collisionFreeTree;
     mutable std::vector<interval_tree::Interval<Spanner*> > results;
 
+    // spanners added/removed since the last tree rebuild; small edits are
+    // served from this overlay so a single add does not force an
+    // O(n log n) rebuild of the whole tree on the next query
+    mutable std::vector<Spanner*> pendingAdded;
+    mutable std::set<Spanner*> pendingRemoved;
+
+    bool hasPendingChanges() const { return !pendingAdded.empty() || !pendingRemoved.empty(); }
+    bool pendingOverflow() const;
+    void applyPendingToResults(int start, int stop, bool contained) const;
+
 public:
     typedef typename std::multimap<int, Spanner*>::const_reverse_iterator const_reverse_it;
     typedef typename std::multimap<int, Spanner*>::const_iterator const_it;
@@ -60,7 +71,7 @@ public:
     const_it cend() const { return std::multimap<int, Spanner*>::cend(); }
     void addSpanner(Spanner* s);
     bool removeSpanner(Spanner* s);
-    void clear() { std::multimap<int, Spanner*>::clear(); dirty = true; }
+    void clear() { std::multimap<int, Spanner*>::clear(); pendingAdded.clear(); pendingRemoved.clear(); dirty = true; }
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
     void setDirty() const { dirty = true; }     // must be called if a spanner changes start/length
@@ -680,6 +680,33 @@ void Staff::clearTimeSig()
     timesigs.clear();
 }
 
+//---------------------------------------------------------
+//   moveTimeSigs
+//    moves all time signature entries at or after tick by
+//    len; for negative len the entries in the removed range
+//    are deleted first
+//---------------------------------------------------------
+
+void Staff::moveTimeSigs(const Fraction& tick, const Fraction& len)
+{
+    if (len.isZero()) {
+        return;
+    }
+
+    if (len < Fraction(0, 1)) {
+        timesigs.erase(timesigs.lower_bound(tick.ticks()), timesigs.lower_bound((tick - len).ticks()));
+    }
+
+    std::map<int, TimeSig*> ts2;
+    for (auto i = timesigs.lower_bound(tick.ticks()); i != timesigs.end();) {
+        TimeSig* ts = i->second;
+        Fraction t = Fraction::fromTicks(i->first);
+        timesigs.erase(i++);
+        ts2[(t + len).ticks()] = ts;
+    }
+    timesigs.insert(ts2.begin(), ts2.end());
+}
+
 //---------------------------------------------------------
 //   Staff::keySigEvent
 //
@@ -1645,7 +1672,23 @@ bool Staff::setProperty(Pid id, const PropertyValue& v)
         LOGD("unhandled id <%s>", propertyName(id));
         break;
     }
-    triggerLayout();
+
+    switch (id) {
+    case Pid::PLAYBACK_VOICE1:
+    case Pid::PLAYBACK_VOICE2:
+    case Pid::PLAYBACK_VOICE3:
+    case Pid::PLAYBACK_VOICE4:
+        // playback routing only, nothing moves on the page
+        score()->setPlaylistDirty();
+        break;
+    case Pid::STAFF_COLOR:
+        // a repaint is enough, shapes are unaffected
+        score()->setUpdateAll();
+        break;
+    default:
+        triggerLayout();
+        break;
+    }
     return true;
 }
 
@@ -177,6 +177,7 @@ public:
     void addTimeSig(TimeSig*);
     void removeTimeSig(TimeSig*);
     void clearTimeSig();
+    void moveTimeSigs(const Fraction& tick, const Fraction& len);
     Fraction timeStretch(const Fraction&) const;
     TimeSig* timeSig(const Fraction&) const;
     TimeSig* nextTimeSig(const Fraction&) const;
@@ -508,6 +508,8 @@ void StaffType::setDurationMetrics() const
         return;
     }
 
+    _durationWidthCache.clear();
+
 // FontMetrics returns results unreliably rounded to integral pixels;
 // use a scaled up font and then scale computed values down
     mu::draw::Font font(durationFont());
@@ -537,6 +539,8 @@ void StaffType::setFretMetrics() const
         return;
     }
 
+    _fretWidthCache.clear();
+
     mu::draw::FontMetrics fm(fretFont());
     RectF bb;
     // compute vertical displacement
@@ -574,6 +578,46 @@ void StaffType::setFretMetrics() const
     _fretMetricsValid = true;
 }
 
+//---------------------------------------------------------
+//   durationMarkWidth
+//    width of a duration symbol in the duration font;
+//    widths are cached per distinct symbol text, so that layout
+//    does not query the font metrics for every symbol
+//---------------------------------------------------------
+
+double StaffType::durationMarkWidth(const String& mark) const
+{
+    setDurationMetrics();         // empties the cache if the font setup changed
+    auto i = _durationWidthCache.find(mark);
+    if (i != _durationWidthCache.end()) {
+        return i->second;
+    }
+    double w = mu::draw::FontMetrics::width(durationFont(), mark);
+    _durationWidthCache.insert({ mark, w });
+    return w;
+}
+
+//---------------------------------------------------------
+//   fretMarkWidth
+//    width of a fret mark in the fret font;
+//    widths are cached per distinct mark text, so that layout
+//    does not query the font metrics for every note
+//---------------------------------------------------------
+
+double StaffType::fretMarkWidth(const String& mark) const
+{
+    setFretMetrics();             // empties the cache if the font setup changed
+    auto i = _fretWidthCache.find(mark);
+    if (i != _fretWidthCache.end()) {
+        return i->second;
+    }
+    mu::draw::Font f(_fretFont);
+    f.setPointSizeF(_fretFontSize);
+    double w = mu::draw::FontMetrics::width(f, mark);
+    _fretWidthCache.insert({ mark, w });
+    return w;
+}
+
 //---------------------------------------------------------
 //   setDurationFontName / setFretFontName
 //---------------------------------------------------------
@@ -1015,9 +1059,8 @@ void TabDurationSymbol::layout()
     if (!chord || !chord->isChord()
         || (chord->beamMode() != BeamMode::BEGIN && chord->beamMode() != BeamMode::MID
             && chord->beamMode() != BeamMode::END)) {
-        mu::draw::FontMetrics fm(_tab->durationFont());
         hbb   = _tab->durationBoxH();
-        wbb   = fm.width(_text);
+        wbb   = _tab->durationMarkWidth(_text);
         xbb   = 0.0;
         xpos  = 0.0;
         ypos  = _tab->durationFontYOffset();
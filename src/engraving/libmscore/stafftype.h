@@ -23,6 +23,8 @@
 #ifndef __STAFFTYPE_H__
 #define __STAFFTYPE_H__
 
+#include <unordered_map>
+
 #include "draw/types/color.h"
 #include "draw/types/font.h"
 
@@ -265,6 +267,8 @@ class StaffType
     // and the metrics of the fret font
     mutable bool _fretMetricsValid = false;       // whether fret font metrics are valid or not
     mutable double _refDPI = 0.0;                  // reference value used to last computed metrics and to see if they are still valid
+    mutable std::unordered_map<String, double> _fretWidthCache;   // fret mark widths in the fret font, keyed by mark text
+    mutable std::unordered_map<String, double> _durationWidthCache;   // same, for duration symbols in the duration font
 
     // the array of configured fonts
     static std::vector<TablatureFretFont> _fretFonts;
@@ -360,6 +364,7 @@ public:
     // properties getters (some getters require updated metrics)
     double durationBoxH() const;
     double durationBoxY() const;
+    double durationMarkWidth(const String& mark) const;
 
     const mu::draw::Font& durationFont() const { return _durationFont; }
     const String durationFontName() const { return _durationFonts[_durationFontIdx].displayName; }
@@ -369,6 +374,7 @@ public:
     double durationGridYOffset() const { setDurationMetrics(); return _durationGridYOffset; }
     double fretBoxH() const { setFretMetrics(); return _fretBoxH; }
     double fretBoxY() const { setFretMetrics(); return _fretBoxY + _fretFontUserY * SPATIUM20; }
+    double fretMarkWidth(const String& mark) const;
 
     // 2 methods to return the size of a box masking lines under a fret mark
     double fretMaskH() const { return _lineDistance.val() * SPATIUM20; }
@@ -105,6 +105,42 @@ void SysStaff::restoreLayout()
     bbox().setHeight(_height);
 }
 
+//---------------------------------------------------------
+//   nextSkylineGen
+//    globally unique stamp for skyline mutation states;
+//    taken anew on every mutable skyline() access
+//---------------------------------------------------------
+
+uint64_t SysStaff::nextSkylineGen()
+{
+    static uint64_t gen = 0;
+    return ++gen;
+}
+
+//---------------------------------------------------------
+//   skylineDistance
+//    Skyline::minDistance() to a staff laid out below this
+//    one, memoized on the mutation stamps of both skylines.
+//    Vertical spacing asks for the same distances several
+//    times per layout pass (cross-beam precalculation,
+//    staff distances, page filling) while the skylines
+//    rarely change in between; the stamps are globally
+//    unique, so a hit is valid even if the partner staff
+//    differs between calls.
+//---------------------------------------------------------
+
+double SysStaff::skylineDistance(const SysStaff* below)
+{
+    if (_cachedDistSelfGen == _skylineGen && _cachedDistBelowGen == below->_skylineGen) {
+        return _cachedDistBelow;
+    }
+
+    _cachedDistBelow = _skyline.minDistance(below->_skyline);
+    _cachedDistSelfGen = _skylineGen;
+    _cachedDistBelowGen = below->_skylineGen;
+    return _cachedDistBelow;
+}
+
 //---------------------------------------------------------
 //   System
 //---------------------------------------------------------
@@ -977,7 +1013,7 @@ void System::layout2(const LayoutContext& ctx)
             // the result is space is good to start and grows as needed
             // it does not, however, shrink when possible - only by trigger a full layout
             // (such as by toggling to page view and back)
-            double d = ss->skyline().minDistance(System::staff(si2)->skyline());
+            double d = ss->skylineDistance(System::staff(si2));
             if (score()->lineMode()) {
                 double previousDist = ss->continuousDist();
                 if (d > previousDist) {
@@ -1661,7 +1697,7 @@ double System::minDistance(System* s2) const
         }
 
         SysStaff* sysStaff = this->staff(lastStaff);
-        double sld = sysStaff ? sysStaff->skyline().minDistance(s2->staff(firstStaff)->skyline()) : 0;
+        double sld = sysStaff ? sysStaff->skylineDistance(s2->staff(firstStaff)) : 0;
         sld -= sysStaff ? sysStaff->bbox().height() - minVerticalDistance : 0;
         dist = std::max(dist, sld);
     }
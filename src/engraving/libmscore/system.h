@@ -57,6 +57,16 @@ class SysStaff
     double _continuousDist { -1.0 }; // distance for continuous mode
     bool _show  { true };           // derived from Staff or false if empty
                                     // staff is hidden
+
+    // memoized result of skylineDistance(); the generation stamps identify
+    // the exact skyline states the cached value was computed from
+    uint64_t _skylineGen = nextSkylineGen();
+    uint64_t _cachedDistSelfGen { 0 };
+    uint64_t _cachedDistBelowGen { 0 };
+    double _cachedDistBelow { 0.0 };
+
+    static uint64_t nextSkylineGen();
+
 public:
     //int idx     { 0    };
     std::vector<InstrumentName*> instrumentNames;
@@ -79,7 +89,9 @@ public:
     void setShow(bool v) { _show = v; }
 
     const Skyline& skyline() const { return _skyline; }
-    Skyline& skyline() { return _skyline; }
+    Skyline& skyline() { _skylineGen = nextSkylineGen(); return _skyline; }
+
+    double skylineDistance(const SysStaff* below);
 
     SysStaff() {}
     ~SysStaff();
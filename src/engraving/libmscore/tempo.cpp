@@ -22,6 +22,7 @@
 
 #include "tempo.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "rw/xml.h"
@@ -173,6 +174,29 @@ void TempoMap::clearRange(int tick1, int tick2)
     ++_tempoSN;
 }
 
+//---------------------------------------------------------
+//   insertTime
+//    Moves all events at or after tick by len. For negative
+//    len the events in the removed range are deleted first.
+//---------------------------------------------------------
+
+void TempoMap::insertTime(int tick, int len)
+{
+    if (len == 0) {
+        return;
+    }
+    if (len < 0) {
+        erase(lower_bound(tick), lower_bound(tick - len));
+    }
+    std::map<int, TEvent> shifted;
+    for (auto i = lower_bound(tick); i != end();) {
+        shifted[i->first + len] = i->second;
+        erase(i++);
+    }
+    insert(shifted.begin(), shifted.end());
+    normalize();
+}
+
 //---------------------------------------------------------
 //   tempo
 //---------------------------------------------------------
@@ -349,4 +373,130 @@ int TempoMap::time2tick(double time, int* sn) const
     }
     return tick;
 }
+
+//---------------------------------------------------------
+//   TempoCursor::sync
+//    rebuild the flattened snapshot if the map changed
+//---------------------------------------------------------
+
+void TempoCursor::sync()
+{
+    IF_ASSERT_FAILED(m_map) {
+        return;
+    }
+
+    if (m_sn == m_map->tempoSN()) {
+        return;
+    }
+
+    m_spans.clear();
+    m_spans.reserve(m_map->size() + 1);
+
+    const double mult = m_map->tempoMultiplier().val;
+
+    Span initial;
+    initial.tempo = 2.0 * mult;   // default tempo before the first event
+    m_spans.push_back(initial);
+
+    for (const auto& p : *m_map) {
+        Span s;
+        s.tick  = p.first;
+        s.time  = p.second.time;
+        s.pause = p.second.pause;
+        s.tempo = p.second.tempo.val * mult;
+        m_spans.push_back(s);
+    }
+
+    m_pos = 0;
+    m_sn = m_map->tempoSN();
+}
+
+//---------------------------------------------------------
+//   TempoCursor::tick2time
+//---------------------------------------------------------
+
+double TempoCursor::tick2time(int tick)
+{
+    sync();
+
+    if (m_spans.empty()) {
+        return double(tick) / (Constants::division * 2.0);
+    }
+
+    // reposition: O(1) amortized going forward, O(log n) after a jump back
+    if (tick < m_spans[m_pos].tick) {
+        auto it = std::upper_bound(m_spans.begin(), m_spans.end(), tick, [](int t, const Span& s) {
+            return t < s.tick;
+        });
+        m_pos = (it == m_spans.begin()) ? 0 : size_t(it - m_spans.begin() - 1);
+    }
+    while (m_pos + 1 < m_spans.size() && m_spans[m_pos + 1].tick <= tick) {
+        ++m_pos;
+    }
+
+    const Span& s = m_spans[m_pos];
+    return s.time + double(tick - s.tick) / (Constants::division * s.tempo);
+}
+
+//---------------------------------------------------------
+//   TempoCursor::time2tick
+//---------------------------------------------------------
+
+int TempoCursor::time2tick(double time)
+{
+    sync();
+
+    if (m_spans.empty()) {
+        return int(lrint(time * Constants::division * 2.0));
+    }
+
+    // current span must be the last one starting strictly before time
+    if (m_pos > 0 && time <= m_spans[m_pos].time) {
+        auto it = std::lower_bound(m_spans.begin(), m_spans.end(), time, [](const Span& s, double t) {
+            return s.time < t;
+        });
+        m_pos = (it == m_spans.begin()) ? 0 : size_t(it - m_spans.begin() - 1);
+    }
+    while (m_pos + 1 < m_spans.size() && m_spans[m_pos + 1].time < time) {
+        ++m_pos;
+    }
+
+    const Span& s = m_spans[m_pos];
+
+    if (m_pos + 1 < m_spans.size()) {
+        const Span& next = m_spans[m_pos + 1];
+        if (time > next.time - next.pause) {
+            // inside the pause before the next event: hold the position
+            // the pause started at, like TempoMap::time2tick does
+            return s.tick + int(lrint((next.time - next.pause - s.time) * Constants::division * s.tempo));
+        }
+    }
+
+    return s.tick + int(lrint((time - s.time) * Constants::division * s.tempo));
+}
+
+//---------------------------------------------------------
+//   TempoCursor::tempo
+//---------------------------------------------------------
+
+BeatsPerSecond TempoCursor::tempo(int tick)
+{
+    sync();
+
+    if (m_spans.empty()) {
+        return BeatsPerSecond(2.0);
+    }
+
+    if (tick < m_spans[m_pos].tick) {
+        auto it = std::upper_bound(m_spans.begin(), m_spans.end(), tick, [](int t, const Span& s) {
+            return t < s.tick;
+        });
+        m_pos = (it == m_spans.begin()) ? 0 : size_t(it - m_spans.begin() - 1);
+    }
+    while (m_pos + 1 < m_spans.size() && m_spans[m_pos + 1].tick <= tick) {
+        ++m_pos;
+    }
+
+    return BeatsPerSecond(m_spans[m_pos].tempo);
+}
 }
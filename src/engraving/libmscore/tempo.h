@@ -24,6 +24,7 @@
 #define __AL_TEMPO_H__
 
 #include <map>
+#include <vector>
 
 #include "global/allocator.h"
 #include "global/async/notification.h"
@@ -83,6 +84,7 @@ public:
     TempoMap();
     void clear();
     void clearRange(int tick1, int tick2);
+    void insertTime(int tick, int len);
 
     void dump() const;
 
@@ -102,5 +104,54 @@ public:
     BeatsPerSecond tempoMultiplier() const;
     bool setTempoMultiplier(BeatsPerSecond val);
 };
+
+//---------------------------------------------------------
+//   TempoCursor
+//    tick<->time conversion for consumers that query in
+//    (mostly) increasing order: playback, the timeline,
+//    exporters. The map is flattened into an array snapshot
+//    and a position is carried between calls, so sequential
+//    queries cost O(1) amortized instead of a map lookup
+//    (or, for time2tick, a scan from the beginning) each.
+//    The snapshot revalidates itself against the map's
+//    serial number, so tempo edits are picked up on the
+//    next query.
+//---------------------------------------------------------
+
+class TempoCursor
+{
+public:
+    TempoCursor() = default;
+    explicit TempoCursor(const TempoMap* map)
+        : m_map(map) {}
+
+    void setMap(const TempoMap* map)
+    {
+        if (m_map != map) {
+            m_map = map;
+            m_sn = -1;
+            m_pos = 0;
+        }
+    }
+
+    double tick2time(int tick);
+    int time2tick(double time);
+    BeatsPerSecond tempo(int tick);
+
+private:
+    struct Span {
+        int tick = 0;         // tick of the tempo event
+        double time = 0.0;    // precomputed time at tick (end of the pause, if any)
+        double pause = 0.0;   // pause ending at time
+        double tempo = 2.0;   // beats per second in effect from tick on, multiplier applied
+    };
+
+    void sync();
+
+    const TempoMap* m_map = nullptr;
+    int m_sn = -1;
+    std::vector<Span> m_spans;
+    size_t m_pos = 0;
+};
 } // namespace mu::engraving
 #endif
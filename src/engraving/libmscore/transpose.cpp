@@ -439,14 +439,18 @@ bool Score::transpose(TransposeMode mode, TransposeDirection direction, Key trKe
         s1 = s1->measure()->first();
     }
     Segment* s2 = _selection.endSegment();
+
+    // the staff type at the range start cannot change while we loop,
+    // so filter out percussion tracks once instead of per segment
+    tracks.remove_if([this, s1](track_idx_t track) {
+        return staff(track / VOICES)->staffType(s1->tick())->group() == StaffGroup::PERCUSSION;
+    });
+
     for (Segment* segment = s1; segment && segment != s2; segment = segment->next1()) {
         if (!segment->enabled()) {
             continue;
         }
         for (track_idx_t track : tracks) {
-            if (staff(track / VOICES)->staffType(s1->tick())->group() == StaffGroup::PERCUSSION) {
-                continue;
-            }
             EngravingItem* e = segment->element(track);
             if (!e) {
                 continue;
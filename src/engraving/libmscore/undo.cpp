@@ -350,6 +350,25 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
         LOG_UNDO() << cmd->name();
     }
 #endif
+    //! NOTE Dragging produces thousands of successive micro-changes to the
+    //! same property of the same element. The first ChangeProperty in the
+    //! macro already holds the value needed for undo, so the later ones only
+    //! need to be applied, not retained.
+    if (cmd->type() == CommandType::ChangeProperty && curCmd->childCount() > 0) {
+        UndoCommand* last = curCmd->commands().back();
+        if (last->type() == CommandType::ChangeProperty && strcmp(last->name(), "ChangeProperty") == 0
+            && strcmp(cmd->name(), "ChangeProperty") == 0) {
+            ChangeProperty* lastCp = static_cast<ChangeProperty*>(last);
+            ChangeProperty* newCp = static_cast<ChangeProperty*>(cmd);
+            if (lastCp->getElement() && lastCp->getElement() == newCp->getElement()
+                && lastCp->getId() == newCp->getId()) {
+                cmd->redo(ed);
+                delete cmd;
+                return;
+            }
+        }
+    }
+
     curCmd->appendChild(cmd);
     cmd->redo(ed);
 }
@@ -457,10 +476,30 @@ void UndoStack::endMacro(bool rollback)
         list.push_back(curCmd);
         stateList.push_back(nextState++);
         ++curIdx;
+        evictOverBudget();
     }
     curCmd = 0;
 }
 
+//---------------------------------------------------------
+//   evictOverBudget
+//    drop the oldest undoable macros once the history grows
+//    beyond the configured budget, so that all-day editing
+//    sessions do not retain every command ever made
+//---------------------------------------------------------
+
+void UndoStack::evictOverBudget()
+{
+    while (maxMacroCount > 0 && list.size() > maxMacroCount && curIdx > 1) {
+        UndoMacro* cmd = list.front();
+        list.erase(list.begin());
+        stateList.erase(stateList.begin());
+        cmd->cleanup(true);     // the macro can never be undone anymore
+        delete cmd;
+        --curIdx;
+    }
+}
+
 //---------------------------------------------------------
 //   reopen
 //---------------------------------------------------------
@@ -641,6 +680,9 @@ UndoMacro::ChangesInfo UndoMacro::changesInfo() const
         if (type == CommandType::ChangeProperty) {
             auto changeProperty = static_cast<const ChangeProperty*>(command);
             result.changedPropertyIdSet.insert(changeProperty->getId());
+        } else if (type == CommandType::ChangeProperties) {
+            auto changeProperties = static_cast<const ChangeProperties*>(command);
+            result.changedPropertyIdSet.insert(changeProperties->getId());
         } else if (type == CommandType::ChangeStyleVal) {
             auto changeStyle = static_cast<const ChangeStyleVal*>(command);
             result.changedStyleIdSet.insert(changeStyle->id());
@@ -1577,7 +1619,11 @@ void ChangeInstrumentShort::flip(EditData*)
     std::list<StaffName> s = part->shortNames(tick);
     part->setShortNames(text, tick);
     text = s;
-    part->score()->setLayoutAll();
+
+    // the name column only affects systems from this tick on
+    Score* score = part->score();
+    Measure* last = score->lastMeasure();
+    score->setLayout(tick, last ? last->endTick() : tick, 0, score->nstaves() - 1, nullptr);
 }
 
 //---------------------------------------------------------
@@ -1596,7 +1642,11 @@ void ChangeInstrumentLong::flip(EditData*)
     std::list<StaffName> s = part->longNames(tick);
     part->setLongNames(text, tick);
     text = s;
-    part->score()->setLayoutAll();
+
+    // the name column only affects systems from this tick on
+    Score* score = part->score();
+    Measure* last = score->lastMeasure();
+    score->setLayout(tick, last ? last->endTick() : tick, 0, score->nstaves() - 1, nullptr);
 }
 
 //---------------------------------------------------------
@@ -1703,6 +1753,15 @@ void ChangeStaff::flip(EditData*)
     bool oldHideSystemBarLine  = staff->hideSystemBarLine();
     bool oldMergeMatchingRests = staff->mergeMatchingRests();
 
+    bool changed = visible != oldVisible
+                   || !(clefType == oldClefType)
+                   || userDist != oldUserDist
+                   || hideMode != oldHideMode
+                   || showIfEmpty != oldShowIfEmpty
+                   || cutaway != oldCutaway
+                   || hideSystemBarLine != oldHideSystemBarLine
+                   || mergeMatchingRests != oldMergeMatchingRests;
+
     staff->setVisible(visible);
     staff->setDefaultClefType(clefType);
     staff->setUserDist(Millimetre(userDist));
@@ -1721,9 +1780,14 @@ void ChangeStaff::flip(EditData*)
     hideSystemBarLine  = oldHideSystemBarLine;
     mergeMatchingRests = oldMergeMatchingRests;
 
-    staff->triggerLayout();
-    staff->masterScore()->rebuildMidiMapping();
-    staff->score()->setPlaylistDirty();
+    // the staff properties dialog applies this op even when nothing was edited;
+    // a full relayout plus MIDI remapping for a no-op change is what makes
+    // clicking through the staves of a big score so slow
+    if (changed) {
+        staff->triggerLayout();
+        staff->masterScore()->rebuildMidiMapping();
+        staff->score()->setPlaylistDirty();
+    }
 }
 
 //---------------------------------------------------------
@@ -1737,6 +1801,7 @@ void ChangeStaffType::flip(EditData*)
     staff->setStaffType(Fraction(0, 1), staffType);
 
     bool invisibleChanged = oldStaffType.invisible() != staffType.invisible();
+    bool changed = !(oldStaffType == staffType);
 
     staffType = oldStaffType;
 
@@ -1748,7 +1813,10 @@ void ChangeStaffType::flip(EditData*)
         }
     }
 
-    staff->triggerLayout();
+    // skip the full relayout when the dialog applied an identical staff type
+    if (changed) {
+        staff->triggerLayout();
+    }
 }
 
 //---------------------------------------------------------
@@ -1861,7 +1929,7 @@ void ChangeStyleVal::flip(EditData*)
         default:
             break;
         }
-        score->styleChanged();
+        score->styleChanged(idx);
     }
     value = v;
 }
@@ -2001,7 +2069,7 @@ void InsertRemoveMeasures::insertMeasures()
     score->measures()->insert(fm, lm);
 
     if (fm->isMeasure()) {
-        score->setUpTempoMap();
+        score->setUpTempoMapOnInsertedMeasures(fm, lm);
         score->insertTime(fm->tick(), lm->endTick() - fm->tick());
 
         // move ownership of Instrument back to part
@@ -2023,7 +2091,9 @@ void InsertRemoveMeasures::insertMeasures()
         }
     }
 
-    score->setLayoutAll();
+    // everything before the insertion point keeps its ticks and its layout
+    Measure* last = score->lastMeasure();
+    score->setLayout(fm->tick(), last ? last->endTick() : fm->tick(), 0, score->nstaves() - 1, nullptr);
 
     if (Measure* nextMeasure = lm->nextMeasure()) {
         for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
@@ -2112,9 +2182,14 @@ void InsertRemoveMeasures::removeMeasures()
         }
     }
 
+    MeasureBase* nmb = lm->next();
     score->measures()->remove(fm, lm);
 
-    score->setUpTempoMap();
+    if (fm->isMeasure()) {
+        score->setUpTempoMapOnRemovedMeasures(tick1, tick2 - tick1, nmb);
+    } else {
+        score->setUpTempoMap();
+    }
     if (fm->isMeasure()) {
         score->setPlaylistDirty();
 
@@ -2175,7 +2250,9 @@ void InsertRemoveMeasures::removeMeasures()
         }
     }
 
-    score->setLayoutAll();
+    // everything before the removed range keeps its ticks and its layout
+    Measure* last = score->lastMeasure();
+    score->setLayout(tick1, last ? last->endTick() : tick1, 0, score->nstaves() - 1, nullptr);
 }
 
 AddExcerpt::AddExcerpt(Excerpt* ex)
@@ -2418,6 +2495,58 @@ std::vector<const EngravingObject*> ChangeProperty::objectItems() const
     return compoundObjects(element);
 }
 
+//---------------------------------------------------------
+//   ChangeProperties
+//---------------------------------------------------------
+
+ChangeProperties::ChangeProperties(const std::vector<EngravingObject*>& els, Pid i, const PropertyValue& v, PropertyFlags ps)
+    : elements(els), id(i)
+{
+    properties.assign(elements.size(), v);
+    flagsList.assign(elements.size(), ps);
+}
+
+void ChangeProperties::flip(EditData*)
+{
+    for (size_t i = 0; i < elements.size(); ++i) {
+        EngravingObject* e = elements[i];
+        PropertyValue v = e->getProperty(id);
+        PropertyFlags ps = e->propertyFlags(id);
+        e->setProperty(id, properties[i]);
+        e->setPropertyFlags(id, flagsList[i]);
+        properties[i] = v;
+        flagsList[i] = ps;
+    }
+}
+
+std::vector<const EngravingObject*> ChangeProperties::objectItems() const
+{
+    std::vector<const EngravingObject*> result;
+    for (const EngravingObject* e : elements) {
+        for (const EngravingObject* o : compoundObjects(e)) {
+            result.push_back(o);
+        }
+    }
+    return result;
+}
+
+bool ChangeProperties::isFiltered(UndoCommand::Filter f, const EngravingItem* target) const
+{
+    if (f != UndoCommand::Filter::ChangePropertyLinked) {
+        return false;
+    }
+    // a bulk node written by linked propagation stands for one command per
+    // clone; filter it only when it covers nothing but elements linked to
+    // the target, as the per-clone commands would all have been filtered
+    const std::list<EngravingObject*> ll = target->linkList();
+    for (EngravingObject* e : elements) {
+        if (!mu::contains(ll, e)) {
+            return false;
+        }
+    }
+    return !elements.empty();
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
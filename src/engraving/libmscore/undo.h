@@ -202,8 +202,10 @@ class UndoStack
     int cleanState = 0;
     size_t curIdx = 0;
     bool isLocked = false;
+    size_t maxMacroCount = 0;   // 0 = unlimited
 
     void remove(size_t idx);
+    void evictOverBudget();
 
 public:
     UndoStack();
@@ -230,6 +232,10 @@ public:
 
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    //! NOTE budget for retained undo history, in macros; the oldest macros
+    //! are evicted when a finished macro pushes the stack over the budget
+    void setMaxMacroCount(size_t count) { maxMacroCount = count; }
 };
 
 class InsertPart : public UndoCommand
@@ -1106,6 +1112,36 @@ public:
     }
 };
 
+//---------------------------------------------------------
+//   ChangeProperties
+//    bulk variant of ChangeProperty: records the same
+//    property change for a whole list of elements in a
+//    single undo node
+//---------------------------------------------------------
+
+class ChangeProperties : public UndoCommand
+{
+    OBJECT_ALLOCATOR(engraving, ChangeProperties)
+
+    std::vector<EngravingObject*> elements;
+    Pid id;
+    std::vector<PropertyValue> properties;
+    std::vector<PropertyFlags> flagsList;
+
+    void flip(EditData*) override;
+
+public:
+    ChangeProperties(const std::vector<EngravingObject*>& els, Pid i, const PropertyValue& v, PropertyFlags ps);
+
+    Pid getId() const { return id; }
+
+    UNDO_TYPE(CommandType::ChangeProperties)
+    UNDO_NAME("ChangeProperties")
+
+    std::vector<const EngravingObject*> objectItems() const override;
+    bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
+};
+
 class ChangeBracketProperty : public ChangeProperty
 {
     OBJECT_ALLOCATOR(engraving, ChangeBracketProperty)
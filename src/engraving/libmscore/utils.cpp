@@ -22,6 +22,7 @@
 
 #include "utils.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -60,6 +61,45 @@ RectF handleRect(const PointF& pos)
 //   tick2measure
 //---------------------------------------------------------
 
+//---------------------------------------------------------
+//   tickToMeasureIndex
+//    lazily rebuilt sorted tick -> measure index, shared by
+//    tick2measure and tick2measureMM; playback cursor
+//    tracking and range selection query these thousands of
+//    times per second, so a linear walk per query is too
+//    expensive for long scores
+//---------------------------------------------------------
+
+const std::vector<std::pair<int, Measure*> >& Score::tickToMeasureIndex(bool mmRests) const
+{
+    TickToMeasureIndex& idx = mmRests ? m_tickToMeasureIndexMM : m_tickToMeasureIndex;
+    if (!idx.valid || idx.generation != _measures.generation()) {
+        idx.entries.clear();
+        if (mmRests) {
+            for (Measure* m = firstMeasureMM(); m; m = m->nextMeasureMM()) {
+                idx.entries.emplace_back(m->tick().ticks(), m);
+            }
+        } else {
+            for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
+                idx.entries.emplace_back(m->tick().ticks(), m);
+            }
+        }
+        idx.generation = _measures.generation();
+        idx.valid = true;
+    }
+    return idx.entries;
+}
+
+static Measure* findInTickIndex(const std::vector<std::pair<int, Measure*> >& index, const Fraction& tick)
+{
+    auto it = std::upper_bound(index.begin(), index.end(), tick.ticks(),
+                               [](int t, const std::pair<int, Measure*>& e) { return t < e.first; });
+    if (it == index.begin()) {
+        return nullptr;
+    }
+    return std::prev(it)->second;
+}
+
 Measure* Score::tick2measure(const Fraction& tick) const
 {
     if (tick == Fraction(-1, 1)) {   // special number
@@ -69,19 +109,11 @@ Measure* Score::tick2measure(const Fraction& tick) const
         return firstMeasure();
     }
 
-    Measure* lm = 0;
-    for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
-        if (tick < m->tick()) {
-            assert(lm);
-            return lm;
-        }
-        lm = m;
-    }
-    // check last measure
-    if (lm && (tick >= lm->tick()) && (tick <= lm->endTick())) {
-        return lm;
+    Measure* m = findInTickIndex(tickToMeasureIndex(false), tick);
+    if (m && tick <= m->endTick()) {
+        return m;
     }
-    LOGD("tick2measure %d (max %d) not found", tick.ticks(), lm ? lm->tick().ticks() : -1);
+    LOGD("tick2measure %d (max %d) not found", tick.ticks(), m ? m->tick().ticks() : -1);
     return 0;
 }
 
@@ -99,20 +131,11 @@ Measure* Score::tick2measureMM(const Fraction& t) const
         tick = Fraction(0, 1);
     }
 
-    Measure* lm = 0;
-
-    for (Measure* m = firstMeasureMM(); m; m = m->nextMeasureMM()) {
-        if (tick < m->tick()) {
-            assert(lm);
-            return lm;
-        }
-        lm = m;
-    }
-    // check last measure
-    if (lm && (tick >= lm->tick()) && (tick <= lm->endTick())) {
-        return lm;
+    Measure* m = findInTickIndex(tickToMeasureIndex(true), tick);
+    if (m && tick <= m->endTick()) {
+        return m;
     }
-    LOGD("tick2measureMM %d (max %d) not found", tick.ticks(), lm ? lm->tick().ticks() : -1);
+    LOGD("tick2measureMM %d (max %d) not found", tick.ticks(), m ? m->tick().ticks() : -1);
     return 0;
 }
 
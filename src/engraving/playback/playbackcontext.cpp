@@ -41,22 +41,22 @@ using namespace mu::mpe;
 
 dynamic_level_t PlaybackContext::appliableDynamicLevel(const int nominalPositionTick) const
 {
-    auto it = findLessOrEqual(m_dynamicsMap, nominalPositionTick);
-    if (it == m_dynamicsMap.cend()) {
+    const dynamic_level_t* level = m_flatDynamics.lessOrEqual(nominalPositionTick);
+    if (!level) {
         return mpe::dynamicLevelFromType(mpe::DynamicType::Natural);
     }
 
-    return it->second;
+    return *level;
 }
 
 ArticulationType PlaybackContext::persistentArticulationType(const int nominalPositionTick) const
 {
-    auto it = findLessOrEqual(m_playTechniquesMap, nominalPositionTick);
-    if (it == m_playTechniquesMap.cend()) {
+    const ArticulationType* type = m_flatPlayTechniques.lessOrEqual(nominalPositionTick);
+    if (!type) {
         return mpe::ArticulationType::Standard;
     }
 
-    return it->second;
+    return *type;
 }
 
 void PlaybackContext::update(const ID partId, const Score* score)
@@ -75,12 +75,18 @@ void PlaybackContext::update(const ID partId, const Score* score)
         handleSpanners(partId, score, repeatSegment->tick,
                        repeatSegment->tick + repeatSegment->len(), tickPositionOffset);
     }
+
+    m_flatDynamics.assign(m_dynamicsMap);
+    m_flatPlayTechniques.assign(m_playTechniquesMap);
 }
 
 void PlaybackContext::clear()
 {
     m_dynamicsMap.clear();
     m_playTechniquesMap.clear();
+
+    m_flatDynamics.clear();
+    m_flatPlayTechniques.clear();
 }
 
 DynamicLevelMap PlaybackContext::dynamicLevelMap(const Score* score) const
@@ -98,6 +104,18 @@ DynamicLevelMap PlaybackContext::dynamicLevelMap(const Score* score) const
     return result;
 }
 
+//! NOTE searches the map directly, as the flattened timeline is not up to date
+//! until the context is fully built
+dynamic_level_t PlaybackContext::appliableDynamicLevelOnBuild(const int nominalPositionTick) const
+{
+    auto it = findLessOrEqual(m_dynamicsMap, nominalPositionTick);
+    if (it == m_dynamicsMap.cend()) {
+        return mpe::dynamicLevelFromType(mpe::DynamicType::Natural);
+    }
+
+    return it->second;
+}
+
 dynamic_level_t PlaybackContext::nominalDynamicLevel(const int positionTick) const
 {
     auto search = m_dynamicsMap.find(positionTick);
@@ -118,7 +136,7 @@ void PlaybackContext::updateDynamicMap(const Dynamic* dynamic, const Segment* se
     }
 
     if (isSingleNoteDynamicType(type)) {
-        mpe::dynamic_level_t prevDynamicLevel = appliableDynamicLevel(segmentPositionTick);
+        mpe::dynamic_level_t prevDynamicLevel = appliableDynamicLevelOnBuild(segmentPositionTick);
 
         m_dynamicsMap[segmentPositionTick] = dynamicLevelFromType(type);
 
@@ -226,7 +244,8 @@ void PlaybackContext::handleSpanners(const ID partId, const Score* score, const
         DynamicType dynamicTypeFrom = hairpin->dynamicTypeFrom();
         DynamicType dynamicTypeTo = hairpin->dynamicTypeTo();
 
-        dynamic_level_t nominalLevelFrom = dynamicLevelFromType(dynamicTypeFrom, appliableDynamicLevel(spannerFrom + tickPositionOffset));
+        dynamic_level_t nominalLevelFrom = dynamicLevelFromType(dynamicTypeFrom,
+                                                                appliableDynamicLevelOnBuild(spannerFrom + tickPositionOffset));
         dynamic_level_t nominalLevelTo = dynamicLevelFromType(dynamicTypeTo, nominalDynamicLevel(spannerTo + tickPositionOffset));
 
         dynamic_level_t overallDynamicRange = dynamicLevelRangeByTypes(dynamicTypeFrom,
@@ -23,6 +23,9 @@
 #ifndef MU_ENGRAVING_PLAYBACKCONTEXT_H
 #define MU_ENGRAVING_PLAYBACKCONTEXT_H
 
+#include <algorithm>
+#include <vector>
+
 #include "mpe/mpetypes.h"
 
 #include "types/types.h"
@@ -48,7 +51,53 @@ public:
     mpe::DynamicLevelMap dynamicLevelMap(const Score* score) const;
 
 private:
+    //! NOTE tick-keyed maps are convenient while the context is being built,
+    //! but walking them for every rendered note is slow, so the lookups go
+    //! through a flattened sorted timeline; the renderers query positions in
+    //! non-decreasing order, which the cursor takes advantage of
+    template<typename T>
+    struct FlatTimeline {
+        void assign(const std::map<int /*nominalPositionTick*/, T>& source)
+        {
+            points.assign(source.cbegin(), source.cend());
+            cursor = 0;
+        }
+
+        void clear()
+        {
+            points.clear();
+            cursor = 0;
+        }
+
+        const T* lessOrEqual(const int positionTick) const
+        {
+            if (points.empty() || positionTick < points.front().first) {
+                return nullptr;
+            }
+
+            size_t idx = cursor;
+            if (idx < points.size() && points[idx].first <= positionTick
+                && (idx + 1 == points.size() || positionTick < points[idx + 1].first)) {
+                return &points[idx].second;
+            }
+
+            auto it = std::upper_bound(points.cbegin(), points.cend(), positionTick,
+                                       [](const int tick, const std::pair<int, T>& point) {
+                return tick < point.first;
+            });
+
+            idx = std::distance(points.cbegin(), it) - 1;
+            cursor = idx;
+
+            return &points[idx].second;
+        }
+
+        std::vector<std::pair<int /*nominalPositionTick*/, T> > points;
+        mutable size_t cursor = 0;
+    };
+
     mpe::dynamic_level_t nominalDynamicLevel(const int positionTick) const;
+    mpe::dynamic_level_t appliableDynamicLevelOnBuild(const int nominalPositionTick) const;
 
     void updateDynamicMap(const Dynamic* dynamic, const Segment* segment, const int segmentPositionTick);
     void updatePlayTechMap(const PlayTechAnnotation* annotation, const int segmentPositionTick);
@@ -63,6 +112,9 @@ private:
 
     DynamicMap m_dynamicsMap;
     PlayTechniquesMap m_playTechniquesMap;
+
+    FlatTimeline<mpe::dynamic_level_t> m_flatDynamics;
+    FlatTimeline<mpe::ArticulationType> m_flatPlayTechniques;
 };
 }
 
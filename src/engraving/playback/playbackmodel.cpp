@@ -22,6 +22,8 @@
 
 #include "playbackmodel.h"
 
+#include <future>
+
 #include "libmscore/fret.h"
 #include "libmscore/instrument.h"
 #include "libmscore/measure.h"
@@ -32,6 +34,9 @@
 #include "libmscore/tempo.h"
 #include "libmscore/measurerepeat.h"
 
+#include "async/async.h"
+#include "concurrency/taskscheduler.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -62,6 +67,7 @@ void PlaybackModel::load(Score* score)
     }
 
     m_score = score;
+    m_pendingParts.clear();
 
     auto changesChannel = score->changesChannel();
     changesChannel.resetOnReceive(this);
@@ -70,25 +76,60 @@ void PlaybackModel::load(Score* score)
         TickBoundaries tickRange = tickBoundaries(range);
         TrackBoundaries trackRange = trackBoundaries(range);
 
+        //! NOTE The playback contexts are built from dynamics, hairpins and
+        //! playing technique annotations only; for edits that can't touch
+        //! them (the common case of note edits) the contexts and the dynamic
+        //! level maps stay valid, so re-scanning the score for them and
+        //! resending the dynamic levels is skipped
+        bool updateContexts = hasToUpdateContexts(range);
+
+        ChangedTrackIdSet trackChanges;
+
+        //! NOTE parts still waiting for the background prefetch must be
+        //! rendered before the changed range is cleared, otherwise
+        //! re-rendering the range below would duplicate their events
+        renderPendingParts(&trackChanges);
+
         clearExpiredTracks();
-        clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
+
+        if (updateContexts) {
+            clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
+        }
+
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo);
 
         InstrumentTrackIdSet oldTracks = existingTrackIdSet();
 
-        ChangedTrackIdSet trackChanges;
-        update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
+        updateSetupData();
+
+        if (updateContexts) {
+            updateContext(trackRange.trackFrom, trackRange.trackTo);
+        }
 
-        notifyAboutChanges(oldTracks, trackChanges);
+        updateEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
+
+        notifyAboutChanges(oldTracks, trackChanges, updateContexts);
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    //! NOTE The setup data and the playback contexts of all tracks are
+    //! resolved up front (the audio engine needs them to create the tracks),
+    //! while the events themselves are rendered per part: on the first
+    //! request of a track's playback data or by the background prefetch
+    updateSetupData();
+    updateContext(0, m_score->ntracks());
+    renderMetronomeEvents(0, m_score->lastMeasure()->endTick().ticks(), nullptr);
+
+    for (const Part* part : m_score->parts()) {
+        m_pendingParts.insert(part->id());
+    }
 
     for (const auto& pair : m_playbackDataMap) {
         m_trackAdded.send(pair.first);
     }
 
     m_dataChanged.notify();
+
+    prefetchPendingParts();
 }
 
 void PlaybackModel::reload()
@@ -101,6 +142,8 @@ void PlaybackModel::reload()
     int tickFrom = 0;
     int tickTo = lastMeasure ? lastMeasure->endTick().ticks() : 0;
 
+    m_pendingParts.clear();
+
     clearExpiredTracks();
     clearExpiredContexts(trackFrom, trackTo);
 
@@ -159,14 +202,19 @@ bool PlaybackModel::isChordSymbolsTrack(const InstrumentTrackId& trackId) const
 
 const PlaybackData& PlaybackModel::resolveTrackPlaybackData(const InstrumentTrackId& trackId)
 {
+    const Part* part = m_score ? m_score->partById(trackId.partId.toUint64()) : nullptr;
+
+    //! NOTE first request of a track whose events haven't been rendered yet
+    if (part && mu::contains(m_pendingParts, part->id())) {
+        renderPart(part);
+    }
+
     auto search = m_playbackDataMap.find(trackId);
 
     if (search != m_playbackDataMap.cend()) {
         return search->second;
     }
 
-    const Part* part = m_score ? m_score->partById(trackId.partId.toUint64()) : nullptr;
-
     if (!part) {
         static PlaybackData empty;
         return empty;
@@ -297,23 +345,36 @@ void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t
             continue;
         }
 
+        std::vector<InstrumentTrackId> trackIds;
         for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
-            updateContext(trackId);
+            trackIds.push_back(trackId);
         }
 
         if (part->hasChordSymbol()) {
-            updateContext(chordSymbolsTrackId(part->id()));
+            trackIds.push_back(chordSymbolsTrackId(part->id()));
         }
-    }
-}
 
-void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
-{
-    PlaybackContext& ctx = m_playbackCtxMap[trackId];
-    ctx.update(trackId.partId, m_score);
+        //! NOTE the context is built from the part's annotations and spanners
+        //! only, so every track of the part ends up with identical state;
+        //! build it by walking the score once and copy it into the rest
+        //! instead of re-walking the whole score per track
+        const PlaybackContext* builtCtx = nullptr;
+        mpe::DynamicLevelMap dynamicLevelMap;
+
+        for (const InstrumentTrackId& trackId : trackIds) {
+            PlaybackContext& ctx = m_playbackCtxMap[trackId];
+
+            if (builtCtx) {
+                ctx = *builtCtx;
+            } else {
+                ctx.update(trackId.partId, m_score);
+                builtCtx = &ctx;
+                dynamicLevelMap = ctx.dynamicLevelMap(m_score);
+            }
 
-    PlaybackData& trackData = m_playbackDataMap[trackId];
-    trackData.dynamicLevelMap = ctx.dynamicLevelMap(m_score);
+            m_playbackDataMap[trackId].dynamicLevelMap = dynamicLevelMap;
+        }
+    }
 }
 
 void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& changedStaffIdSet,
@@ -404,12 +465,95 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
 }
 
 void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
-                                 ChangedTrackIdSet* trackChanges)
+                                 ChangedTrackIdSet* trackChanges, const bool withMetronome)
 {
     TRACEFUNC;
 
-    std::set<staff_idx_t> changedStaffIdSet = m_score->staffIdsFromRange(trackFrom, trackTo);
+    std::vector<const Part*> parts;
+    for (const Part* part : m_score->parts()) {
+        if (trackTo < part->startTrack() || trackFrom >= part->endTrack()) {
+            continue;
+        }
+
+        ensurePlaybackData(part);
+        parts.push_back(part);
+    }
+
+    TaskScheduler* scheduler = TaskScheduler::instance();
+
+    if (parts.size() < 2 || scheduler->threadPoolSize() < 2) {
+        processEventsRange(tickFrom, tickTo, m_score->staffIdsFromRange(trackFrom, trackTo), trackChanges);
+    } else {
+        //! NOTE parts render independently once their contexts are resolved,
+        //! but they read shared lazily built score structures, so those are
+        //! built upfront on this thread
+        repeatList();
+        m_score->spannerMap().findOverlapping(tickFrom, tickTo);
+
+        //! NOTE same for the articulation profiles: the repository caches
+        //! them lazily on first request, so requesting every track's profile
+        //! here keeps the workers on the read-only path
+        for (const Part* part : parts) {
+            for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
+                defaultActiculationProfile(trackId);
+            }
+
+            if (part->hasChordSymbol()) {
+                defaultActiculationProfile(chordSymbolsTrackId(part->id()));
+            }
+        }
+
+        std::vector<ChangedTrackIdSet> partTrackChanges(parts.size());
+        std::vector<std::future<void> > results;
+        results.reserve(parts.size());
 
+        for (size_t i = 0; i < parts.size(); ++i) {
+            const Part* part = parts.at(i);
+            ChangedTrackIdSet* partChanges = trackChanges ? &partTrackChanges[i] : nullptr;
+
+            results.push_back(scheduler->submit([this, tickFrom, tickTo, part, partChanges]() {
+                processEventsRange(tickFrom, tickTo, part->staveIdxList(), partChanges);
+            }));
+        }
+
+        for (std::future<void>& result : results) {
+            result.wait();
+        }
+
+        if (trackChanges) {
+            for (const ChangedTrackIdSet& partChanges : partTrackChanges) {
+                trackChanges->insert(partChanges.cbegin(), partChanges.cend());
+            }
+        }
+    }
+
+    //! NOTE the metronome track doesn't belong to any part, so per-part
+    //! rendering (see renderPart) must not duplicate its events
+    if (withMetronome) {
+        renderMetronomeEvents(tickFrom, tickTo, trackChanges);
+    }
+}
+
+//! NOTE processSegment relies on the playback data and context entries of the
+//! part's tracks already existing, so that parallel rendering never has to
+//! modify the maps themselves
+void PlaybackModel::ensurePlaybackData(const Part* part)
+{
+    for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
+        m_playbackDataMap[trackId];
+        m_playbackCtxMap[trackId];
+    }
+
+    if (part->hasChordSymbol()) {
+        const InstrumentTrackId trackId = chordSymbolsTrackId(part->id());
+        m_playbackDataMap[trackId];
+        m_playbackCtxMap[trackId];
+    }
+}
+
+void PlaybackModel::processEventsRange(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& changedStaffIdSet,
+                                       ChangedTrackIdSet* trackChanges)
+{
     for (const RepeatSegment* repeatSegment : repeatList()) {
         int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
         int repeatStartTick = repeatSegment->tick;
@@ -441,6 +585,30 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
 
                 processSegment(tickPositionOffset, segment, changedStaffIdSet, trackChanges);
             }
+        }
+    }
+}
+
+void PlaybackModel::renderMetronomeEvents(const int tickFrom, const int tickTo, ChangedTrackIdSet* trackChanges)
+{
+    TRACEFUNC;
+
+    for (const RepeatSegment* repeatSegment : repeatList()) {
+        int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
+        int repeatStartTick = repeatSegment->tick;
+        int repeatEndTick = repeatStartTick + repeatSegment->len();
+
+        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
+            continue;
+        }
+
+        for (const Measure* measure : repeatSegment->measureList()) {
+            int measureStartTick = measure->tick().ticks();
+            int measureEndTick = measure->endTick().ticks();
+
+            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
+                continue;
+            }
 
             m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
                                        m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
@@ -449,6 +617,60 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
     }
 }
 
+void PlaybackModel::renderPart(const Part* part, ChangedTrackIdSet* trackChanges)
+{
+    m_pendingParts.erase(part->id());
+
+    const Measure* lastMeasure = m_score->lastMeasure();
+    if (!lastMeasure) {
+        return;
+    }
+
+    updateEvents(0, lastMeasure->endTick().ticks(), part->startTrack(), part->endTrack(),
+                 trackChanges, false /*withMetronome*/);
+}
+
+void PlaybackModel::renderPendingParts(ChangedTrackIdSet* trackChanges)
+{
+    if (m_pendingParts.empty()) {
+        return;
+    }
+
+    for (const Part* part : m_score->parts()) {
+        if (mu::contains(m_pendingParts, part->id())) {
+            renderPart(part, trackChanges);
+        }
+    }
+
+    m_pendingParts.clear();
+}
+
+void PlaybackModel::prefetchPendingParts()
+{
+    if (m_pendingParts.empty()) {
+        return;
+    }
+
+    //! NOTE one part per event loop iteration: the events of a freshly opened
+    //! score are prefetched in the background without blocking the UI, while
+    //! a track that is needed earlier (playback, solo) is rendered on demand
+    //! by resolveTrackPlaybackData
+    async::Async::call(this, [this]() {
+        for (const Part* part : m_score->parts()) {
+            if (!mu::contains(m_pendingParts, part->id())) {
+                continue;
+            }
+
+            ChangedTrackIdSet trackChanges;
+            renderPart(part, &trackChanges);
+            notifyAboutChanges(existingTrackIdSet(), trackChanges, false /*dynamicLevelsChanged*/);
+            break;
+        }
+
+        prefetchPendingParts();
+    });
+}
+
 bool PlaybackModel::hasToReloadTracks(const ScoreChangesRange& changesRange) const
 {
     static const std::unordered_set<ElementType> REQUIRED_TYPES = {
@@ -515,6 +737,32 @@ bool PlaybackModel::hasToReloadScore(const std::unordered_set<ElementType>& chan
     return false;
 }
 
+bool PlaybackModel::hasToUpdateContexts(const ScoreChangesRange& changesRange) const
+{
+    //! NOTE Types the playback contexts are built from, plus the types that
+    //! may add new instrument tracks (which need their contexts resolved)
+    static const std::unordered_set<ElementType> REQUIRED_TYPES = {
+        ElementType::DYNAMIC,
+        ElementType::HAIRPIN,
+        ElementType::HAIRPIN_SEGMENT,
+        ElementType::PLAYTECH_ANNOTATION,
+        ElementType::HARMONY,
+        ElementType::FRET_DIAGRAM,
+        ElementType::INSTRUMENT_CHANGE,
+    };
+
+    for (const ElementType type : REQUIRED_TYPES) {
+        if (changesRange.changedTypes.find(type) == changesRange.changedTypes.cend()) {
+            continue;
+        }
+
+        return true;
+    }
+
+    //! NOTE Tempo and repeat structure changes shift the contexts' tick positions
+    return hasToReloadScore(changesRange.changedTypes) || !changesRange.isValidBoundary();
+}
+
 bool PlaybackModel::containsTrack(const InstrumentTrackId& trackId) const
 {
     return m_playbackDataMap.find(trackId) != m_playbackDataMap.cend();
@@ -630,7 +878,8 @@ void PlaybackModel::collectChangesTracks(const InstrumentTrackId& trackId, Chang
     result->insert(trackId);
 }
 
-void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks)
+void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks,
+                                       const bool dynamicLevelsChanged)
 {
     for (const InstrumentTrackId& trackId : changedTracks) {
         auto search = m_playbackDataMap.find(trackId);
@@ -640,7 +889,10 @@ void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, co
         }
 
         search->second.mainStream.send(search->second.originEvents);
-        search->second.dynamicLevelChanges.send(search->second.dynamicLevelMap);
+
+        if (dynamicLevelsChanged) {
+            search->second.dynamicLevelChanges.send(search->second.dynamicLevelMap);
+        }
     }
 
     for (auto it = m_playbackDataMap.cbegin(); it != m_playbackDataMap.cend(); ++it) {
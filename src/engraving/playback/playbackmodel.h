@@ -25,6 +25,7 @@
 
 #include <unordered_map>
 #include <map>
+#include <set>
 #include <functional>
 
 #include "async/asyncable.h"
@@ -46,6 +47,7 @@ class Note;
 class EngravingItem;
 class Segment;
 class Instrument;
+class Part;
 class RepeatList;
 
 class PlaybackModel : public async::Asyncable
@@ -104,22 +106,31 @@ private:
                 ChangedTrackIdSet* trackChanges = nullptr);
     void updateSetupData();
     void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo);
-    void updateContext(const InstrumentTrackId& trackId);
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
-                      ChangedTrackIdSet* trackChanges = nullptr);
+                      ChangedTrackIdSet* trackChanges = nullptr, const bool withMetronome = true);
+    void processEventsRange(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& changedStaffIdSet,
+                            ChangedTrackIdSet* trackChanges);
+    void ensurePlaybackData(const Part* part);
+    void renderMetronomeEvents(const int tickFrom, const int tickTo, ChangedTrackIdSet* trackChanges);
+
+    void renderPart(const Part* part, ChangedTrackIdSet* trackChanges = nullptr);
+    void renderPendingParts(ChangedTrackIdSet* trackChanges = nullptr);
+    void prefetchPendingParts();
 
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& changedStaffIdSet,
                         ChangedTrackIdSet* trackChanges);
 
     bool hasToReloadTracks(const ScoreChangesRange& changesRange) const;
     bool hasToReloadScore(const std::unordered_set<ElementType>& changedTypes) const;
+    bool hasToUpdateContexts(const ScoreChangesRange& changesRange) const;
 
     bool containsTrack(const InstrumentTrackId& trackId) const;
     void clearExpiredTracks();
     void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo);
     void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
-    void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks);
+    void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks,
+                            const bool dynamicLevelsChanged = true);
 
     void removeEventsFromRange(const track_idx_t trackFrom, const track_idx_t trackTo, const mpe::timestamp_t timestampFrom = -1,
                                const mpe::timestamp_t timestampTo = -1);
@@ -145,6 +156,9 @@ private:
     std::unordered_map<InstrumentTrackId, PlaybackContext> m_playbackCtxMap;
     std::unordered_map<InstrumentTrackId, mpe::PlaybackData> m_playbackDataMap;
 
+    //! NOTE parts whose events haven't been rendered yet (see prefetchPendingParts)
+    std::set<ID> m_pendingParts;
+
     async::Notification m_dataChanged;
     async::Channel<InstrumentTrackId> m_trackAdded;
     async::Channel<InstrumentTrackId> m_trackRemoved;
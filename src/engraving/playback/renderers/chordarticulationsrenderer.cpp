@@ -38,16 +38,17 @@ using namespace mu::mpe;
 
 const mpe::ArticulationTypeSet& ChordArticulationsRenderer::supportedTypes()
 {
-    static mpe::ArticulationTypeSet SUPPORTED_TYPES;
-
-    if (SUPPORTED_TYPES.empty()) {
-        SUPPORTED_TYPES.insert(OrnamentsRenderer::supportedTypes().cbegin(),
-                               OrnamentsRenderer::supportedTypes().cend());
-        SUPPORTED_TYPES.insert(TremoloRenderer::supportedTypes().cbegin(),
-                               TremoloRenderer::supportedTypes().cend());
-        SUPPORTED_TYPES.insert(ArpeggioRenderer::supportedTypes().cbegin(),
-                               ArpeggioRenderer::supportedTypes().cend());
-    }
+    //! NOTE initialized in one go, so that the first call is safe from any thread
+    static const mpe::ArticulationTypeSet SUPPORTED_TYPES = []() {
+        mpe::ArticulationTypeSet types;
+        types.insert(OrnamentsRenderer::supportedTypes().cbegin(),
+                     OrnamentsRenderer::supportedTypes().cend());
+        types.insert(TremoloRenderer::supportedTypes().cbegin(),
+                     TremoloRenderer::supportedTypes().cend());
+        types.insert(ArpeggioRenderer::supportedTypes().cbegin(),
+                     ArpeggioRenderer::supportedTypes().cend());
+        return types;
+    }();
 
     return SUPPORTED_TYPES;
 }
@@ -117,10 +118,26 @@ void ChordArticulationsRenderer::renderNoteArticulations(const Chord* chord, con
         noteCtx.duration = ctx.nominalDuration * swingDurationAdjustment.durationMultiplier + additionalDuration;
     };
 
+    //! NOTE most chords carry no articulations at all, and all their plain notes resolve
+    //! to the very same standard-pattern map, so it is built once and shared between
+    //! them instead of being parsed from scratch for every note
+    const bool chordHasNoArticulations = ctx.commonArticulations.empty()
+                                         && (ctx.persistentArticulation == ArticulationType::Undefined
+                                             || ctx.persistentArticulation == ArticulationType::Standard);
+
+    mpe::ArticulationMap standardArticulations;
+    if (chordHasNoArticulations) {
+        standardArticulations = makeStandardArticulationMap(ctx);
+    }
+
     for (const Note* note : chord->notes()) {
         NominalNoteCtx noteCtx(note, ctx);
 
-        NoteArticulationsParser::buildNoteArticulationMap(note, ctx, noteCtx.chordCtx.commonArticulations);
+        if (chordHasNoArticulations && isPlainNote(note)) {
+            noteCtx.chordCtx.commonArticulations = standardArticulations;
+        } else {
+            NoteArticulationsParser::buildNoteArticulationMap(note, ctx, noteCtx.chordCtx.commonArticulations);
+        }
 
         if (!isNotePlayable(note, noteCtx.chordCtx.commonArticulations)) {
             continue;
@@ -149,6 +166,30 @@ void ChordArticulationsRenderer::renderNoteArticulations(const Chord* chord, con
     }
 }
 
+bool ChordArticulationsRenderer::isPlainNote(const Note* note)
+{
+    //! NOTE notes that could contribute articulations of their own (see
+    //! NoteArticulationsParser::doParse) have to go through the regular parsing
+    return !note->ghost()
+           && note->headGroup() == NoteHeadGroup::HEAD_NORMAL
+           && note->spannerFor().empty();
+}
+
+mpe::ArticulationMap ChordArticulationsRenderer::makeStandardArticulationMap(const RenderingContext& ctx)
+{
+    mpe::ArticulationMap result;
+
+    mpe::ArticulationMeta meta(mpe::ArticulationType::Standard,
+                               ctx.profile->pattern(mpe::ArticulationType::Standard),
+                               ctx.nominalTimestamp,
+                               ctx.nominalDuration);
+
+    result.emplace(meta.type, mpe::ArticulationAppliedData(std::move(meta), 0, mpe::HUNDRED_PERCENT));
+    result.preCalculateAverageData();
+
+    return result;
+}
+
 duration_t ChordArticulationsRenderer::tiedNotesTotalDuration(const Note* firstNote)
 {
     mpe::duration_t result = 0;
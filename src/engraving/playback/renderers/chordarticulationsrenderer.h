@@ -38,6 +38,9 @@ private:
     static bool renderChordArticulations(const Chord* chord, const RenderingContext& ctx, mpe::PlaybackEventList& result);
     static void renderNoteArticulations(const Chord* chord, const RenderingContext& ctx, mpe::PlaybackEventList& result);
     static mpe::duration_t tiedNotesTotalDuration(const Note* firstNote);
+
+    static bool isPlainNote(const Note* note);
+    static mpe::ArticulationMap makeStandardArticulationMap(const RenderingContext& ctx);
 };
 }
 
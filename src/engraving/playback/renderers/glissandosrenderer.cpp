@@ -67,7 +67,12 @@ void GlissandosRenderer::renderDiscreteGlissando(const Note* note, const Renderi
         return;
     }
 
-    std::vector<int> pitchSteps;
+    if (!isNotePlayable(note, context.commonArticulations)) {
+        return;
+    }
+
+    // the step buffer is reused between calls, Glissando::pitchSteps clears it
+    static thread_local std::vector<int> pitchSteps;
     if (!Glissando::pitchSteps(glissando, pitchSteps)) {
         return;
     }
@@ -76,11 +81,9 @@ void GlissandosRenderer::renderDiscreteGlissando(const Note* note, const Renderi
 
     float durationStep = context.nominalDuration / static_cast<float>(stepsCount);
 
-    for (size_t i = 0; i < stepsCount; ++i) {
-        if (!isNotePlayable(note, context.commonArticulations)) {
-            continue;
-        }
+    result.reserve(result.size() + stepsCount);
 
+    for (size_t i = 0; i < stepsCount; ++i) {
         NominalNoteCtx noteCtx(note, context);
         noteCtx.duration = durationStep;
         noteCtx.timestamp += i * durationStep;
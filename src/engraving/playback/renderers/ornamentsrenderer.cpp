@@ -22,6 +22,9 @@
 
 #include "ornamentsrenderer.h"
 
+#include <map>
+#include <tuple>
+
 #include "realfn.h"
 
 #include "libmscore/utils.h"
@@ -324,29 +327,78 @@ int OrnamentsRenderer::alterationsNumberByTempo(const double beatsPerSeconds, co
     return static_cast<int>(std::max(subNotesCount / 2, 0.f));
 }
 
-void OrnamentsRenderer::createEvents(const ArticulationType type, NominalNoteCtx& noteCtx, const int alterationsCount,
-                                     const int availableDurationTicks, const int overallDurationTicks,
-                                     const std::vector<mpe::pitch_level_t>& pitchOffsets, mpe::PlaybackEventList& result)
+const OrnamentsRenderer::StepEventsTemplate& OrnamentsRenderer::stepEventsTemplate(const int alterationsCount,
+                                                                                  const int availableDurationTicks,
+                                                                                  const int overallDurationTicks,
+                                                                                  const mpe::duration_t nominalDuration,
+                                                                                  const std::vector<mpe::pitch_level_t>& pitchOffsets)
 {
+    using TemplateKey = std::tuple<int, int, int, mpe::duration_t, std::vector<mpe::pitch_level_t> >;
+
+    //! NOTE ornamented notes of the same duration at the same tempo expand into
+    //! identical sub-note sequences, which repeat many times throughout a score,
+    //! so the expanded sequences are cached and reused; thread-local, since
+    //! tracks may be rendered on worker threads in parallel
+    static thread_local std::map<TemplateKey, StepEventsTemplate> templatesCache;
+
+    TemplateKey key { alterationsCount, availableDurationTicks, overallDurationTicks, nominalDuration, pitchOffsets };
+
+    auto search = templatesCache.find(key);
+    if (search != templatesCache.cend()) {
+        return search->second;
+    }
+
+    static constexpr size_t MAX_CACHED_TEMPLATES_COUNT = 1024;
+    if (templatesCache.size() >= MAX_CACHED_TEMPLATES_COUNT) {
+        templatesCache.clear();
+    }
+
+    StepEventsTemplate& result = templatesCache[std::move(key)];
+
     float availableDurationRatio = availableDurationTicks / static_cast<float>(overallDurationTicks);
 
     size_t totalNotesCount = alterationsCount * pitchOffsets.size();
-    float durationStep = (noteCtx.duration * availableDurationRatio) / totalNotesCount;
+    float durationStep = (nominalDuration * availableDurationRatio) / totalNotesCount;
+
+    result.steps.reserve(totalNotesCount);
 
     for (int alterationStep = 0; alterationStep < alterationsCount; ++alterationStep) {
         for (size_t alterationSubNoteIdx = 0; alterationSubNoteIdx < pitchOffsets.size(); ++alterationSubNoteIdx) {
-            NominalNoteCtx subNoteCtx(noteCtx);
-            subNoteCtx.duration = durationStep;
-            subNoteCtx.pitchLevel += pitchOffsets.at(alterationSubNoteIdx);
+            StepEvent step;
+            step.timestampOffset = result.overallOffset;
+            step.duration = durationStep;
+            step.pitchOffset = pitchOffsets.at(alterationSubNoteIdx);
+            result.steps.push_back(step);
 
-            updateArticulationBoundaries(type, subNoteCtx.timestamp,
-                                         subNoteCtx.duration, subNoteCtx.chordCtx.commonArticulations);
+            result.overallOffset += durationStep;
+        }
+    }
 
-            result.emplace_back(buildNoteEvent(std::move(subNoteCtx)));
+    return result;
+}
 
-            noteCtx.timestamp += durationStep;
-        }
+void OrnamentsRenderer::createEvents(const ArticulationType type, NominalNoteCtx& noteCtx, const int alterationsCount,
+                                     const int availableDurationTicks, const int overallDurationTicks,
+                                     const std::vector<mpe::pitch_level_t>& pitchOffsets, mpe::PlaybackEventList& result)
+{
+    const StepEventsTemplate& stepsTemplate = stepEventsTemplate(alterationsCount, availableDurationTicks,
+                                                                 overallDurationTicks, noteCtx.duration, pitchOffsets);
+
+    result.reserve(result.size() + stepsTemplate.steps.size());
+
+    for (const StepEvent& step : stepsTemplate.steps) {
+        NominalNoteCtx subNoteCtx(noteCtx);
+        subNoteCtx.timestamp += step.timestampOffset;
+        subNoteCtx.duration = step.duration;
+        subNoteCtx.pitchLevel += step.pitchOffset;
+
+        updateArticulationBoundaries(type, subNoteCtx.timestamp,
+                                     subNoteCtx.duration, subNoteCtx.chordCtx.commonArticulations);
+
+        result.emplace_back(buildNoteEvent(std::move(subNoteCtx)));
     }
+
+    noteCtx.timestamp += stepsTemplate.overallOffset;
 }
 
 float DisclosurePattern::subNoteDurationTicks(const double bps) const
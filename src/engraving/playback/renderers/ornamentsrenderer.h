@@ -64,12 +64,28 @@ public:
                          mpe::PlaybackEventList& result);
 
 private:
+    //! NOTE sub-note of an expanded ornament, relative to the principal note
+    struct StepEvent {
+        mpe::timestamp_t timestampOffset = 0;
+        mpe::duration_t duration = 0;
+        mpe::pitch_level_t pitchOffset = 0;
+    };
+
+    struct StepEventsTemplate {
+        std::vector<StepEvent> steps;
+        mpe::timestamp_t overallOffset = 0;
+    };
+
     static void convert(const mpe::ArticulationType type, const DisclosurePattern& pattern, NominalNoteCtx&& noteCtx,
                         mpe::PlaybackEventList& result);
 
     static int alterationsNumberByTempo(const double beatsPerSeconds, const int principalNoteDurationTicks,
                                         const DisclosurePattern& pattern);
 
+    static const StepEventsTemplate& stepEventsTemplate(const int alterationsCount, const int availableDurationTicks,
+                                                        const int overallDurationTicks, const mpe::duration_t nominalDuration,
+                                                        const std::vector<mpe::pitch_level_t>& pitchOffsets);
+
     static void createEvents(const mpe::ArticulationType type, NominalNoteCtx& noteCtx, const int alterationsCount,
                              const int availableDurationTicks, const int overallDurationTicks,
                              const std::vector<mpe::pitch_level_t>& pitchOffsets, mpe::PlaybackEventList& result);
@@ -22,6 +22,8 @@
 
 #include "tremolorenderer.h"
 
+#include <algorithm>
+
 #include "libmscore/chord.h"
 #include "libmscore/tremolo.h"
 
@@ -71,21 +73,26 @@ void TremoloRenderer::doRender(const EngravingItem* item, const mpe::Articulatio
             return;
         }
 
-        for (int i = 0; i < stepsCount; ++i) {
-            const Chord* currentChord = firstTremoloChord;
+        const std::vector<NominalNoteCtx> firstChordCtxList = buildNoteCtxList(firstTremoloChord, context);
+        const std::vector<NominalNoteCtx> secondChordCtxList = buildNoteCtxList(secondTremoloChord, context);
 
-            if (i % 2 != 0) {
-                currentChord = secondTremoloChord;
-            }
+        result.reserve(result.size() + stepsCount * std::max(firstChordCtxList.size(), secondChordCtxList.size()));
+
+        for (int i = 0; i < stepsCount; ++i) {
+            const std::vector<NominalNoteCtx>& currentCtxList = i % 2 == 0 ? firstChordCtxList : secondChordCtxList;
 
-            buildAndAppendEvents(currentChord, preferredType, stepDuration, i * stepDuration, context, result);
+            buildAndAppendEvents(currentCtxList, preferredType, stepDuration, i * stepDuration, result);
         }
 
         return;
     }
 
+    const std::vector<NominalNoteCtx> chordCtxList = buildNoteCtxList(chord, context);
+
+    result.reserve(result.size() + stepsCount * chordCtxList.size());
+
     for (int i = 0; i < stepsCount; ++i) {
-        buildAndAppendEvents(chord, preferredType, stepDuration, i * stepDuration, context, result);
+        buildAndAppendEvents(chordCtxList, preferredType, stepDuration, i * stepDuration, result);
     }
 }
 
@@ -98,19 +105,31 @@ int TremoloRenderer::stepDurationTicks(const Chord* chord, const Tremolo* tremol
     return ticks * chord->timeStretchFactor();
 }
 
-void TremoloRenderer::buildAndAppendEvents(const Chord* chord, const ArticulationType type,
-                                           const mpe::duration_t stepDuration,
-                                           const mpe::timestamp_t timestampOffset, const RenderingContext& context,
-                                           mpe::PlaybackEventList& result)
+//! NOTE the per-note contexts are resolved once per chord, so that each
+//! tremolo step only offsets the ready-made contexts by its timestamp
+std::vector<NominalNoteCtx> TremoloRenderer::buildNoteCtxList(const Chord* chord, const RenderingContext& context)
 {
-    for (size_t noteIdx = 0; noteIdx < chord->notes().size(); ++noteIdx) {
-        const Note* note = chord->notes().at(noteIdx);
+    std::vector<NominalNoteCtx> result;
+    result.reserve(chord->notes().size());
 
+    for (const Note* note : chord->notes()) {
         if (!isNotePlayable(note, context.commonArticulations)) {
             continue;
         }
 
-        NominalNoteCtx noteCtx(note, context);
+        result.emplace_back(note, context);
+    }
+
+    return result;
+}
+
+void TremoloRenderer::buildAndAppendEvents(const std::vector<NominalNoteCtx>& noteCtxList, const ArticulationType type,
+                                           const mpe::duration_t stepDuration,
+                                           const mpe::timestamp_t timestampOffset,
+                                           mpe::PlaybackEventList& result)
+{
+    for (const NominalNoteCtx& baseNoteCtx : noteCtxList) {
+        NominalNoteCtx noteCtx(baseNoteCtx);
         noteCtx.duration = stepDuration;
         noteCtx.timestamp += timestampOffset;
 
@@ -38,8 +38,9 @@ public:
 
 private:
     static int stepDurationTicks(const Chord* chord, const Tremolo* tremolo);
-    static void buildAndAppendEvents(const Chord* chord, const mpe::ArticulationType type, const mpe::duration_t stepDuration,
-                                     const mpe::timestamp_t timestampOffset, const RenderingContext& context,
+    static std::vector<NominalNoteCtx> buildNoteCtxList(const Chord* chord, const RenderingContext& context);
+    static void buildAndAppendEvents(const std::vector<NominalNoteCtx>& noteCtxList, const mpe::ArticulationType type,
+                                     const mpe::duration_t stepDuration, const mpe::timestamp_t timestampOffset,
                                      mpe::PlaybackEventList& result);
 };
 }
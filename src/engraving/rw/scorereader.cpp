@@ -21,6 +21,9 @@
  */
 #include "scorereader.h"
 
+#include <future>
+#include <memory>
+
 #include "io/buffer.h"
 
 #include "compat/readstyle.h"
@@ -103,7 +106,22 @@ mu::Ret ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscRead
     // Read excerpts
     if (masterScore->mscVersion() >= 400) {
         std::vector<String> excerptNames = mscReader.excerptNames();
+
+        //! NOTE the excerpt documents are independent of each other until their elements
+        //! are read, so tokenize them on background threads while the preceding ones are
+        //! being read; the element reading itself has to stay serial, because it attaches
+        //! to the shared master score and resolves links through the shared context
+        std::vector<std::future<std::unique_ptr<XmlReader> > > parsedExcerpts;
+        parsedExcerpts.reserve(excerptNames.size());
         for (const String& excerptName : excerptNames) {
+            ByteArray excerptData = mscReader.readExcerptFile(excerptName);
+            parsedExcerpts.push_back(std::async(std::launch::async, [data = std::move(excerptData)]() {
+                return std::make_unique<XmlReader>(data);
+            }));
+        }
+
+        for (size_t i = 0; i < excerptNames.size(); ++i) {
+            const String& excerptName = excerptNames.at(i);
             Score* partScore = masterScore->createScore();
 
             compat::ReadStyleHook::setupDefaultStyle(partScore);
@@ -116,19 +134,17 @@ mu::Ret ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscRead
             excerptStyleBuf.open(IODevice::ReadOnly);
             partScore->style().read(&excerptStyleBuf);
 
-            ByteArray excerptData = mscReader.readExcerptFile(excerptName);
-
             ReadContext ctx(partScore);
             ctx.initLinks(masterScoreCtx);
 
-            XmlReader xml(excerptData);
-            xml.setDocName(excerptName);
-            xml.setContext(&ctx);
+            std::unique_ptr<XmlReader> xml = parsedExcerpts[i].get();
+            xml->setDocName(excerptName);
+            xml->setContext(&ctx);
 
-            Read400::read400(partScore, xml, ctx);
+            Read400::read400(partScore, *xml, ctx);
 
             partScore->linkMeasures(masterScore);
-            ex->setTracksMapping(xml.context()->tracks());
+            ex->setTracksMapping(xml->context()->tracks());
 
             ex->setName(excerptName);
 
@@ -229,3 +245,118 @@ Err ScoreReader::doRead(MasterScore* score, XmlReader& e, ReadContext& ctx)
 
     return Err::NoError;
 }
+
+mu::Ret ScoreReader::validateMscz(const MscReader& mscReader, bool ignoreVersionError) const
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(mscReader.isOpened()) {
+        return make_ret(Err::FileOpenError, mscReader.params().filePath);
+    }
+
+    ByteArray scoreData = mscReader.readScoreFile();
+    if (scoreData.empty()) {
+        return make_ret(Err::FileCorrupted, mscReader.params().filePath);
+    }
+
+    int mscVersion = 0;
+    Ret ret = validateScoreFile(scoreData, ignoreVersionError, &mscVersion);
+    if (!ret) {
+        return ret;
+    }
+
+    {
+        ByteArray styleData = mscReader.readStyleFile();
+        if (!styleData.empty()) {
+            ret = validateXmlFile(styleData);
+            if (!ret) {
+                return ret;
+            }
+        }
+    }
+
+    if (mscVersion >= 400) {
+        for (const String& excerptName : mscReader.excerptNames()) {
+            ret = validateXmlFile(mscReader.readExcerptFile(excerptName));
+            if (!ret) {
+                return ret;
+            }
+        }
+    }
+
+    return make_ok();
+}
+
+mu::Ret ScoreReader::validateScoreFile(const ByteArray& data, bool ignoreVersionError, int* mscVersion) const
+{
+    XmlReader e(data);
+
+    while (e.readNextStartElement()) {
+        if (e.name() != "museScore") {
+            e.skipCurrentElement();
+            continue;
+        }
+
+        const String& version = e.attribute("version");
+        StringList sl = version.split('.');
+        if (sl.size() < 2) {
+            return Ret(static_cast<int>(Err::FileBadFormat), "invalid version: " + version.toStdString());
+        }
+
+        int ver = sl[0].toInt() * 100 + sl[1].toInt();
+        if (mscVersion) {
+            *mscVersion = ver;
+        }
+
+        if (!ignoreVersionError) {
+            if (ver > MSCVERSION) {
+                return make_ret(Err::FileTooNew);
+            }
+            if (ver < 114) {
+                return make_ret(Err::FileTooOld);
+            }
+            if (ver == 300) {
+                return make_ret(Err::FileOld300Format);
+            }
+        }
+
+        bool hasScore = false;
+        while (e.readNextStartElement()) {
+            if (e.name() == "Score") {
+                hasScore = true;
+            }
+            //! NOTE skipping still tokenizes the subtree, so any
+            //! well-formedness error inside surfaces on e.error()
+            e.skipCurrentElement();
+        }
+
+        if (e.error() != XmlStreamReader::NoError) {
+            return Ret(static_cast<int>(Err::FileCorrupted), e.errorString().toStdString());
+        }
+
+        //! NOTE versions before 2.0 keep the score content directly under
+        //! the root element, so a Score child is only required from 200 on
+        if (ver >= 200 && !hasScore) {
+            return Ret(static_cast<int>(Err::FileBadFormat), "no Score element");
+        }
+
+        return make_ok();
+    }
+
+    return Ret(static_cast<int>(Err::FileCorrupted), e.errorString().toStdString());
+}
+
+mu::Ret ScoreReader::validateXmlFile(const ByteArray& data) const
+{
+    XmlReader e(data);
+
+    while (e.readNextStartElement()) {
+        e.skipCurrentElement();
+    }
+
+    if (e.error() != XmlStreamReader::NoError) {
+        return Ret(static_cast<int>(Err::FileCorrupted), e.errorString().toStdString());
+    }
+
+    return make_ok();
+}
@@ -38,12 +38,23 @@ public:
 
     Ret loadMscz(MasterScore* score, const MscReader& mscReader, SettingsCompat& settingsCompat, bool ignoreVersionError);
 
+    //! NOTE structural verification of an mscz container without building the
+    //! object model: the score (and excerpt/style) XML is tokenized to the end,
+    //! the root element, the version and the presence of a Score element are
+    //! checked. Intended as a cheap reject path for untrusted uploads; a file
+    //! that validates can still fail the full read, but a malformed one is
+    //! turned away at a fraction of the cost of instantiating a score
+    Ret validateMscz(const MscReader& mscReader, bool ignoreVersionError = false) const;
+
 private:
 
     friend class MasterScore;
 
     Ret read(MasterScore* score, XmlReader&, ReadContext& ctx, compat::ReadStyleHook* styleHook = nullptr);
     Err doRead(MasterScore* score, XmlReader& e, ReadContext& ctx);
+
+    Ret validateScoreFile(const ByteArray& data, bool ignoreVersionError, int* mscVersion) const;
+    Ret validateXmlFile(const ByteArray& data) const;
 };
 }
 
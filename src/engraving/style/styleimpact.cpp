@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "styleimpact.h"
+
+namespace mu::engraving {
+const std::set<Sid>& measureLayoutIndependentStyles()
+{
+    //! NOTE Deliberately conservative: a style id is only listed here if it
+    //! demonstrably cannot change anything inside a measure. Everything not
+    //! listed (note spacing, text styles, beams, accidentals, ...) is treated
+    //! as measure-affecting. Sid::spatium is page style but scales all of the
+    //! measure content, so it must not appear here.
+    static const std::set<Sid> styles {
+        // page geometry
+        Sid::pageWidth,
+        Sid::pageHeight,
+        Sid::pagePrintableWidth,
+        Sid::pageEvenTopMargin,
+        Sid::pageEvenBottomMargin,
+        Sid::pageEvenLeftMargin,
+        Sid::pageOddTopMargin,
+        Sid::pageOddBottomMargin,
+        Sid::pageOddLeftMargin,
+        Sid::pageTwosided,
+
+        // vertical packing of staves/systems on the page
+        Sid::staffUpperBorder,
+        Sid::staffLowerBorder,
+        Sid::staffDistance,
+        Sid::akkoladeDistance,
+        Sid::minSystemDistance,
+        Sid::maxSystemDistance,
+        Sid::enableVerticalSpread,
+        Sid::spreadSystem,
+        Sid::spreadSquareBracket,
+        Sid::spreadCurlyBracket,
+        Sid::minStaffSpread,
+        Sid::maxStaffSpread,
+        Sid::maxAkkoladeDistance,
+        Sid::maxPageFillSpread,
+        Sid::frameSystemDistance,
+
+        // headers and footers live outside the systems
+        Sid::showHeader,
+        Sid::headerFirstPage,
+        Sid::headerOddEven,
+        Sid::evenHeaderL,
+        Sid::evenHeaderC,
+        Sid::evenHeaderR,
+        Sid::oddHeaderL,
+        Sid::oddHeaderC,
+        Sid::oddHeaderR,
+        Sid::showFooter,
+        Sid::footerFirstPage,
+        Sid::footerOddEven,
+        Sid::evenFooterL,
+        Sid::evenFooterC,
+        Sid::evenFooterR,
+        Sid::oddFooterL,
+        Sid::oddFooterC,
+        Sid::oddFooterR,
+    };
+
+    return styles;
+}
+
+bool styleChangeAffectsMeasureLayout(Sid sid)
+{
+    if (sid == Sid::NOSTYLE) {
+        return true; // unknown change, assume the worst
+    }
+
+    return measureLayoutIndependentStyles().find(sid) == measureLayoutIndependentStyles().end();
+}
+}
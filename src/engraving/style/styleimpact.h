@@ -0,0 +1,39 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_STYLEIMPACT_H
+#define MU_ENGRAVING_STYLEIMPACT_H
+
+#include <set>
+
+#include "styledef.h"
+
+namespace mu::engraving {
+//! NOTE Style ids whose value cannot influence the layout of the content
+//! inside a measure: page geometry, headers/footers and the vertical
+//! packing of systems and pages. Changing one of them still requires a
+//! system/page layout pass, but the per-measure layout caches stay valid.
+const std::set<Sid>& measureLayoutIndependentStyles();
+
+bool styleChangeAffectsMeasureLayout(Sid sid);
+}
+
+#endif // MU_ENGRAVING_STYLEIMPACT_H
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "libmscore/masterscore.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//! NOTE enough samples to average out scheduler noise while keeping
+//! the wall time of the whole suite in the low seconds
+static constexpr int ITERATIONS = 10;
+
+//---------------------------------------------------------
+//   Engraving_LayoutBenchmark
+//    times full doLayoutRange passes over a corpus of
+//    representative scores shared with the correctness
+//    tests, and prints one machine-readable result line
+//    per score for regression tracking
+//---------------------------------------------------------
+
+class Engraving_LayoutBenchmark : public ::testing::Test
+{
+public:
+    void benchLayout(const String& path, const char* name);
+};
+
+void Engraving_LayoutBenchmark::benchLayout(const String& path, const char* name)
+{
+    MasterScore* score = ScoreRW::readScore(path);
+    ASSERT_TRUE(score);
+
+    //! NOTE the first layout after reading warms up the symbol font and
+    //! metrics caches, so it is not sampled
+    score->doLayout();
+
+    std::vector<double> samples;
+    samples.reserve(ITERATIONS);
+
+    for (int i = 0; i < ITERATIONS; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        score->doLayout();
+        auto stop = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+
+    //! NOTE one JSON object per line prefixed with a fixed tag, so CI can
+    //! collect results with a line parser without depending on gtest output
+    std::printf("BENCHMARK_RESULT {\"suite\":\"engraving_layout\",\"score\":\"%s\",\"measures\":%zu,"
+                "\"iterations\":%d,\"min_ms\":%.3f,\"median_ms\":%.3f,\"avg_ms\":%.3f}\n",
+                name, score->nmeasures(), ITERATIONS,
+                samples.front(), samples.at(samples.size() / 2), sum / samples.size());
+    std::fflush(stdout);
+
+    delete score;
+}
+
+TEST_F(Engraving_LayoutBenchmark, Goldberg)
+{
+    benchLayout(u"all_elements_data/goldberg.mscx", "goldberg");
+}
+
+TEST_F(Engraving_LayoutBenchmark, Moonlight)
+{
+    benchLayout(u"all_elements_data/moonlight.mscx", "moonlight");
+}
+
+TEST_F(Engraving_LayoutBenchmark, MultiStaffOrchestral)
+{
+    benchLayout(u"concertpitch_data/concertpitchbenchmark.mscx", "concertpitchbenchmark");
+}
@@ -21,6 +21,8 @@
  */
 #include "typesconv.h"
 
+#include <map>
+
 #include "types/translatablestring.h"
 
 #include "symnames.h"
@@ -76,35 +78,38 @@ static AsciiStringView findXmlTagByType(const C& cont, const T& v)
 }
 
 template<typename T, typename C>
-static T findTypeByXmlTag(const C& cont, const String& tag, T def)
+static T findTypeByXmlTag(const C& cont, const AsciiStringView& tag, T def, bool silent = false)
 {
-    ByteArray ba = tag.toAscii();
-    auto it = std::find_if(cont.cbegin(), cont.cend(), [ba](const Item<T>& i) {
-        return i.xml == ba.constChar();
-    });
+    //! NOTE loading a score resolves many thousands of tags through these tables,
+    //! so look them up via a lazily built index instead of scanning the table
+    //! (the same approach as SymNames); the index is per table, because some
+    //! enums are served by more than one table
+    static std::map<const C*, std::map<AsciiStringView, T> > indexes;
 
-    IF_ASSERT_FAILED(it != cont.cend()) {
-        return def;
+    std::map<AsciiStringView, T>& index = indexes[&cont];
+    if (index.empty()) {
+        for (auto it = cont.cbegin(); it != cont.cend(); ++it) {
+            index.insert({ it->xml, it->type });
+        }
     }
-    return it->type;
-}
 
-template<typename T, typename C>
-static T findTypeByXmlTag(const C& cont, const AsciiStringView& tag, T def, bool silent = false)
-{
-    auto it = std::find_if(cont.cbegin(), cont.cend(), [tag](const Item<T>& i) {
-        return i.xml == tag;
-    });
-
-    if (it == cont.cend()) {
+    auto it = index.find(tag);
+    if (it == index.cend()) {
         if (!silent) {
             LOGE() << "not found type for tag: " << tag;
-            assert(it != cont.cend());
+            assert(it != index.cend());
         }
         return def;
     }
 
-    return it->type;
+    return it->second;
+}
+
+template<typename T, typename C>
+static T findTypeByXmlTag(const C& cont, const String& tag, T def)
+{
+    ByteArray ba = tag.toAscii();
+    return findTypeByXmlTag(cont, AsciiStringView(ba.constChar()), def);
 }
 
 // ==========================================================
@@ -22,12 +22,52 @@
 #ifndef MU_ACTIONS_IACTIONSDISPATCHER_H
 #define MU_ACTIONS_IACTIONSDISPATCHER_H
 
+#include <cstdint>
 #include <functional>
+#include <vector>
+
 #include "modularity/imoduleexport.h"
 #include "actiontypes.h"
 
 namespace mu::actions {
 class Actionable;
+class ActionsDispatcher;
+
+//! NOTE precompiled dispatch handle for high-frequency actions
+//! (note input keystrokes and the like): the dispatcher resolves the
+//! handler list once and caches it inside the handle, so repeated
+//! dispatches through the same handle skip the per-dispatch string
+//! lookups. The cache is revalidated automatically when handlers are
+//! registered or unregistered, so a handle can be kept for the
+//! lifetime of the application.
+class ActionHandle
+{
+public:
+    ActionHandle() = default;
+    explicit ActionHandle(const ActionCode& code)
+        : m_code(code) {}
+
+    const ActionCode& code() const { return m_code; }
+    bool isValid() const { return !m_code.empty(); }
+
+private:
+    friend class ActionsDispatcher;
+
+    using CallBack = std::function<void (const ActionCode&, const ActionData&)>;
+
+    struct Resolved {
+        Actionable* client = nullptr;
+        const CallBack* callback = nullptr;
+    };
+
+    ActionCode m_code;
+
+    //! NOTE 0 means "not resolved yet"; the dispatcher compares it with
+    //! its registry generation and re-resolves on mismatch
+    mutable uint64_t m_generation = 0;
+    mutable std::vector<Resolved> m_resolved;
+};
+
 class IActionsDispatcher : MODULE_EXPORT_INTERFACE
 {
     INTERFACE_ID(IActionsDispatcher)
@@ -42,6 +82,9 @@ public:
     virtual void dispatch(const ActionCode& actionCode) = 0;
     virtual void dispatch(const ActionCode& actionCode, const ActionData& data) = 0;
 
+    virtual void dispatch(const ActionHandle& handle) = 0;
+    virtual void dispatch(const ActionHandle& handle, const ActionData& data) = 0;
+
     virtual void unReg(Actionable* client) = 0;
     virtual void reg(Actionable* client, const ActionCode& actionCode, const ActionCallBackWithNameAndData& call) = 0;
 
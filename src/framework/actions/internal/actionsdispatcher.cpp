@@ -75,6 +75,65 @@ void ActionsDispatcher::dispatch(const ActionCode& actionCode, const ActionData&
     }
 }
 
+void ActionsDispatcher::dispatch(const ActionHandle& handle)
+{
+    static ActionData dummy;
+    dispatch(handle, dummy);
+}
+
+void ActionsDispatcher::dispatch(const ActionHandle& handle, const ActionData& data)
+{
+    if (handle.m_generation != m_generation) {
+        resolve(handle);
+    }
+
+    if (handle.m_resolved.empty()) {
+        LOGW() << "not a registered action: " << handle.code();
+        return;
+    }
+
+    //! NOTE same semantics as dispatch(actionCode, data), but the clients
+    //! and callbacks were resolved once when the handle was (re)compiled,
+    //! so the hot path does no map lookups and no per-call logging
+    int canReceiveCount = 0;
+    for (const ActionHandle::Resolved& r : handle.m_resolved) {
+        if (r.client->canReceiveAction(handle.code())) {
+            ++canReceiveCount;
+            (*r.callback)(handle.code(), data);
+        }
+    }
+
+    if (canReceiveCount == 0) {
+        LOGI() << "no one can handle the action: " << handle.code();
+    } else if (canReceiveCount > 1) {
+        LOGW() << "More than one client can handle the action, this is not a typical situation.";
+    }
+}
+
+void ActionsDispatcher::resolve(const ActionHandle& handle) const
+{
+    handle.m_resolved.clear();
+    handle.m_generation = m_generation;
+
+    auto it = m_clients.find(handle.code());
+    if (it == m_clients.end()) {
+        return;
+    }
+
+    const Clients& clients = it->second;
+    for (auto cit = clients.cbegin(); cit != clients.cend(); ++cit) {
+        const CallBacks& callbacks = cit->second;
+        auto cbit = callbacks.find(handle.code());
+        IF_ASSERT_FAILED(cbit != callbacks.end()) {
+            continue;
+        }
+
+        //! NOTE pointers to std::map values stay valid until the entry is
+        //! erased, and any erase bumps the generation
+        handle.m_resolved.push_back({ cit->first, &cbit->second });
+    }
+}
+
 void ActionsDispatcher::unReg(Actionable* client)
 {
     for (auto it = m_clients.begin(); it != m_clients.end(); ++it) {
@@ -82,6 +141,8 @@ void ActionsDispatcher::unReg(Actionable* client)
         clients.erase(client);
     }
     client->setDispatcher(nullptr);
+
+    ++m_generation;
 }
 
 void ActionsDispatcher::reg(Actionable* client, const ActionCode& actionCode, const ActionCallBackWithNameAndData& call)
@@ -91,4 +152,6 @@ void ActionsDispatcher::reg(Actionable* client, const ActionCode& actionCode, co
     Clients& clients = m_clients[actionCode];
     CallBacks& callbacks = clients[client];
     callbacks.insert({ actionCode, call });
+
+    ++m_generation;
 }
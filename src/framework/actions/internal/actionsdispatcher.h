@@ -36,6 +36,9 @@ public:
     void dispatch(const ActionCode& actionCode) override;
     void dispatch(const ActionCode& actionCode, const ActionData& data) override;
 
+    void dispatch(const ActionHandle& handle) override;
+    void dispatch(const ActionHandle& handle, const ActionData& data) override;
+
     void unReg(Actionable* client) override;
     void reg(Actionable* client, const ActionCode& actionCode, const ActionCallBackWithNameAndData& call) override;
 
@@ -44,7 +47,13 @@ private:
     using CallBacks = std::map<ActionCode, ActionCallBackWithNameAndData>;
     using Clients = std::map<Actionable*, CallBacks>;
 
+    void resolve(const ActionHandle& handle) const;
+
     std::map<ActionCode, Clients > m_clients;
+
+    //! NOTE bumped on every reg/unReg; handles resolved against an older
+    //! generation are re-resolved on their next dispatch
+    uint64_t m_generation = 1;
 };
 }
 
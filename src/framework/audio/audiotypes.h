@@ -23,6 +23,8 @@
 #ifndef MU_AUDIO_AUDIOTYPES_H
 #define MU_AUDIO_AUDIOTYPES_H
 
+#include <array>
+#include <map>
 #include <variant>
 #include <memory>
 #include <set>
@@ -315,6 +317,23 @@ private:
     std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
 };
 
+//! NOTE snapshot of the real-time path costs, assembled on the audio worker thread
+//! from counters that the processing callback updates without taking locks
+struct AudioWorkerPerformanceStats {
+    //! NOTE bucket i counts the callbacks that took [2^i .. 2^(i+1)) microseconds
+    static constexpr size_t HISTOGRAM_SIZE = 16;
+
+    uint64_t callbackCount = 0;
+    uint64_t totalCallbackNsecs = 0;
+    uint64_t maxCallbackNsecs = 0;
+    std::array<uint64_t, HISTOGRAM_SIZE> callbackUsecsHistogram {};
+
+    //! NOTE worst observed render cost per mixer channel, keyed by track
+    std::map<TrackId, uint64_t> maxChannelNsecs;
+
+    uint64_t underrunCount = 0;
+};
+
 enum class PlaybackStatus {
     Stopped = 0,
     Paused,
@@ -51,6 +51,8 @@ public:
     virtual async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
     virtual async::Promise<AudioSignalChanges> masterSignalChanges() const = 0;
 
+    virtual async::Promise<AudioWorkerPerformanceStats> performanceStats() const = 0;
+
     virtual async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                 const SoundTrackFormat& format) = 0;
     virtual void abortSavingAllSoundTracks() = 0;
@@ -25,6 +25,8 @@
 
 #include <map>
 #include <set>
+#include <vector>
+#include <algorithm>
 
 #include "async/asyncable.h"
 #include "async/notification.h"
@@ -68,8 +70,10 @@ public:
         });
 
         m_mainStreamChanges.onReceive(this, [this](const mpe::PlaybackEventsMap& changes) {
-            m_playbackEventsMap = changes;
+            //! NOTE the previous map must still be around while the update runs,
+            //! so that a sequencer can diff the incoming one against it
             updateMainStreamEvents(changes);
+            m_playbackEventsMap = changes;
         });
 
         m_dynamicLevelChanges.onReceive(this, [this](const mpe::DynamicLevelMap& changes) {
@@ -164,16 +168,57 @@ public:
     }
 
 protected:
+    //! NOTE flat position -> node checkpoints of an event map, so that repositioning
+    //! during scrub/loop seeking is a binary search over contiguous memory instead of
+    //! a tree walk; rebuilt together with the map whenever its stream is refilled
+    class SeekIndex
+    {
+    public:
+        void rebuild(const EventSequenceMap& source)
+        {
+            m_source = &source;
+            m_checkpoints.clear();
+            m_checkpoints.reserve(source.size());
+
+            for (auto it = source.cbegin(); it != source.cend(); ++it) {
+                m_checkpoints.emplace_back(it->first, it);
+            }
+        }
+
+        SequenceIterator lowerBound(const EventSequenceMap& source, const msecs_t position) const
+        {
+            if (m_source != &source) {
+                return source.lower_bound(position);
+            }
+
+            auto it = std::lower_bound(m_checkpoints.cbegin(), m_checkpoints.cend(), position,
+                                       [](const std::pair<msecs_t, SequenceIterator>& checkpoint, const msecs_t pos) {
+                return checkpoint.first < pos;
+            });
+
+            if (it == m_checkpoints.cend()) {
+                return source.cend();
+            }
+
+            return it->second;
+        }
+
+    private:
+        const EventSequenceMap* m_source = nullptr;
+        std::vector<std::pair<msecs_t, SequenceIterator> > m_checkpoints;
+    };
+
     void resetAllIterators()
     {
-        updateMainSequenceIterator();
+        m_currentMainSequenceIt = m_mainSeekIndex.lowerBound(m_mainStreamEvents, m_playbackPosition);
         updateOffSequenceIterator();
-        updateDynamicChangesIterator();
+        m_currentDynamicsIt = m_dynamicsSeekIndex.lowerBound(m_dynamicEvents, m_playbackPosition);
     }
 
     void updateMainSequenceIterator()
     {
-        m_currentMainSequenceIt = m_mainStreamEvents.lower_bound(m_playbackPosition);
+        m_mainSeekIndex.rebuild(m_mainStreamEvents);
+        m_currentMainSequenceIt = m_mainSeekIndex.lowerBound(m_mainStreamEvents, m_playbackPosition);
     }
 
     void updateOffSequenceIterator()
@@ -183,7 +228,8 @@ protected:
 
     void updateDynamicChangesIterator()
     {
-        m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
+        m_dynamicsSeekIndex.rebuild(m_dynamicEvents);
+        m_currentDynamicsIt = m_dynamicsSeekIndex.lowerBound(m_dynamicEvents, m_playbackPosition);
     }
 
     void handleOffStream(EventSequence& result, const msecs_t nextMsecs)
@@ -194,13 +240,23 @@ protected:
 
         if (m_currentOffSequenceIt->first <= nextMsecs) {
             result = m_currentOffSequenceIt->second;
-            m_currentOffSequenceIt = m_offStreamEvents.erase(m_currentOffSequenceIt);
-        } else {
-            auto node = m_offStreamEvents.extract(m_currentOffSequenceIt);
-            node.key() -= nextMsecs;
-            m_offStreamEvents.insert(std::move(node));
-            updateOffSequenceIterator();
+            m_offStreamEvents.erase(m_currentOffSequenceIt);
+        }
+
+        //! NOTE the elapsed time concerns every pending group, not only the
+        //! front one: otherwise a group queued behind the front (e.g. the
+        //! note-off of an auditioned note) waits its full relative delay over
+        //! again once the front group has been played
+        if (!m_offStreamEvents.empty()) {
+            EventSequenceMap shifted;
+            for (auto& pair : m_offStreamEvents) {
+                msecs_t key = pair.first <= nextMsecs ? 0 : pair.first - nextMsecs;
+                shifted[key].insert(pair.second.cbegin(), pair.second.cend());
+            }
+            m_offStreamEvents = std::move(shifted);
         }
+
+        updateOffSequenceIterator();
     }
 
     void handleMainStream(EventSequence& result)
@@ -237,6 +293,11 @@ protected:
     EventSequenceMap m_offStreamEvents;
     EventSequenceMap m_dynamicEvents;
 
+    //! NOTE the off stream has no index, as it is consumed from the beginning and
+    //! mutated on every callback
+    SeekIndex m_mainSeekIndex;
+    SeekIndex m_dynamicsSeekIndex;
+
     mpe::DynamicLevelMap m_dynamicLevelMap;
     mpe::PlaybackEventsMap m_playbackEventsMap;
 
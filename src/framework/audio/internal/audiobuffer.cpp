@@ -107,12 +107,18 @@ struct BaseBufferProfiler {
 static BaseBufferProfiler READ_PROFILE("READ_PROFILE", 3000);
 static BaseBufferProfiler WRITE_PROFILE("WRITE_PROFILE", 0);
 
+//! NOTE how many stable forward() calls have to pass before the target fill level is lowered a step
+static constexpr size_t STABLE_FORWARDS_TO_SHRINK = 1000;
+
 void AudioBuffer::init(const audioch_t audioChannelsCount, const samples_t renderStep)
 {
     m_samplesPerChannel = DEFAULT_SIZE_PER_CHANNEL;
     m_audioChannelsCount = audioChannelsCount;
     m_renderStep = renderStep;
 
+    m_targetReserve = DEFAULT_SIZE / 2;
+    m_lowWaterMark.store(DEFAULT_SIZE, std::memory_order_relaxed);
+
     m_data.resize(m_samplesPerChannel * m_audioChannelsCount, 0.f);
 }
 
@@ -135,11 +141,13 @@ void AudioBuffer::forward()
         return;
     }
 
+    adaptTargetReserve();
+
     const auto currentWriteIdx = m_writeIndex.load(std::memory_order_relaxed);
     const auto currentReadIdx = m_readIndex.load(std::memory_order_acquire);
     size_t nextWriteIdx = currentWriteIdx;
 
-    samples_t framesToReserve = DEFAULT_SIZE / 2;
+    const size_t framesToReserve = m_targetReserve;
 
     while (reservedFrames(nextWriteIdx, currentReadIdx) < framesToReserve) {
         m_source->process(m_data.data() + nextWriteIdx, m_renderStep);
@@ -155,10 +163,18 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
     const auto currentReadIdx = m_readIndex.load(std::memory_order_relaxed);
     const auto currentWriteIdx = m_writeIndex.load(std::memory_order_acquire);
     if (currentReadIdx == currentWriteIdx) { // empty queue
+        m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+        m_lowWaterMark.store(0, std::memory_order_relaxed);
+
         std::memcpy(dest, SILENT_FRAMES.data(), sampleCount * sizeof(float) * m_audioChannelsCount);
         return;
     }
 
+    const size_t reserved = reservedFrames(currentWriteIdx, currentReadIdx);
+    if (reserved < m_lowWaterMark.load(std::memory_order_relaxed)) {
+        m_lowWaterMark.store(reserved, std::memory_order_relaxed);
+    }
+
     if (reservedFrames(currentWriteIdx, currentReadIdx) < (sampleCount * 2)) {
         static size_t missingFramesTotal = 0;
         missingFramesTotal += (sampleCount * 2);
@@ -199,6 +215,42 @@ void AudioBuffer::setMinSamplesToReserve(size_t lag)
     m_minSamplesToReserve = lag;
 }
 
+size_t AudioBuffer::underrunCount() const
+{
+    return m_underrunCount.load(std::memory_order_relaxed);
+}
+
+//! NOTE adjusts the target fill level to the machine: every underrun doubles it,
+//! while a long stretch of callbacks that never came close to draining the buffer
+//! lowers it one render step at a time, trading the reserve back for latency
+void AudioBuffer::adaptTargetReserve()
+{
+    const size_t step = static_cast<size_t>(m_renderStep) * m_audioChannelsCount;
+    const size_t minReserve = std::max(m_minSamplesToReserve, step * 2);
+
+    const size_t underruns = m_underrunCount.load(std::memory_order_relaxed);
+    if (underruns != m_handledUnderruns) {
+        m_handledUnderruns = underruns;
+        m_targetReserve = std::min(m_targetReserve * 2, DEFAULT_SIZE / 2);
+        m_lowWaterMark.store(DEFAULT_SIZE, std::memory_order_relaxed);
+        m_stableForwardsCount = 0;
+
+        LOG_AUDIO() << "underrun #" << underruns << ", target reserve raised to " << m_targetReserve;
+        return;
+    }
+
+    if (++m_stableForwardsCount < STABLE_FORWARDS_TO_SHRINK) {
+        return;
+    }
+
+    m_stableForwardsCount = 0;
+
+    const size_t lowWaterMark = m_lowWaterMark.exchange(DEFAULT_SIZE, std::memory_order_relaxed);
+    if (lowWaterMark > step * 2 && m_targetReserve > minReserve + step) {
+        m_targetReserve -= step;
+    }
+}
+
 void AudioBuffer::reset()
 {
     m_readIndex.store(0, std::memory_order_release);
@@ -56,14 +56,27 @@ public:
     void pop(float* dest, size_t sampleCount);
     void setMinSamplesToReserve(size_t lag);
 
+    //! NOTE number of driver callbacks served with silence because the worker was behind
+    size_t underrunCount() const;
+
     void reset();
 
 private:
     size_t reservedFrames(const size_t writeIdx, const size_t readIdx) const;
     size_t incrementWriteIndex(const size_t writeIdx, const samples_t samplesPerChannel);
 
+    void adaptTargetReserve();
+
     size_t m_minSamplesToReserve = 0;
 
+    //! NOTE written by the worker thread only
+    size_t m_targetReserve = 0;
+    size_t m_handledUnderruns = 0;
+    size_t m_stableForwardsCount = 0;
+
+    alignas(cache_line_size) std::atomic<size_t> m_underrunCount = 0;
+    alignas(cache_line_size) std::atomic<size_t> m_lowWaterMark = 0;
+
     alignas(cache_line_size) std::atomic<size_t> m_writeIndex = 0;
     alignas(cache_line_size) std::atomic<size_t> m_readIndex = 0;
     alignas(cache_line_size) std::vector<float> m_data;
@@ -78,6 +78,10 @@ void AudioThread::main()
 
     AudioThread::ID = std::this_thread::get_id();
 
+    //! NOTE the worker polls its messages on every loop iteration,
+    //! so give it a lock-free queue to keep the driver callback producers from blocking it
+    mu::async::registerLockFreeQueue(AudioThread::ID);
+
     if (m_onStart) {
         m_onStart();
     }
@@ -92,6 +96,8 @@ void AudioThread::main()
         std::this_thread::sleep_for(std::chrono::milliseconds(2));
     }
 
+    mu::async::unregisterLockFreeQueue(AudioThread::ID);
+
     if (m_onFinished) {
         m_onFinished();
     }
@@ -49,6 +49,18 @@ inline float samplesRootMeanSquare(const float squaredSum, const samples_t sampl
     return std::sqrt(squaredSum / sampleCount);
 }
 
+inline float samplesPeakLevel(const float* buffer, const size_t samplesCount)
+{
+    float peak = 0.f;
+    for (size_t i = 0; i < samplesCount; ++i) {
+        float level = std::abs(buffer[i]);
+        if (level > peak) {
+            peak = level;
+        }
+    }
+    return peak;
+}
+
 inline float sampleAttackTimeCoefficient(const unsigned int sampleRate, const float attackTimeInSecs)
 {
     return std::exp(-std::log(9) / (sampleRate * attackTimeInSecs));
@@ -59,6 +71,16 @@ inline float sampleReleaseTimeCoefficient(const unsigned int sampleRate, const f
     return std::exp(-std::log(9) / (sampleRate * releaseTimeInSecs));
 }
 
+//! NOTE one-pole smoothing of a gain reduction envelope, shared by the dynamics processors:
+//! a falling gain follows the attack coefficient, a rising one the release coefficient
+inline float smoothGainReduction(const float previousGainReduction, const float newGainReduction,
+                                 const float attackTimeCoefficient, const float releaseTimeCoefficient)
+{
+    float coefficient = newGainReduction <= previousGainReduction ? attackTimeCoefficient : releaseTimeCoefficient;
+
+    return (coefficient * previousGainReduction) + ((1 - coefficient) * newGainReduction);
+}
+
 inline void multiplySamples(float* buffer, const audioch_t& audioChannelsCount,
                             const audioch_t& audioChannelNumber, const samples_t& samplesPerChannel,
                             const float& multiplier)
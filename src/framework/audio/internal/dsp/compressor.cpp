@@ -3,6 +3,7 @@
 #include "log.h"
 
 #include "audiomathutils.h"
+#include "mixkernels.h"
 
 using namespace mu::audio;
 using namespace mu::audio::dsp;
@@ -27,15 +28,8 @@ void Compressor::setIsActive(const bool active)
 
 volume_db_t Compressor::gainSmoothing(const float& newGainReduction) const
 {
-    float coefficient = 0.f;
-
-    if (newGainReduction <= m_previousGainReduction) {
-        coefficient = m_filterConfig.attackTimeCoefficient();
-    } else {
-        coefficient = m_filterConfig.releaseTimeCoefficient();
-    }
-
-    return (coefficient * m_previousGainReduction) + ((1 - coefficient) * newGainReduction);
+    return smoothGainReduction(m_previousGainReduction, newGainReduction,
+                               m_filterConfig.attackTimeCoefficient(), m_filterConfig.releaseTimeCoefficient());
 }
 
 volume_db_t Compressor::computeGain(const volume_db_t& logarithmSample) const
@@ -72,10 +66,8 @@ void Compressor::process(const float linearRms, float* buffer, const audioch_t&
 
     float currentGainReduction = std::min(gainFact, m_previousGainReduction);
 
-    // apply gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, currentGainReduction);
-    }
+    // apply gain, the same for all channels, over the whole interleaved block at once
+    applyGain(buffer, static_cast<size_t>(samplesPerChannel) * audioChannelsCount, currentGainReduction);
 
     m_previousGainReduction = currentGainReduction;
 }
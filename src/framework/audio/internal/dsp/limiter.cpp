@@ -1,6 +1,7 @@
 #include "limiter.h"
 
 #include "audiomathutils.h"
+#include "mixkernels.h"
 
 using namespace mu::audio;
 using namespace mu::audio::dsp;
@@ -24,15 +25,8 @@ void Limiter::setIsActive(const bool active)
 
 volume_db_t Limiter::gainSmoothing(const float newGainReduction) const
 {
-    float coefficient = 0.f;
-
-    if (newGainReduction <= m_previousGainReduction) {
-        coefficient = m_filterConfig.attackTimeCoefficient();
-    } else {
-        coefficient = m_filterConfig.releaseTimeCoefficient();
-    }
-
-    return (coefficient * m_previousGainReduction) + ((1 - coefficient) * newGainReduction);
+    return smoothGainReduction(m_previousGainReduction, newGainReduction,
+                               m_filterConfig.attackTimeCoefficient(), m_filterConfig.releaseTimeCoefficient());
 }
 
 volume_db_t Limiter::computeGain(const volume_db_t& logarithmSample) const
@@ -72,8 +66,6 @@ void Limiter::process(const float& linearRms, float* buffer, const audioch_t& au
     // total linear gain
     float totalLinearGain = linearFromDecibels(makeUpGain);
 
-    // apply linear gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, totalLinearGain);
-    }
+    // apply linear gain, the same for all channels, over the whole interleaved block at once
+    applyGain(buffer, static_cast<size_t>(samplesPerChannel) * audioChannelsCount, totalLinearGain);
 }
@@ -0,0 +1,167 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_MIXKERNELS_H
+#define MU_AUDIO_MIXKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "audiotypes.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MU_AUDIO_MIXKERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define MU_AUDIO_MIXKERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+//! NOTE vectorized kernels for the per-sample loops of the mixer, operating on the
+//! interleaved float buffers; each kernel carries a scalar fallback for platforms
+//! without SSE2/NEON
+
+namespace mu::audio::dsp {
+//! NOTE disables denormal float processing on the current thread for the lifetime
+//! of the guard; fx tails easily decay into the denormal range, where arithmetic
+//! becomes dramatically slower on most CPUs
+class DenormalsDisabler
+{
+public:
+    DenormalsDisabler()
+    {
+#if defined(MU_AUDIO_MIXKERNELS_SSE2)
+        m_previousState = _mm_getcsr();
+        _mm_setcsr(m_previousState | 0x8040); // FTZ | DAZ
+#elif defined(MU_AUDIO_MIXKERNELS_NEON) && defined(__aarch64__)
+        __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (m_previousState));
+        __asm__ __volatile__ ("msr fpcr, %0" : : "r" (m_previousState | (uint64_t(1) << 24))); // FZ
+#endif
+    }
+
+    ~DenormalsDisabler()
+    {
+#if defined(MU_AUDIO_MIXKERNELS_SSE2)
+        _mm_setcsr(m_previousState);
+#elif defined(MU_AUDIO_MIXKERNELS_NEON) && defined(__aarch64__)
+        __asm__ __volatile__ ("msr fpcr, %0" : : "r" (m_previousState));
+#endif
+    }
+
+private:
+#if defined(MU_AUDIO_MIXKERNELS_SSE2)
+    unsigned int m_previousState = 0;
+#elif defined(MU_AUDIO_MIXKERNELS_NEON) && defined(__aarch64__)
+    uint64_t m_previousState = 0;
+#endif
+};
+
+//! NOTE out[i] += in[i] over the whole interleaved buffer
+inline void mixSamples(float* out, const float* in, const size_t samplesCount)
+{
+    size_t i = 0;
+
+#if defined(MU_AUDIO_MIXKERNELS_SSE2)
+    for (; i + 4 <= samplesCount; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_loadu_ps(in + i)));
+    }
+#elif defined(MU_AUDIO_MIXKERNELS_NEON)
+    for (; i + 4 <= samplesCount; i += 4) {
+        vst1q_f32(out + i, vaddq_f32(vld1q_f32(out + i), vld1q_f32(in + i)));
+    }
+#endif
+
+    for (; i < samplesCount; ++i) {
+        out[i] += in[i];
+    }
+}
+
+//! NOTE buffer[i] *= gain over the whole interleaved buffer; used by the dynamics
+//! processors, which compute a single gain per block for all channels
+inline void applyGain(float* buffer, const size_t samplesCount, const float gain)
+{
+    size_t i = 0;
+
+#if defined(MU_AUDIO_MIXKERNELS_SSE2)
+    __m128 gains = _mm_set1_ps(gain);
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        _mm_storeu_ps(buffer + i, _mm_mul_ps(_mm_loadu_ps(buffer + i), gains));
+    }
+#elif defined(MU_AUDIO_MIXKERNELS_NEON)
+    float32x4_t gains = vdupq_n_f32(gain);
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        vst1q_f32(buffer + i, vmulq_f32(vld1q_f32(buffer + i), gains));
+    }
+#endif
+
+    for (; i < samplesCount; ++i) {
+        buffer[i] *= gain;
+    }
+}
+
+//! NOTE multiplies an interleaved stereo buffer by per-channel gains in place and
+//! accumulates the squared sample sums per channel for RMS metering
+inline void applyGainsStereo(float* buffer, const samples_t samplesPerChannel,
+                             const float* channelGains, float* channelSquaredSums)
+{
+    size_t samplesCount = static_cast<size_t>(samplesPerChannel) * 2;
+    size_t i = 0;
+
+#if defined(MU_AUDIO_MIXKERNELS_SSE2)
+    __m128 gains = _mm_setr_ps(channelGains[0], channelGains[1], channelGains[0], channelGains[1]);
+    __m128 squaredSums = _mm_setzero_ps();
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        __m128 samples = _mm_mul_ps(_mm_loadu_ps(buffer + i), gains);
+        _mm_storeu_ps(buffer + i, samples);
+        squaredSums = _mm_add_ps(squaredSums, _mm_mul_ps(samples, samples));
+    }
+
+    alignas(16) float sums[4];
+    _mm_store_ps(sums, squaredSums);
+    channelSquaredSums[0] += sums[0] + sums[2];
+    channelSquaredSums[1] += sums[1] + sums[3];
+#elif defined(MU_AUDIO_MIXKERNELS_NEON)
+    float32x4_t gains = { channelGains[0], channelGains[1], channelGains[0], channelGains[1] };
+    float32x4_t squaredSums = vdupq_n_f32(0.f);
+
+    for (; i + 4 <= samplesCount; i += 4) {
+        float32x4_t samples = vmulq_f32(vld1q_f32(buffer + i), gains);
+        vst1q_f32(buffer + i, samples);
+        squaredSums = vmlaq_f32(squaredSums, samples, samples);
+    }
+
+    channelSquaredSums[0] += vgetq_lane_f32(squaredSums, 0) + vgetq_lane_f32(squaredSums, 2);
+    channelSquaredSums[1] += vgetq_lane_f32(squaredSums, 1) + vgetq_lane_f32(squaredSums, 3);
+#endif
+
+    for (; i < samplesCount; ++i) {
+        float resultSample = buffer[i] * channelGains[i % 2];
+        buffer[i] = resultSample;
+        channelSquaredSums[i % 2] += resultSample * resultSample;
+    }
+}
+}
+
+#endif // MU_AUDIO_MIXKERNELS_H
@@ -69,6 +69,13 @@ public:
     virtual size_t encode(samples_t samplesPerChannel, const float* input) = 0;
     virtual size_t flush() = 0;
 
+    //! NOTE whether encode() may be called repeatedly with consecutive chunks of the
+    //! input instead of a single call covering the whole soundtrack
+    virtual bool supportsChunkedEncoding() const
+    {
+        return false;
+    }
+
     framework::Progress progress()
     {
         return m_progress;
@@ -22,6 +22,8 @@
 
 #include "flacencoder.h"
 
+#include <algorithm>
+
 #include "FLAC++/encoder.h"
 
 #include "log.h"
@@ -103,27 +105,27 @@ size_t FlacEncoder::encode(samples_t samplesPerChannel, const float* input)
         return 0;
     }
 
+    constexpr uint32_t FRAME_SIZE = 1024;
+
     size_t result = 0;
-    size_t totalSamplesNumber = samplesPerChannel * m_format.audioChannelsNumber;
-    uint32_t frameSize = 1024;
-    size_t stepSize = frameSize * m_format.audioChannelsNumber;
+    size_t audioChannelsNumber = m_format.audioChannelsNumber;
 
-    std::vector<FLAC__int32> buff(samplesPerChannel * sizeof(float));
+    m_convBuffer.resize(FRAME_SIZE * audioChannelsNumber);
 
-    for (size_t i = 0; i < buff.size(); ++i) {
-        buff[i] = static_cast<FLAC__int32>(dsp::convertFloatSamples<FLAC__int16>(input[i]));
-    }
+    for (samples_t pos = 0; pos < samplesPerChannel; pos += FRAME_SIZE) {
+        uint32_t frames = std::min<uint32_t>(FRAME_SIZE, samplesPerChannel - pos);
+        size_t sampleCount = frames * audioChannelsNumber;
+        const float* in = input + pos * audioChannelsNumber;
 
-    std::vector<FLAC__int32> intermBuff(stepSize);
-
-    for (size_t i = 0; i < totalSamplesNumber; i += stepSize) {
-        std::copy(buff.data() + i, buff.data() + i + stepSize, intermBuff.data());
+        for (size_t i = 0; i < sampleCount; ++i) {
+            m_convBuffer[i] = static_cast<FLAC__int32>(dsp::convertFloatSamples<FLAC__int16>(in[i]));
+        }
 
-        if (m_flac->process_interleaved(intermBuff.data(), frameSize)) {
-            result += stepSize;
-        } else {
+        if (!m_flac->process_interleaved(m_convBuffer.data(), frames)) {
             break;
         }
+
+        result += sampleCount;
     }
 
     return result;
@@ -135,6 +137,13 @@ size_t FlacEncoder::flush()
     return 0;
 }
 
+bool FlacEncoder::supportsChunkedEncoding() const
+{
+    //! NOTE the libFLAC stream encoder keeps its own state between the calls,
+    //! so feeding the stream chunk by chunk is equivalent to a single call
+    return true;
+}
+
 size_t FlacEncoder::requiredOutputBufferSize(samples_t totalSamplesNumber) const
 {
     return totalSamplesNumber;
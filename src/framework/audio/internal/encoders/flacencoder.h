@@ -36,6 +36,8 @@ public:
     size_t encode(samples_t samplesPerChannel, const float* input) override;
     size_t flush() override;
 
+    bool supportsChunkedEncoding() const override;
+
 protected:
     size_t requiredOutputBufferSize(samples_t totalSamplesNumber) const override;
     bool openDestination(const io::path_t& path) override;
@@ -43,6 +45,7 @@ protected:
 
 private:
     FlacHandler* m_flac = nullptr;
+    std::vector<int32_t> m_convBuffer;
 };
 }
 
@@ -101,6 +101,13 @@ size_t Mp3Encoder::encode(samples_t samplesPerChannel, const float* input)
     return result;
 }
 
+bool Mp3Encoder::supportsChunkedEncoding() const
+{
+    //! NOTE lame keeps its own encoding state between the calls,
+    //! so feeding the stream chunk by chunk is equivalent to a single call
+    return true;
+}
+
 size_t Mp3Encoder::flush()
 {
     int encodedBytes = lame_encode_flush(m_handler->flags,
@@ -44,6 +44,7 @@ struct ALSAData
     float* buffer = nullptr;
     snd_pcm_t* alsaDeviceHandle = nullptr;
     unsigned long samples = 0;
+    unsigned long requestedSamples = 0; // pending buffer size change, applied by the render thread
     int channels = 0;
     bool audioProcessingDone = false;
     pthread_t threadHandle = 0;
@@ -54,6 +55,39 @@ struct ALSAData
 static ALSAData* s_alsaData{ nullptr };
 IAudioDriver::Spec s_format;
 
+static bool alsaReconfigureBufferSize(ALSAData* data, unsigned long samples)
+{
+    snd_pcm_t* handle = data->alsaDeviceHandle;
+    snd_pcm_drop(handle);
+
+    snd_pcm_hw_params_t* params;
+    snd_pcm_hw_params_alloca(&params);
+    snd_pcm_hw_params_any(handle, params);
+
+    snd_pcm_hw_params_set_access(handle, params, SND_PCM_ACCESS_RW_INTERLEAVED);
+    snd_pcm_hw_params_set_format(handle, params, SND_PCM_FORMAT_FLOAT_LE);
+    snd_pcm_hw_params_set_channels(handle, params, data->channels);
+
+    unsigned int val = s_format.sampleRate;
+    int dir = 0;
+    if (snd_pcm_hw_params_set_rate_near(handle, params, &val, &dir) < 0) {
+        return false;
+    }
+
+    snd_pcm_hw_params_set_buffer_size_near(handle, params, &samples);
+
+    if (snd_pcm_hw_params(handle, params) < 0) {
+        return false;
+    }
+
+    delete[] data->buffer;
+    data->samples = samples;
+    data->buffer = new float[data->samples * data->channels];
+
+    snd_pcm_prepare(handle);
+    return true;
+}
+
 static void* alsaThread(void* aParam)
 {
     mu::runtime::setThreadName("audio_driver");
@@ -66,6 +100,12 @@ static void* alsaThread(void* aParam)
 
     while (!data->audioProcessingDone)
     {
+        unsigned long requested = data->requestedSamples;
+        if (requested != 0 && requested != data->samples) {
+            alsaReconfigureBufferSize(data, requested);
+            data->requestedSamples = 0;
+        }
+
         uint8_t* stream = (uint8_t*)data->buffer;
         int len = data->samples * data->channels * sizeof(float);
 
@@ -265,20 +305,17 @@ bool LinuxAudioDriver::setOutputDeviceBufferSize(unsigned int bufferSize)
         return true;
     }
 
-    bool reopen = isOpened();
-    close();
     s_format.samples = bufferSize;
 
-    bool ok = true;
-    if (reopen) {
-        ok = open(s_format, &s_format);
-    }
-
-    if (ok) {
-        m_bufferSizeChanged.notify();
+    if (isOpened()) {
+        //! NOTE The running stream is reconfigured in place by the render
+        //! thread (see alsaThread); closing and reopening the device would
+        //! block in snd_pcm_drain and rebuild the thread for no benefit
+        s_alsaData->requestedSamples = bufferSize;
     }
 
-    return ok;
+    m_bufferSizeChanged.notify();
+    return true;
 }
 
 mu::async::Notification LinuxAudioDriver::outputDeviceBufferSizeChanged() const
@@ -21,7 +21,12 @@
  */
 #include "soundfontrepository.h"
 
+#include <cstdio>
+#include <thread>
+#include <vector>
+
 #include "translation.h"
+#include "runtime.h"
 
 #include "log.h"
 
@@ -33,8 +38,11 @@ using namespace mu::async;
 void SoundFontRepository::init()
 {
     loadSoundFontPaths();
+    warmUpSoundFonts();
+
     configuration()->soundFontDirectoriesChanged().onReceive(this, [this](const io::paths_t&) {
         loadSoundFontPaths();
+        warmUpSoundFonts();
     });
 }
 
@@ -58,6 +66,31 @@ void SoundFontRepository::loadSoundFontPaths()
     }
 }
 
+void SoundFontRepository::warmUpSoundFonts() const
+{
+    //! NOTE the synth loads samples lazily, so the first playback used to stall
+    //! while the sound-font files were paged in from disk. Reading them once
+    //! in the background pulls them into the OS file cache ahead of time
+    std::thread([paths = m_soundFontPaths]() {
+        mu::runtime::setThreadName("soundfont_warmup");
+
+        static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+        std::vector<char> chunk(CHUNK_SIZE);
+
+        for (const SoundFontPath& path : paths) {
+            std::FILE* file = std::fopen(path.c_str(), "rb");
+            if (!file) {
+                continue;
+            }
+
+            while (std::fread(chunk.data(), 1, chunk.size(), file) == chunk.size()) {
+            }
+
+            std::fclose(file);
+        }
+    }).detach();
+}
+
 SoundFontPaths SoundFontRepository::soundFontPaths() const
 {
     return m_soundFontPaths;
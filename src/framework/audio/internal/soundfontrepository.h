@@ -47,6 +47,7 @@ public:
 
 private:
     void loadSoundFontPaths();
+    void warmUpSoundFonts() const;
 
     mu::RetVal<synth::SoundFontPath> resolveInstallationPath(const synth::SoundFontPath& path) const;
 
@@ -22,6 +22,10 @@
 
 #include "soundtrackwriter.h"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 #include "internal/worker/audioengine.h"
 #include "internal/encoders/mp3encoder.h"
 #include "internal/encoders/oggencoder.h"
@@ -40,6 +44,10 @@ static constexpr int WRITE_STEPS = 2;
 static constexpr int PREPARE_STEP = 0;
 static constexpr int ENCODE_STEP = 1;
 
+//! NOTE number of render-step slots shared between the rendering loop and
+//! the encoding thread in the overlapped mode
+static constexpr size_t RING_SLOTS = 16;
+
 SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration,
                                    IAudioSourcePtr source)
     : m_source(std::move(source))
@@ -49,7 +57,7 @@ SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTra
     }
 
     samples_t totalSamplesNumber = (totalDuration / 1000000.f) * sizeof(float) * format.sampleRate;
-    m_inputBuffer.resize(totalSamplesNumber);
+    m_totalSamplesNumber = totalSamplesNumber;
     m_intermBuffer.resize(config()->renderStep() * config()->audioChannelsCount());
 
     m_encoderPtr = createEncoder(format.type);
@@ -59,9 +67,18 @@ SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTra
     }
 
     m_encoderPtr->init(destination, format, totalSamplesNumber);
-    m_encoderPtr->progress().progressChanged.onReceive(this, [this](int64_t current, int64_t total, std::string) {
-        sendStepProgress(ENCODE_STEP, current, total);
-    });
+
+    //! NOTE in the overlapped mode the encoder runs on a separate thread and reports
+    //! per-chunk progress, so the writer reports the encoding step by itself instead;
+    //! only the single-shot path needs the whole rendered PCM at once, the overlapped
+    //! one streams through a bounded ring of render steps
+    if (!m_encoderPtr->supportsChunkedEncoding()) {
+        m_inputBuffer.resize(totalSamplesNumber);
+
+        m_encoderPtr->progress().progressChanged.onReceive(this, [this](int64_t current, int64_t total, std::string) {
+            sendStepProgress(ENCODE_STEP, current, total);
+        });
+    }
 }
 
 Ret SoundTrackWriter::write()
@@ -88,6 +105,10 @@ Ret SoundTrackWriter::write()
         m_isAborted = false;
     };
 
+    if (m_encoderPtr->supportsChunkedEncoding()) {
+        return writeOverlapped();
+    }
+
     Ret ret = prepareInputBuffer();
     if (!ret) {
         return ret;
@@ -106,6 +127,127 @@ Ret SoundTrackWriter::write()
     return make_ok();
 }
 
+Ret SoundTrackWriter::writeOverlapped()
+{
+    size_t renderedSamples = 0;
+    size_t totalSamples = m_totalSamplesNumber;
+
+    size_t audioChannelsCount = m_encoderPtr->format().audioChannelsNumber;
+
+    sendStepProgress(PREPARE_STEP, renderedSamples, totalSamples);
+
+    //! NOTE instead of retaining the whole rendered PCM, the two threads share a
+    //! bounded ring of render-step slots: the rendering loop stalls while the ring
+    //! is full and the encoding thread consumes the slots behind it, so the memory
+    //! footprint of an export no longer grows with the score length
+    struct Slot {
+        std::vector<float> data;
+        size_t sampleCount = 0;
+    };
+
+    std::vector<Slot> ring(RING_SLOTS);
+    for (Slot& slot : ring) {
+        slot.data.resize(m_intermBuffer.size());
+    }
+
+    std::mutex mutex;
+    std::condition_variable ringCondition;
+
+    size_t producedSlots = 0;
+    size_t consumedSlots = 0;
+    bool renderingFinished = false;
+
+    size_t encodedBytes = 0;
+
+    std::thread encodeThread([&]() {
+        while (!m_isAborted) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ringCondition.wait(lock, [&]() {
+                    return m_isAborted || renderingFinished || producedSlots > consumedSlots;
+                });
+
+                if (producedSlots <= consumedSlots) {
+                    if (renderingFinished) {
+                        break;
+                    }
+                    continue;
+                }
+            }
+
+            const Slot& slot = ring[consumedSlots % RING_SLOTS];
+            encodedBytes += m_encoderPtr->encode(static_cast<samples_t>(slot.sampleCount / audioChannelsCount),
+                                                 slot.data.data());
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++consumedSlots;
+            }
+            ringCondition.notify_one();
+        }
+    });
+
+    samples_t renderStep = config()->renderStep();
+
+    while (renderedSamples < totalSamples && !m_isAborted) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ringCondition.wait(lock, [&]() {
+                return m_isAborted || producedSlots - consumedSlots < RING_SLOTS;
+            });
+        }
+
+        if (m_isAborted) {
+            break;
+        }
+
+        m_source->process(m_intermBuffer.data(), renderStep);
+
+        size_t samplesToCopy = std::min(m_intermBuffer.size(), totalSamples - renderedSamples);
+
+        Slot& slot = ring[producedSlots % RING_SLOTS];
+        std::copy(m_intermBuffer.begin(),
+                  m_intermBuffer.begin() + samplesToCopy,
+                  slot.data.begin());
+        slot.sampleCount = samplesToCopy;
+
+        renderedSamples += samplesToCopy;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++producedSlots;
+        }
+        ringCondition.notify_one();
+
+        sendStepProgress(PREPARE_STEP, renderedSamples, totalSamples);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        renderingFinished = true;
+    }
+    ringCondition.notify_one();
+
+    encodeThread.join();
+
+    if (m_isAborted) {
+        return make_ret(Ret::Code::Cancel);
+    }
+
+    if (renderedSamples == 0) {
+        LOGI() << "No audio to export";
+        return make_ret(Err::NoAudioToExport);
+    }
+
+    if (encodedBytes == 0) {
+        return make_ret(Err::ErrorEncode);
+    }
+
+    sendStepProgress(ENCODE_STEP, 100, 100);
+
+    return make_ok();
+}
+
 void SoundTrackWriter::abort()
 {
     m_isAborted = true;
@@ -49,11 +49,14 @@ public:
 private:
     encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType& type) const;
     Ret prepareInputBuffer();
+    Ret writeOverlapped();
 
     void sendStepProgress(int step, int64_t current, int64_t total);
 
     IAudioSourcePtr m_source = nullptr;
 
+    size_t m_totalSamplesNumber = 0;
+
     std::vector<float> m_inputBuffer;
     std::vector<float> m_intermBuffer;
 
@@ -42,6 +42,54 @@ int FluidSequencer::currentExpressionLevel() const
     return expressionLevel(dynamicLevel(m_playbackPosition));
 }
 
+FluidSequencer::EventSequenceMap FluidSequencer::eventsToBePlayedTimed(const msecs_t nextMsecs)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    EventSequenceMap result;
+
+    if (!m_isActive) {
+        EventSequence sequence;
+        handleOffStream(sequence, nextMsecs);
+
+        if (!sequence.empty()) {
+            result.emplace(0, std::move(sequence));
+        }
+
+        return result;
+    }
+
+    if (m_currentMainSequenceIt == m_mainStreamEvents.cend()) {
+        return result;
+    }
+
+    msecs_t from = m_playbackPosition;
+    m_playbackPosition += nextMsecs;
+
+    //! NOTE unlike eventsToBePlayed(), every group that falls due within the
+    //! coming slice is returned, keyed by its offset into the slice, so the
+    //! caller can apply each one at its exact sample position
+    while (m_currentMainSequenceIt != m_mainStreamEvents.cend()
+           && m_currentMainSequenceIt->first <= m_playbackPosition) {
+        msecs_t offset = m_currentMainSequenceIt->first > from ? m_currentMainSequenceIt->first - from : 0;
+        result[offset].insert(m_currentMainSequenceIt->second.cbegin(),
+                              m_currentMainSequenceIt->second.cend());
+
+        m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
+    }
+
+    while (m_currentDynamicsIt != m_dynamicEvents.cend()
+           && m_currentDynamicsIt->first <= m_playbackPosition) {
+        msecs_t offset = m_currentDynamicsIt->first > from ? m_currentDynamicsIt->first - from : 0;
+        result[offset].insert(m_currentDynamicsIt->second.cbegin(),
+                              m_currentDynamicsIt->second.cend());
+
+        m_currentDynamicsIt = std::next(m_currentDynamicsIt);
+    }
+
+    return result;
+}
+
 void FluidSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
     m_offStreamEvents.clear();
@@ -52,6 +100,15 @@ void FluidSequencer::updateOffStreamEvents(const mpe::PlaybackEventsMap& changes
 
 void FluidSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& changes)
 {
+    //! NOTE an edit resends the whole event map, but usually only a small range
+    //! of it differs from the previous one; patching just the affected window of
+    //! the rendered midi events keeps the update latency of a live edit
+    //! independent of the score length. Bulk changes fall back to a full rebuild
+    if (tryPatchMainStreamEvents(changes)) {
+        updateMainSequenceIterator();
+        return;
+    }
+
     m_mainStreamEvents.clear();
     m_mainStreamFlushed.notify();
     updatePlaybackEvents(m_mainStreamEvents, changes);
@@ -83,42 +140,147 @@ const ChannelMap& FluidSequencer::channels() const
     return m_channels;
 }
 
+//! NOTE an update affecting more source groups than this is handled by the
+//! full rebuild instead of the patch path
+static constexpr size_t MAIN_STREAM_PATCH_MAX_GROUPS = 128;
+
+bool FluidSequencer::tryPatchMainStreamEvents(const mpe::PlaybackEventsMap& newMap)
+{
+    const mpe::PlaybackEventsMap& oldMap = m_playbackEventsMap;
+
+    if (oldMap.empty() || newMap.empty() || m_mainStreamEvents.empty()) {
+        return false;
+    }
+
+    timestamp_t windowFrom = 0;
+    timestamp_t windowTo = 0;
+    size_t changedGroups = 0;
+
+    auto trackGroup = [this, &windowFrom, &windowTo, &changedGroups](const timestamp_t timestamp,
+                                                                     const mpe::PlaybackEventList& events) {
+        windowFrom = changedGroups == 0 ? timestamp : std::min(windowFrom, timestamp);
+        windowTo = std::max(windowTo, groupSpanEnd(timestamp, events));
+        ++changedGroups;
+    };
+
+    auto oldIt = oldMap.cbegin();
+    auto newIt = newMap.cbegin();
+
+    while (oldIt != oldMap.cend() || newIt != newMap.cend()) {
+        if (changedGroups > MAIN_STREAM_PATCH_MAX_GROUPS) {
+            return false;
+        }
+
+        if (newIt == newMap.cend() || (oldIt != oldMap.cend() && oldIt->first < newIt->first)) {
+            trackGroup(oldIt->first, oldIt->second);
+            ++oldIt;
+            continue;
+        }
+
+        if (oldIt == oldMap.cend() || newIt->first < oldIt->first) {
+            trackGroup(newIt->first, newIt->second);
+            ++newIt;
+            continue;
+        }
+
+        if (oldIt->second != newIt->second) {
+            trackGroup(oldIt->first, oldIt->second);
+            trackGroup(newIt->first, newIt->second);
+        }
+
+        ++oldIt;
+        ++newIt;
+    }
+
+    if (changedGroups == 0) {
+        return true;
+    }
+
+    //! NOTE drop every generated event in the affected window, including those
+    //! of unchanged groups reaching into it
+    m_mainStreamEvents.erase(m_mainStreamEvents.lower_bound(windowFrom),
+                             m_mainStreamEvents.upper_bound(windowTo));
+
+    //! NOTE re-render every group whose events may fall into the window;
+    //! re-inserting an event that survived outside the window is a no-op,
+    //! since the sequences are sets
+    timestamp_t renderFrom = windowFrom <= m_maxEventSpan ? 0 : windowFrom - m_maxEventSpan;
+
+    for (auto it = newMap.lower_bound(renderFrom); it != newMap.cend() && it->first <= windowTo; ++it) {
+        renderPlaybackEvents(m_mainStreamEvents, it->second);
+        m_maxEventSpan = std::max(m_maxEventSpan, groupSpanEnd(it->first, it->second) - it->first);
+    }
+
+    return true;
+}
+
+mpe::timestamp_t FluidSequencer::groupSpanEnd(const timestamp_t timestamp, const mpe::PlaybackEventList& events) const
+{
+    timestamp_t result = timestamp;
+
+    for (const mpe::PlaybackEvent& event : events) {
+        if (!std::holds_alternative<mpe::NoteEvent>(event)) {
+            continue;
+        }
+
+        const mpe::NoteEvent& noteEvent = std::get<mpe::NoteEvent>(event);
+        const mpe::ArrangementContext& arrangementCtx = noteEvent.arrangementCtx();
+
+        result = std::max(result, arrangementCtx.actualTimestamp + arrangementCtx.actualDuration);
+
+        //! NOTE pedal (and similar) control switches end at the articulation
+        //! span's end, which may reach far beyond the note itself
+        for (const auto& pair : noteEvent.expressionCtx().articulations) {
+            const mpe::ArticulationMeta& meta = pair.second.meta;
+            result = std::max(result, meta.timestamp + meta.overallDuration);
+        }
+    }
+
+    return result;
+}
+
 void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
 {
     for (const auto& pair : changes) {
-        for (const mpe::PlaybackEvent& event : pair.second) {
-            if (!std::holds_alternative<mpe::NoteEvent>(event)) {
-                continue;
-            }
+        renderPlaybackEvents(destination, pair.second);
+        m_maxEventSpan = std::max(m_maxEventSpan, groupSpanEnd(pair.first, pair.second) - pair.first);
+    }
+}
 
-            const mpe::NoteEvent& noteEvent = std::get<mpe::NoteEvent>(event);
+void FluidSequencer::renderPlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventList& events)
+{
+    for (const mpe::PlaybackEvent& event : events) {
+        if (!std::holds_alternative<mpe::NoteEvent>(event)) {
+            continue;
+        }
 
-            timestamp_t timestampFrom = noteEvent.arrangementCtx().actualTimestamp;
-            timestamp_t timestampTo = timestampFrom + noteEvent.arrangementCtx().actualDuration;
+        const mpe::NoteEvent& noteEvent = std::get<mpe::NoteEvent>(event);
 
-            channel_t channelIdx = channel(noteEvent);
-            note_idx_t noteIdx = noteIndex(noteEvent.pitchCtx().nominalPitchLevel);
-            velocity_t velocity = noteVelocity(noteEvent);
-            tuning_t tuning = noteTuning(noteEvent, noteIdx);
+        timestamp_t timestampFrom = noteEvent.arrangementCtx().actualTimestamp;
+        timestamp_t timestampTo = timestampFrom + noteEvent.arrangementCtx().actualDuration;
 
-            midi::Event noteOn(Event::Opcode::NoteOn, Event::MessageType::ChannelVoice20);
-            noteOn.setChannel(channelIdx);
-            noteOn.setNote(noteIdx);
-            noteOn.setVelocity(velocity);
-            noteOn.setPitchNote(noteIdx, tuning);
+        channel_t channelIdx = channel(noteEvent);
+        note_idx_t noteIdx = noteIndex(noteEvent.pitchCtx().nominalPitchLevel);
+        velocity_t velocity = noteVelocity(noteEvent);
+        tuning_t tuning = noteTuning(noteEvent, noteIdx);
 
-            destination[timestampFrom].emplace(std::move(noteOn));
+        midi::Event noteOn(Event::Opcode::NoteOn, Event::MessageType::ChannelVoice20);
+        noteOn.setChannel(channelIdx);
+        noteOn.setNote(noteIdx);
+        noteOn.setVelocity(velocity);
+        noteOn.setPitchNote(noteIdx, tuning);
 
-            midi::Event noteOff(Event::Opcode::NoteOff, Event::MessageType::ChannelVoice20);
-            noteOff.setChannel(channelIdx);
-            noteOff.setNote(noteIdx);
-            noteOff.setPitchNote(noteIdx, tuning);
+        destination[timestampFrom].emplace(std::move(noteOn));
 
-            destination[timestampTo].emplace(std::move(noteOff));
+        midi::Event noteOff(Event::Opcode::NoteOff, Event::MessageType::ChannelVoice20);
+        noteOff.setChannel(channelIdx);
+        noteOff.setNote(noteIdx);
+        noteOff.setPitchNote(noteIdx, tuning);
 
-            appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, 64);
-            appendPitchBend(destination, noteEvent, BEND_SUPPORTED_TYPES, channelIdx);
-        }
+        destination[timestampTo].emplace(std::move(noteOff));
+
+        appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, 64);
+        appendPitchBend(destination, noteEvent, BEND_SUPPORTED_TYPES, channelIdx);
     }
 }
 
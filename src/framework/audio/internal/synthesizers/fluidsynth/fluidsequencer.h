@@ -38,6 +38,8 @@ public:
 
     int currentExpressionLevel() const;
 
+    EventSequenceMap eventsToBePlayedTimed(const msecs_t nextMsecs);
+
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& changes) override;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) override;
     void updateDynamicChanges(const mpe::DynamicLevelMap& changes) override;
@@ -48,6 +50,10 @@ public:
 
 private:
     void updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes);
+    void renderPlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventList& events);
+
+    bool tryPatchMainStreamEvents(const mpe::PlaybackEventsMap& newMap);
+    mpe::timestamp_t groupSpanEnd(const mpe::timestamp_t timestamp, const mpe::PlaybackEventList& events) const;
 
     void appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationTypeSet& appliableTypes,
                              const int midiControlIdx);
@@ -63,6 +69,11 @@ private:
     int pitchBendLevel(const mpe::pitch_level_t pitchLevel) const;
 
     mutable ChannelMap m_channels;
+
+    //! NOTE the longest reach of a single source group's generated events past its
+    //! own timestamp (note durations, pedal spans); bounds how far back the patch
+    //! path must re-render around a changed window. Never shrinks
+    mpe::duration_t m_maxEventSpan = 0;
 };
 }
 
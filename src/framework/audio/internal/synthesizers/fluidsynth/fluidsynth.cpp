@@ -45,6 +45,10 @@ static constexpr double FLUID_GLOBAL_VOLUME_GAIN = 4.8;
 static constexpr int DEFAULT_MIDI_VOLUME = 100;
 static constexpr msecs_t MIN_NOTE_LENGTH = 10;
 
+//! NOTE length of the fade tail rendered at a seek during active playback,
+//! in samples (~11 ms at 44.1 kHz)
+static constexpr samples_t FADE_TAIL_SAMPLES = 512;
+
 /// @note
 ///  Fluid does not support MONO, so they start counting audio channels from 1, which means "1 pair of audio channels"
 /// @see https://www.fluidsynth.org/api/settings_synth.html
@@ -190,8 +194,6 @@ bool FluidSynth::handleEvent(const midi::Event& event)
     }
     }
 
-    midiOutPort()->sendEvent(event);
-
     return ret == FLUID_OK;
 }
 
@@ -301,6 +303,21 @@ void FluidSynth::flushSound()
 
     fluid_synth_all_sounds_off(m_fluid->synth, -1);
     fluid_synth_cc(m_fluid->synth, -1, 121, 127);
+
+    m_fadeTailSamples = 0;
+    m_fadeTailOffset = 0;
+}
+
+void FluidSynth::updateRenderingMode(const RenderMode /*mode*/)
+{
+    if (!m_fluid->synth) {
+        return;
+    }
+
+    //! NOTE both directions of the transition matter: entering the offline mode an export
+    //! must start from silence, and coming back the realtime stream must not pick up
+    //! voices still ringing from the render loop
+    flushSound();
 }
 
 bool FluidSynth::isActive() const
@@ -321,6 +338,13 @@ msecs_t FluidSynth::playbackPosition() const
 
 void FluidSynth::setPlaybackPosition(const msecs_t newPosition)
 {
+    //! NOTE a seek during active playback (a loop wrap or a user reposition)
+    //! stashes the ending of the ringing voices, so that process() can fade
+    //! them out over the audio of the new position instead of cutting them
+    if (isActive() && m_sequencer.playbackPosition() != newPosition) {
+        renderFadeTail();
+    }
+
     m_sequencer.setPlaybackPosition(newPosition);
 
     if (isActive()) {
@@ -333,6 +357,32 @@ unsigned int FluidSynth::audioChannelsCount() const
     return FLUID_AUDIO_CHANNELS_PAIR * 2;
 }
 
+void FluidSynth::renderFadeTail()
+{
+    IF_ASSERT_FAILED(m_fluid->synth) {
+        return;
+    }
+
+    unsigned int channelCount = audioChannelsCount();
+    m_fadeTail.resize(FADE_TAIL_SAMPLES * channelCount);
+
+    int result = fluid_synth_write_float(m_fluid->synth, FADE_TAIL_SAMPLES,
+                                         m_fadeTail.data(), 0, channelCount,
+                                         m_fadeTail.data(), 1, channelCount);
+
+    if (result != FLUID_OK) {
+        m_fadeTailSamples = 0;
+        return;
+    }
+
+    m_fadeTailSamples = FADE_TAIL_SAMPLES;
+    m_fadeTailOffset = 0;
+
+    //! NOTE the ending of the revoked voices now lives in the tail, so they
+    //! can be cut outright instead of ringing into the new position
+    fluid_synth_all_sounds_off(m_fluid->synth, -1);
+}
+
 samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
 {
     IF_ASSERT_FAILED(samplesPerChannel > 0) {
@@ -341,26 +391,72 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
 
     msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
 
-    const FluidSequencer::EventSequence& sequence = m_sequencer.eventsToBePlayed(nextMsecs);
+    //! NOTE each group of events is applied at its own sample offset within the
+    //! buffer, so onsets (metronome clicks in particular) land sample-accurately
+    //! instead of being quantized to the buffer size
+    const FluidSequencer::EventSequenceMap sequences = m_sequencer.eventsToBePlayedTimed(nextMsecs);
+
+    unsigned int channelCount = audioChannelsCount();
+
+    samples_t renderedSamples = 0;
+
+    auto renderChunk = [this, buffer, channelCount, &renderedSamples](const samples_t upTo) {
+        if (upTo <= renderedSamples) {
+            return true;
+        }
+
+        int result = fluid_synth_write_float(m_fluid->synth, upTo - renderedSamples,
+                                             buffer + renderedSamples * channelCount, 0, channelCount,
+                                             buffer + renderedSamples * channelCount, 1, channelCount);
+
+        renderedSamples = upTo;
+
+        return result == FLUID_OK;
+    };
+
+    //! NOTE the midi out port receives the whole slice as one batch, so the
+    //! OS gets a single submission instead of one write per event
+    std::vector<midi::Event> midiOutEvents;
+
+    for (const auto& pair : sequences) {
+        samples_t eventSample = std::min(samplesPerChannel, microSecsToSamples(pair.first, m_sampleRate));
+
+        if (!renderChunk(eventSample)) {
+            return 0;
+        }
 
-    if (!sequence.empty()) {
         m_tuning.reset();
+        midiOutEvents.reserve(midiOutEvents.size() + pair.second.size());
+
+        for (const FluidSequencer::EventType& event : pair.second) {
+            const midi::Event& midiEvent = std::get<midi::Event>(event);
+            handleEvent(midiEvent);
+            midiOutEvents.push_back(midiEvent);
+        }
+
+        fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    }
+
+    if (!renderChunk(samplesPerChannel)) {
+        return 0;
     }
 
-    for (const FluidSequencer::EventType& event : sequence) {
-        handleEvent(std::get<midi::Event>(event));
+    if (!midiOutEvents.empty()) {
+        midiOutPort()->sendEvents(midiOutEvents);
     }
 
-    fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    if (m_fadeTailOffset < m_fadeTailSamples) {
+        samples_t count = std::min(samplesPerChannel, m_fadeTailSamples - m_fadeTailOffset);
 
-    unsigned int channelCount = audioChannelsCount();
+        for (samples_t i = 0; i < count; ++i) {
+            float gain = 1.f - static_cast<float>(m_fadeTailOffset + i) / m_fadeTailSamples;
 
-    int result = fluid_synth_write_float(m_fluid->synth, samplesPerChannel,
-                                         buffer, 0, channelCount,
-                                         buffer, 1, channelCount);
+            for (unsigned int ch = 0; ch < channelCount; ++ch) {
+                buffer[i * channelCount + ch] += m_fadeTail[(m_fadeTailOffset + i) * channelCount + ch] * gain;
+            }
+        }
 
-    if (result != FLUID_OK) {
-        return 0;
+        m_fadeTailOffset += count;
     }
 
     return samplesPerChannel;
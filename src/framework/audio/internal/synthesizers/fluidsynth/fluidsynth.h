@@ -69,6 +69,9 @@ public:
 
     bool isValid() const override;
 
+protected:
+    void updateRenderingMode(const RenderMode mode) override;
+
 private:
     struct KeyTuning {
         std::vector<int> keys;
@@ -100,6 +103,8 @@ private:
     Ret init();
     void createFluidInstance();
 
+    void renderFadeTail();
+
     bool handleEvent(const midi::Event& event);
 
     void toggleExpressionController();
@@ -115,6 +120,13 @@ private:
     std::set<io::path_t> m_sfontPaths;
 
     KeyTuning m_tuning;
+
+    //! NOTE a few milliseconds of the still-ringing voices, rendered when a seek
+    //! interrupts active playback (e.g. a loop wrap) and faded out over the first
+    //! samples written at the new position, so the jump is click-free
+    std::vector<float> m_fadeTail;
+    samples_t m_fadeTailSamples = 0;
+    samples_t m_fadeTailOffset = 0;
 };
 
 using FluidSynthPtr = std::shared_ptr<FluidSynth>;
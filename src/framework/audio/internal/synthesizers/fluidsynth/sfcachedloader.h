@@ -28,20 +28,35 @@ extern "C" {
 #endif
 
 #include <cstdio>
+#include <cstring>
 #include <vector>
 #include <map>
 #include <string>
 
+#include <QFile>
+
 #include <sfloader/fluid_sfont.h>
 #include <sfloader/fluid_defsfont.h>
 
 #include "log.h"
 
 namespace mu::audio::synth {
+//!Note Sound-font files are opened as read-only memory mappings, so when
+//!     several MuseScore instances load the same sound-font the OS shares
+//!     the file-backed pages between them instead of every instance paying
+//!     the read from disk again.
+struct SoundFontFile
+{
+    QFile* file = nullptr;
+    const uchar* data = nullptr;
+    qint64 size = 0;
+    qint64 pos = 0;
+};
+
 struct SoundFontData
 {
     fluid_sfont_t* soundFontPtr = nullptr;
-    std::FILE* fileStream = nullptr;
+    SoundFontFile* file = nullptr;
 };
 
 struct SoundFontCache : public std::map<std::string, SoundFontData> {
@@ -64,8 +79,14 @@ private:
 
             delete_fluid_sfont(pair.second.soundFontPtr);
 
-            if (pair.second.fileStream) {
-                std::fclose(pair.second.fileStream);
+            if (pair.second.file) {
+                SoundFontFile* file = pair.second.file;
+                if (file->data) {
+                    file->file->unmap(const_cast<uchar*>(file->data));
+                }
+                file->file->close();
+                delete file->file;
+                delete file;
             }
         }
     }
@@ -76,28 +97,75 @@ void* openSoundFont(const char* filename)
     auto search = SoundFontCache::instance()->find(filename);
 
     if (search != SoundFontCache::instance()->cend()
-        && search->second.fileStream) {
-        return search->second.fileStream;
+        && search->second.file) {
+        search->second.file->pos = 0;
+        return search->second.file;
+    }
+
+    QFile* qfile = new QFile(QString::fromUtf8(filename));
+    if (!qfile->open(QIODevice::ReadOnly)) {
+        delete qfile;
+        return nullptr;
     }
 
-    std::FILE* stream = std::fopen(filename, "r");
+    SoundFontFile* file = new SoundFontFile();
+    file->file = qfile;
+    file->size = qfile->size();
+    //!Note The mapping can fail on exotic filesystems, in that case
+    //!     readSoundFont falls back to ordinary file reads
+    file->data = qfile->map(0, file->size);
 
     SoundFontData sfData;
-    sfData.fileStream = stream;
+    sfData.file = file;
 
     SoundFontCache::instance()->emplace(filename, std::move(sfData));
 
-    return stream;
+    return file;
 }
 
 int readSoundFont(void* buf, int count, void* handle)
 {
-    return static_cast<int>(std::fread(buf, count, 1, static_cast<std::FILE*>(handle)));
+    SoundFontFile* file = static_cast<SoundFontFile*>(handle);
+    if (count < 0 || file->pos + count > file->size) {
+        return FLUID_FAILED;
+    }
+
+    if (file->data) {
+        std::memcpy(buf, file->data + file->pos, count);
+    } else {
+        if (!file->file->seek(file->pos)) {
+            return FLUID_FAILED;
+        }
+        if (file->file->read(static_cast<char*>(buf), count) != count) {
+            return FLUID_FAILED;
+        }
+    }
+
+    file->pos += count;
+    return FLUID_OK;
 }
 
 int seekSoundFont(void* handle, long offset, int origin)
 {
-    return std::fseek(static_cast<std::FILE*>(handle), offset, origin);
+    SoundFontFile* file = static_cast<SoundFontFile*>(handle);
+
+    qint64 pos = 0;
+    switch (origin) {
+    case SEEK_SET: pos = offset;
+        break;
+    case SEEK_CUR: pos = file->pos + offset;
+        break;
+    case SEEK_END: pos = file->size + offset;
+        break;
+    default: return FLUID_FAILED;
+    }
+
+    if (pos < 0 || pos > file->size) {
+        return FLUID_FAILED;
+    }
+
+    file->pos = pos;
+    return FLUID_OK;
 }
 
 int closeSoundFont(void* /*handle*/)
@@ -111,7 +179,7 @@ int closeSoundFont(void* /*handle*/)
 
 long tellSoundFont(void* handle)
 {
-    return std::ftell(static_cast<std::FILE*>(handle));
+    return static_cast<long>(static_cast<SoundFontFile*>(handle)->pos);
 }
 
 int deleteSoundFont(fluid_sfont_t* /*sfont*/)
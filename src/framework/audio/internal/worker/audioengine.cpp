@@ -163,3 +163,9 @@ MixerPtr AudioEngine::mixer() const
     ONLY_AUDIO_WORKER_THREAD;
     return m_mixer;
 }
+
+AudioBufferPtr AudioEngine::buffer() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+    return m_buffer;
+}
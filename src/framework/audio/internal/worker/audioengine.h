@@ -55,6 +55,7 @@ public:
     async::Notification modeChanged() const;
 
     MixerPtr mixer() const;
+    std::shared_ptr<AudioBuffer> buffer() const;
 
 private:
     AudioEngine();
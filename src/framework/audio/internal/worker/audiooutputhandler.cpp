@@ -25,6 +25,7 @@
 #include "async/async.h"
 #include "containers.h"
 
+#include "internal/audiobuffer.h"
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/worker/audioengine.h"
@@ -181,6 +182,25 @@ Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
     }, AudioThread::ID);
 }
 
+Promise<AudioWorkerPerformanceStats> AudioOutputHandler::performanceStats() const
+{
+    return Promise<AudioWorkerPerformanceStats>([this](auto resolve, auto reject) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        IF_ASSERT_FAILED(mixer()) {
+            return reject(static_cast<int>(Err::Undefined), "undefined reference to a mixer");
+        }
+
+        AudioWorkerPerformanceStats stats = mixer()->performanceStats();
+
+        if (AudioBufferPtr buffer = AudioEngine::instance()->buffer()) {
+            stats.underrunCount = buffer->underrunCount();
+        }
+
+        return resolve(stats);
+    }, AudioThread::ID);
+}
+
 Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                  const SoundTrackFormat& format)
 {
@@ -55,8 +55,13 @@ bool AudioStream::loadFile(const io::path_t& path)
 void AudioStream::convertSampleRate(unsigned int sampleRate)
 {
     if (sampleRate != m_sampleRate) {
-        auto src = new SampleRateConvertor(m_data, m_channels, m_sampleRate, sampleRate);
-        m_data = src->convert();
+        SampleRateConvertor src(m_data, m_channels, m_sampleRate, sampleRate);
+
+        //! NOTE the whole stream is converted at once here, so quality matters more than speed;
+        //! the streaming path in copySamplesToBuffer stays on the cheaper windowed FIR
+        src.setMethod(SampleRateConvertor::SINC);
+
+        m_data = src.convert();
         m_sampleRate = sampleRate;
     }
 }
@@ -21,6 +21,7 @@
  */
 #include "equaliser.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "log.h"
@@ -43,18 +44,48 @@ void Equaliser::setActive(bool active)
     m_active = active;
 }
 
+//! NOTE length of the coefficient ramp after a parameter change, in samples
+static constexpr unsigned int COEF_RAMP_SAMPLES = 64;
+
 void Equaliser::process(float* buffer, unsigned int sampleCount)
 {
-    for (unsigned int i = 0; i < sampleCount; ++i) {
-        m_x[2] = m_x[1];
-        m_x[1] = m_x[0];
-        m_x[0] = buffer[i];
+    unsigned int rampSamples = 0;
+    Coefficients step;
+
+    if (m_coefDirty) {
+        rampSamples = std::min(sampleCount, COEF_RAMP_SAMPLES);
+        step.b0 = (m_targetCoef.b0 - m_coef.b0) / rampSamples;
+        step.b1 = (m_targetCoef.b1 - m_coef.b1) / rampSamples;
+        step.b2 = (m_targetCoef.b2 - m_coef.b2) / rampSamples;
+        step.a1 = (m_targetCoef.a1 - m_coef.a1) / rampSamples;
+        step.a2 = (m_targetCoef.a2 - m_coef.a2) / rampSamples;
+    }
 
-        m_y[2] = m_y[1];
-        m_y[1] = m_y[0];
-        m_y[0] = (m_b[2] * m_x[2] + m_b[1] * m_x[1] + m_b[0] * m_x[0] - m_a[1] * m_y[1] - m_a[2] * m_y[2]) / m_a[0];
+    for (unsigned int i = 0; i < rampSamples; ++i) {
+        m_coef.b0 += step.b0;
+        m_coef.b1 += step.b1;
+        m_coef.b2 += step.b2;
+        m_coef.a1 += step.a1;
+        m_coef.a2 += step.a2;
+
+        float x = buffer[i];
+        float y = m_coef.b0 * x + m_s1;
+        m_s1 = m_coef.b1 * x - m_coef.a1 * y + m_s2;
+        m_s2 = m_coef.b2 * x - m_coef.a2 * y;
+        buffer[i] = y;
+    }
 
-        buffer[i] = m_y[0];
+    if (m_coefDirty) {
+        m_coef = m_targetCoef;
+        m_coefDirty = false;
+    }
+
+    for (unsigned int i = rampSamples; i < sampleCount; ++i) {
+        float x = buffer[i];
+        float y = m_coef.b0 * x + m_s1;
+        m_s1 = m_coef.b1 * x - m_coef.a1 * y + m_s2;
+        m_s2 = m_coef.b2 * x - m_coef.a2 * y;
+        buffer[i] = y;
     }
 }
 
@@ -67,13 +98,16 @@ void Equaliser::calculate()
     float w0 = 2 * M_PI * m_frequency / m_sampleRate;
     float alpha = std::sin(w0) * a / (2 * m_q);
 
-    m_b[0] = 1 + alpha * a;
-    m_b[1] = -2 * std::cos(w0);
-    m_b[2] = 1 - alpha * a;
+    float a0 = 1 + alpha / a;
+
+    m_targetCoef.b0 = (1 + alpha * a) / a0;
+    m_targetCoef.b1 = -2 * std::cos(w0) / a0;
+    m_targetCoef.b2 = (1 - alpha * a) / a0;
+
+    m_targetCoef.a1 = -2 * std::cos(w0) / a0;
+    m_targetCoef.a2 = (1 - alpha / a) / a0;
 
-    m_a[0] = 1 + alpha / a;
-    m_a[1] = -2 * std::cos(w0);
-    m_a[2] = 1 - alpha / a;
+    m_coefDirty = true;
 }
 
 void mu::audio::Equaliser::setFrequency(float value)
@@ -48,10 +48,20 @@ private:
     bool m_active = true;
 
     float m_gain = 0, m_frequency = 1000.f, m_q = 1.f;
-    float m_a[3] = { 0, 0, 0 };
-    float m_b[3] = { 0, 0, 0 };
-    float m_x[3] = { 0, 0, 0 };
-    float m_y[3] = { 0, 0, 0 };
+
+    //! NOTE coefficients normalized by a0 (so the hot loop has no division);
+    //! parameter changes write the target set and the next process() call
+    //! ramps the live set towards it to avoid zipper noise and clicks
+    struct Coefficients {
+        float b0 = 1.f, b1 = 0.f, b2 = 0.f;
+        float a1 = 0.f, a2 = 0.f;
+    };
+
+    Coefficients m_coef;
+    Coefficients m_targetCoef;
+    bool m_coefDirty = false;
+
+    float m_s1 = 0.f, m_s2 = 0.f;   // transposed direct form II state
 };
 }
 
@@ -24,6 +24,7 @@
 #include "async/async.h"
 #include "log.h"
 
+#include <chrono>
 #include <limits>
 
 #include "concurrency/taskscheduler.h"
@@ -31,6 +32,7 @@
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/mixkernels.h"
 #include "audioerrors.h"
 
 using namespace mu;
@@ -118,6 +120,10 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    const auto callbackStartTime = std::chrono::steady_clock::now();
+
+    dsp::DenormalsDisabler denormalsDisabler;
+
     for (IClockPtr clock : m_clocks) {
         clock->forward((samplesPerChannel * 1000000) / m_sampleRate);
     }
@@ -132,8 +138,15 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 
     std::vector<std::future<std::vector<float> > > futureList;
 
+    MixerChannelPtr lastChannel = m_mixerChannels.empty() ? nullptr : std::prev(m_mixerChannels.end())->second;
+
     for (const auto& pair : m_mixerChannels) {
         MixerChannelPtr channel = pair.second;
+
+        if (channel == lastChannel) {
+            continue;
+        }
+
         std::future<std::vector<float> > future = TaskScheduler::instance()->submit([this, samplesPerChannel,
                                                                                      channel]() -> std::vector<float> {
             thread_local std::vector<float> buffer(samplesPerChannel * audioChannelsCount(), 0.f);
@@ -151,6 +164,18 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         futureList.emplace_back(std::move(future));
     }
 
+    //! NOTE process one of the channels on the worker thread itself,
+    //! instead of leaving it idle while the task scheduler threads are rendering
+    if (lastChannel) {
+        std::fill(m_writeCacheBuff.begin(), m_writeCacheBuff.end(), 0.f);
+
+        lastChannel->process(m_writeCacheBuff.data(), samplesPerChannel);
+
+        mixOutputFromChannel(outBuffer, m_writeCacheBuff.data(), samplesPerChannel);
+
+        masterChannelSampleCount = samplesPerChannel;
+    }
+
     for (size_t i = 0; i < futureList.size(); ++i) {
         mixOutputFromChannel(outBuffer, futureList[i].get().data(), samplesPerChannel);
 
@@ -161,6 +186,7 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
             notifyAboutAudioSignalChanges(audioChNum, 0);
         }
+        recordCallbackStats(callbackStartTime);
         return 0;
     }
 
@@ -172,9 +198,51 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         }
     }
 
+    recordCallbackStats(callbackStartTime);
     return masterChannelSampleCount;
 }
 
+void Mixer::recordCallbackStats(const std::chrono::steady_clock::time_point& callbackStartTime)
+{
+    const uint64_t nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - callbackStartTime).count();
+
+    m_callbackCount.fetch_add(1, std::memory_order_relaxed);
+    m_totalCallbackNsecs.fetch_add(nsecs, std::memory_order_relaxed);
+
+    uint64_t prevMax = m_maxCallbackNsecs.load(std::memory_order_relaxed);
+    while (prevMax < nsecs && !m_maxCallbackNsecs.compare_exchange_weak(prevMax, nsecs, std::memory_order_relaxed)) {
+    }
+
+    uint64_t usecs = nsecs / 1000;
+    size_t bucket = 0;
+    while (usecs > 1 && bucket < AudioWorkerPerformanceStats::HISTOGRAM_SIZE - 1) {
+        usecs >>= 1;
+        ++bucket;
+    }
+    m_callbackUsecsHistogram.at(bucket).fetch_add(1, std::memory_order_relaxed);
+}
+
+AudioWorkerPerformanceStats Mixer::performanceStats() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    AudioWorkerPerformanceStats stats;
+    stats.callbackCount = m_callbackCount.load(std::memory_order_relaxed);
+    stats.totalCallbackNsecs = m_totalCallbackNsecs.load(std::memory_order_relaxed);
+    stats.maxCallbackNsecs = m_maxCallbackNsecs.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < AudioWorkerPerformanceStats::HISTOGRAM_SIZE; ++i) {
+        stats.callbackUsecsHistogram.at(i) = m_callbackUsecsHistogram.at(i).load(std::memory_order_relaxed);
+    }
+
+    for (const auto& pair : m_mixerChannels) {
+        stats.maxChannelNsecs.emplace(pair.first, pair.second->maxProcessNsecs());
+    }
+
+    return stats;
+}
+
 void Mixer::setIsActive(bool arg)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -276,13 +344,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int
         return;
     }
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        for (samples_t s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
-
-            outBuffer[idx] += inBuffer[idx];
-        }
-    }
+    dsp::mixSamples(outBuffer, inBuffer, static_cast<size_t>(samplesCount) * audioChannelsCount());
 }
 
 void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
@@ -293,24 +355,40 @@ void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
 
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
+    if (audioChannelsCount() == 2) {
+        gain_t volumeGain = dsp::linearFromDecibels(m_masterParams.volume);
+        float channelGains[2] = { dsp::balanceGain(m_masterParams.balance, 0) * volumeGain,
+                                  dsp::balanceGain(m_masterParams.balance, 1) * volumeGain };
+        float channelSquaredSums[2] = { 0.f, 0.f };
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+        dsp::applyGainsStereo(buffer, samplesPerChannel, channelGains, channelSquaredSums);
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        for (audioch_t audioChNum = 0; audioChNum < 2; ++audioChNum) {
+            totalSquaredSum += channelSquaredSums[audioChNum];
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
+            float rms = dsp::samplesRootMeanSquare(channelSquaredSums[audioChNum], samplesPerChannel);
+            notifyAboutAudioSignalChanges(audioChNum, rms);
         }
+    } else {
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            float singleChannelSquaredSum = 0.f;
+
+            gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+            for (samples_t s = 0; s < samplesPerChannel; ++s) {
+                int idx = s * audioChannelsCount() + audioChNum;
+
+                float resultSample = buffer[idx] * totalGain;
+                buffer[idx] = resultSample;
+
+                float squaredSample = resultSample * resultSample;
+                totalSquaredSum += squaredSample;
+                singleChannelSquaredSum += squaredSample;
+            }
+
+            float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
+            notifyAboutAudioSignalChanges(audioChNum, rms);
+        }
     }
 
     if (!m_limiter->isActive()) {
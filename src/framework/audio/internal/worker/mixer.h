@@ -22,6 +22,9 @@
 #ifndef MU_AUDIO_MIXER_H
 #define MU_AUDIO_MIXER_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <map>
 
@@ -59,6 +62,8 @@ public:
 
     async::Channel<audioch_t, AudioSignalVal> masterAudioSignalChanges() const;
 
+    AudioWorkerPerformanceStats performanceStats() const;
+
     // IAudioSource
     void setSampleRate(unsigned int sampleRate) override;
     unsigned int audioChannelsCount() const override;
@@ -66,6 +71,8 @@ public:
     void setIsActive(bool arg) override;
 
 private:
+    void recordCallbackStats(const std::chrono::steady_clock::time_point& callbackStartTime);
+
     void mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount);
     void completeOutput(float* buffer, const samples_t& samplesPerChannel);
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
@@ -83,6 +90,12 @@ private:
     audioch_t m_audioChannelsCount = 0;
 
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+
+    //! NOTE written by the processing callback without locks, read by performanceStats()
+    std::atomic<uint64_t> m_callbackCount = { 0 };
+    std::atomic<uint64_t> m_totalCallbackNsecs = { 0 };
+    std::atomic<uint64_t> m_maxCallbackNsecs = { 0 };
+    std::array<std::atomic<uint64_t>, AudioWorkerPerformanceStats::HISTOGRAM_SIZE> m_callbackUsecsHistogram = {};
 };
 
 using MixerPtr = std::shared_ptr<Mixer>;
@@ -22,16 +22,25 @@
 #include "mixerchannel.h"
 
 #include <algorithm>
+#include <chrono>
 
 #include "log.h"
 
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/mixkernels.h"
 #include "internal/audiosanitizer.h"
 
 using namespace mu;
 using namespace mu::audio;
 using namespace mu::async;
 
+//! NOTE defaults for the idle channel detection: a peak level below the
+//! threshold (-120 dB) counts as silence, and the source has to stay silent
+//! for the hangover period before the channel stops processing, so that
+//! short gaps between notes do not toggle the fx chain on and off
+static constexpr float DEFAULT_SILENCE_THRESHOLD = 0.000001f;
+static constexpr float DEFAULT_SILENCE_HANGOVER_SECS = 0.5f;
+
 MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate)
     : m_trackId(trackId),
     m_sampleRate(sampleRate),
@@ -41,6 +50,15 @@ MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const
     ONLY_AUDIO_WORKER_THREAD;
 
     setSampleRate(sampleRate);
+    setSilenceDetectionConfig(DEFAULT_SILENCE_THRESHOLD, DEFAULT_SILENCE_HANGOVER_SECS);
+}
+
+void MixerChannel::setSilenceDetectionConfig(float threshold, float hangoverSecs)
+{
+    m_silenceThreshold = threshold;
+    m_silenceHangoverSamples = static_cast<samples_t>(hangoverSecs * m_sampleRate);
+    m_silentSamplesCount = 0;
+    m_idle = false;
 }
 
 const AudioOutputParams& MixerChannel::outputParams() const
@@ -167,6 +185,25 @@ async::Channel<unsigned int> MixerChannel::audioChannelsCountChanged() const
 }
 
 samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    samples_t processedSamplesCount = doProcess(buffer, samplesPerChannel);
+
+    const uint64_t nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+    uint64_t prevMax = m_maxProcessNsecs.load(std::memory_order_relaxed);
+    while (prevMax < nsecs && !m_maxProcessNsecs.compare_exchange_weak(prevMax, nsecs, std::memory_order_relaxed)) {
+    }
+
+    return processedSamplesCount;
+}
+
+uint64_t MixerChannel::maxProcessNsecs() const
+{
+    return m_maxProcessNsecs.load(std::memory_order_relaxed);
+}
+
+samples_t MixerChannel::doProcess(float* buffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
@@ -174,10 +211,31 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
+    //! NOTE the channels are processed on the task scheduler threads,
+    //! so the flush-to-zero mode has to be set up on each of them
+    dsp::DenormalsDisabler denormalsDisabler;
+
     samples_t processedSamplesCount = m_audioSource->process(buffer, samplesPerChannel);
 
+    size_t sampleCount = samplesPerChannel * audioChannelsCount();
+
     if (processedSamplesCount == 0 || m_params.muted) {
-        std::fill(buffer, buffer + samplesPerChannel * audioChannelsCount(), 0.f);
+        std::fill(buffer, buffer + sampleCount, 0.f);
+
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            notifyAboutAudioSignalChanges(audioChNum, 0.f);
+        }
+
+        return processedSamplesCount;
+    }
+
+    bool sourceSilent = dsp::samplesPeakLevel(buffer, sampleCount) <= m_silenceThreshold;
+
+    if (!sourceSilent) {
+        m_silentSamplesCount = 0;
+        m_idle = false;
+    } else if (m_idle) {
+        std::fill(buffer, buffer + sampleCount, 0.f);
 
         for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
             notifyAboutAudioSignalChanges(audioChNum, 0.f);
@@ -193,6 +251,20 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         fx->process(buffer, samplesPerChannel);
     }
 
+    if (sourceSilent) {
+        //! NOTE the channel goes idle only once the fx output has also
+        //! decayed below the threshold, so that reverb and delay tails
+        //! are rendered to the end regardless of the hangover length
+        if (dsp::samplesPeakLevel(buffer, sampleCount) <= m_silenceThreshold) {
+            m_silentSamplesCount += samplesPerChannel;
+            if (m_silentSamplesCount >= m_silenceHangoverSamples) {
+                m_idle = true;
+            }
+        } else {
+            m_silentSamplesCount = 0;
+        }
+    }
+
     completeOutput(buffer, samplesPerChannel);
 
     return processedSamplesCount;
@@ -202,25 +274,41 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) cons
 {
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+    if (audioChannelsCount() == 2) {
+        gain_t volumeGain = dsp::linearFromDecibels(m_params.volume);
+        float channelGains[2] = { dsp::balanceGain(m_params.balance, 0) * volumeGain,
+                                  dsp::balanceGain(m_params.balance, 1) * volumeGain };
+        float channelSquaredSums[2] = { 0.f, 0.f };
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+        dsp::applyGainsStereo(buffer, samplesCount, channelGains, channelSquaredSums);
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        for (audioch_t audioChNum = 0; audioChNum < 2; ++audioChNum) {
+            totalSquaredSum += channelSquaredSums[audioChNum];
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
+            float rms = dsp::samplesRootMeanSquare(channelSquaredSums[audioChNum], samplesCount);
+            notifyAboutAudioSignalChanges(audioChNum, rms);
         }
+    } else {
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            float singleChannelSquaredSum = 0.f;
+
+            gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+
+            for (unsigned int s = 0; s < samplesCount; ++s) {
+                int idx = s * audioChannelsCount() + audioChNum;
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+                float resultSample = buffer[idx] * totalGain;
+                buffer[idx] = resultSample;
 
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+                float squaredSample = resultSample * resultSample;
+                singleChannelSquaredSum += squaredSample;
+                totalSquaredSum += squaredSample;
+            }
+
+            float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+
+            notifyAboutAudioSignalChanges(audioChNum, rms);
+        }
     }
 
     if (!m_compressor->isActive()) {
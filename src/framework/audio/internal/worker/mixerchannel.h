@@ -22,6 +22,8 @@
 #ifndef MU_AUDIO_MIXERCHANNEL_H
 #define MU_AUDIO_MIXERCHANNEL_H
 
+#include <atomic>
+
 #include "modularity/ioc.h"
 
 #include "async/asyncable.h"
@@ -53,7 +55,13 @@ public:
     async::Channel<unsigned int> audioChannelsCountChanged() const override;
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
+    uint64_t maxProcessNsecs() const;
+
+    void setSilenceDetectionConfig(float threshold, float hangoverSecs);
+
 private:
+    samples_t doProcess(float* buffer, samples_t samplesPerChannel);
+
     void completeOutput(float* buffer, unsigned int samplesCount) const;
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
 
@@ -65,10 +73,21 @@ private:
     IAudioSourcePtr m_audioSource = nullptr;
     std::vector<IFxProcessorPtr> m_fxProcessors = {};
 
+    //! NOTE a channel whose source and fx output both stayed below the
+    //! silence threshold for the hangover period is considered idle and
+    //! skips its fx chain and output stage until the source sounds again
+    float m_silenceThreshold = 0.f;
+    samples_t m_silenceHangoverSamples = 0;
+    samples_t m_silentSamplesCount = 0;
+    bool m_idle = false;
+
     dsp::CompressorPtr m_compressor = nullptr;
 
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+
+    //! NOTE written by the processing callback without locks, read by the performance stats snapshot
+    std::atomic<uint64_t> m_maxProcessNsecs = { 0 };
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
@@ -35,6 +35,10 @@ using namespace mu::async;
 PlayerHandler::PlayerHandler(IGetTrackSequence* getSequence)
     : m_getSequence(getSequence)
 {
+    //! NOTE only the latest position matters, so while the main thread
+    //! hasn't processed a queued update yet, new ones just replace its
+    //! payload instead of piling up in the queue
+    m_playbackPositionMsecsChanged.setBatchedMode(true);
 }
 
 PlayerHandler::~PlayerHandler()
@@ -99,6 +99,11 @@ void SampleRateConvertor::setSampleRateOut(unsigned int sampleRate)
     }
 }
 
+void SampleRateConvertor::setMethod(Method method)
+{
+    m_method = method;
+}
+
 float SampleRateConvertor::ySinc(unsigned int sample, unsigned int channel) const
 {
     double currentOutputSampleTime = sample / static_cast<double>(m_sampleRateOut);
@@ -44,6 +44,9 @@ public:
     void setSampleRateIn(unsigned int sampleRate);
     void setSampleRateOut(unsigned int sampleRate);
 
+    //! select the quality/speed tradeoff: SINC for offline conversion, FIR for streaming
+    void setMethod(Method method);
+
 private:
 
     //! return value of sinc function (LPF) with consideration of used sampleRates
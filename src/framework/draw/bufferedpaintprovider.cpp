@@ -68,19 +68,19 @@ bool BufferedPaintProvider::isActive() const
 void BufferedPaintProvider::beginObject(const std::string& name)
 {
     // no begin any objects
-    if (m_itemLevel < 0) {
+    if (m_itemStack.empty()) {
         m_buf->item.name = name;
         m_buf->item.datas.emplace_back(); // default state
-        m_itemLevel = 0;
+        m_itemStack.push_back(&m_buf->item);
         return;
     }
 
     // add new object
-    DrawData::Item& parent = editableObject();
+    DrawData::Item& parent = *m_itemStack.back();
     DrawData::Item& ch = parent.chilren.emplace_back(name);
     ch.datas.emplace_back(); // default state
 
-    ++m_itemLevel;
+    m_itemStack.push_back(&ch);
 
 #ifdef MUE_ENABLE_DRAW_TRACE
     m_drawObjectsLogger->beginObject(name, pagePos);
@@ -90,18 +90,18 @@ void BufferedPaintProvider::beginObject(const std::string& name)
 void BufferedPaintProvider::endObject()
 {
     TRACEFUNC;
-    IF_ASSERT_FAILED(m_itemLevel > -1) {
+    IF_ASSERT_FAILED(!m_itemStack.empty()) {
         return;
     }
 
-    DrawData::Item& obj = editableObject();
+    DrawData::Item& obj = *m_itemStack.back();
 
     // remove default state or state without data
-    if (obj.datas.back().empty()) {
+    if (!obj.datas.empty() && obj.datas.back().empty()) {
         obj.datas.pop_back();
     }
 
-    --m_itemLevel;
+    m_itemStack.pop_back();
 
 #ifdef MUE_ENABLE_DRAW_TRACE
     m_drawObjectsLogger->endObject();
@@ -110,10 +110,7 @@ void BufferedPaintProvider::endObject()
 
 const DrawData::Item& BufferedPaintProvider::currentObject() const
 {
-    DrawData::Item* item = &m_buf->item;
-    for (int i = 0; i < m_itemLevel; ++i) {
-        item = &item->chilren.back();
-    }
+    DrawData::Item* item = m_itemStack.empty() ? &m_buf->item : m_itemStack.back();
 
     if (item->datas.empty()) {
         item->datas.emplace_back(); // default state
@@ -124,10 +121,7 @@ const DrawData::Item& BufferedPaintProvider::currentObject() const
 
 DrawData::Item& BufferedPaintProvider::editableObject()
 {
-    DrawData::Item* item = &m_buf->item;
-    for (int i = 0; i < m_itemLevel; ++i) {
-        item = &item->chilren.back();
-    }
+    DrawData::Item* item = m_itemStack.empty() ? &m_buf->item : m_itemStack.back();
 
     if (item->datas.empty()) {
         item->datas.emplace_back(); // default state
@@ -262,7 +256,7 @@ void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount,
     for (size_t i = 0; i < pointCount; ++i) {
         pol[i] = PointF(points[i].x(), points[i].y());
     }
-    editableData().polygons.push_back(DrawPolygon { pol, mode });
+    editableData().polygons.push_back(DrawPolygon { std::move(pol), mode });
 }
 
 void BufferedPaintProvider::drawText(const PointF& point, const String& text)
@@ -328,5 +322,5 @@ void BufferedPaintProvider::clear()
 {
     m_buf = std::make_shared<DrawData>();
     m_pageNo = 0;
-    m_itemLevel = -1;
+    m_itemStack.clear();
 }
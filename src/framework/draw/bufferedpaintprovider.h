@@ -106,7 +106,12 @@ private:
 
     DrawDataPtr m_buf = nullptr;
     int m_pageNo = 0;
-    int m_itemLevel = -1;
+    //! NOTE stack of open items, so the current object is found in O(1)
+    //! instead of walking down from the root on every recorded call.
+    //! Pointers stay valid: children are only appended to the innermost
+    //! open item, so no ancestor's `chilren` vector can reallocate while
+    //! a descendant is still on the stack.
+    std::vector<DrawData::Item*> m_itemStack;
     bool m_isActive = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
 };
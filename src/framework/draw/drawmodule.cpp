@@ -23,7 +23,9 @@
 
 #include "modularity/ioc.h"
 
-#ifndef DRAW_NO_INTERNAL
+#ifdef DRAW_HEADLESS
+#include "internal/fontproviderft.h"
+#elif !defined(DRAW_NO_INTERNAL)
 #include "internal/qfontprovider.h"
 #include "internal/qimageprovider.h"
 #endif
@@ -37,7 +39,11 @@ std::string DrawModule::moduleName() const
 
 void DrawModule::registerExports()
 {
-#ifndef DRAW_NO_INTERNAL
+#ifdef DRAW_HEADLESS
+    //! NOTE no image provider - headless rendering serves the vector and
+    //! notation formats, raster image export needs the Qt build
+    mu::modularity::ioc()->registerExport<draw::IFontProvider>(moduleName(), new FontProviderFT());
+#elif !defined(DRAW_NO_INTERNAL)
     mu::modularity::ioc()->registerExport<draw::IFontProvider>(moduleName(), new QFontProvider());
     mu::modularity::ioc()->registerExport<draw::IImageProvider>(moduleName(), new QImageProvider());
 #endif
@@ -29,6 +29,7 @@
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
 #include FT_BBOX_H
+#include FT_TRUETYPE_TABLES_H
 
 #include "log.h"
 
@@ -60,6 +61,8 @@ struct mu::draw::FTData
     ByteArray fontData;
     FT_Face face = nullptr;
     QHash<char32_t, FTGlyphMetrics> metrics;
+    //! NOTE unscaled values straight from the font, in font units
+    QHash<char32_t, FTGlyphMetrics> designMetrics;
 };
 
 FontEngineFT::FontEngineFT()
@@ -99,6 +102,85 @@ bool FontEngineFT::load(const io::path_t& path)
     return true;
 }
 
+mu::String FontEngineFT::familyName() const
+{
+    if (!m_data->face || !m_data->face->family_name) {
+        return String();
+    }
+
+    return String::fromUtf8(m_data->face->family_name);
+}
+
+bool FontEngineFT::inFont(char32_t ucs4) const
+{
+    return FT_Get_Char_Index(m_data->face, ucs4) != 0;
+}
+
+double FontEngineFT::ascent(double pixelSize) const
+{
+    return designToPixels(m_data->face->ascender, pixelSize);
+}
+
+double FontEngineFT::descent(double pixelSize) const
+{
+    return designToPixels(-m_data->face->descender, pixelSize);
+}
+
+double FontEngineFT::height(double pixelSize) const
+{
+    return ascent(pixelSize) + descent(pixelSize);
+}
+
+double FontEngineFT::lineSpacing(double pixelSize) const
+{
+    return designToPixels(m_data->face->height, pixelSize);
+}
+
+double FontEngineFT::xHeight(double pixelSize) const
+{
+    const TT_OS2* os2 = static_cast<const TT_OS2*>(FT_Get_Sfnt_Table(m_data->face, FT_SFNT_OS2));
+    if (os2 && os2->sxHeight > 0) {
+        return designToPixels(os2->sxHeight, pixelSize);
+    }
+
+    //! NOTE fonts without an OS/2 x-height: measure 'x' itself
+    FTGlyphMetrics* gm = designMetrics(char32_t('x'));
+    if (gm) {
+        return designToPixels(gm->bb.yMax, pixelSize);
+    }
+
+    return ascent(pixelSize) * 0.5;
+}
+
+double FontEngineFT::charAdvance(char32_t ucs4, double pixelSize) const
+{
+    FTGlyphMetrics* gm = designMetrics(ucs4);
+    if (!gm) {
+        return 0.0;
+    }
+
+    return designToPixels(gm->linearHoriAdvance, pixelSize);
+}
+
+QRectF FontEngineFT::charBBox(char32_t ucs4, double pixelSize) const
+{
+    FTGlyphMetrics* gm = designMetrics(ucs4);
+    if (!gm) {
+        return QRectF();
+    }
+
+    const FT_BBox& bb = gm->bb;
+    QRectF bbox;
+    bbox.setCoords(designToPixels(bb.xMin, pixelSize), -designToPixels(bb.yMax, pixelSize),
+                   designToPixels(bb.xMax, pixelSize), -designToPixels(bb.yMin, pixelSize));
+    return bbox;
+}
+
+double FontEngineFT::designToPixels(double value, double pixelSize) const
+{
+    return value * pixelSize / double(m_data->face->units_per_EM);
+}
+
 QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 {
     FTGlyphMetrics* gm = glyphMetrics(ucs4);
@@ -151,3 +233,30 @@ FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
 
     return &gm;
 }
+
+FTGlyphMetrics* FontEngineFT::designMetrics(char32_t ucs4) const
+{
+    if (m_data->designMetrics.contains(ucs4)) {
+        return &m_data->designMetrics[ucs4];
+    }
+
+    FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
+    if (index == 0) {
+        return nullptr;
+    }
+
+    if (FT_Load_Glyph(m_data->face, index, FT_LOAD_NO_SCALE) != 0) {
+        return nullptr;
+    }
+
+    FT_BBox bb;
+    if (FT_Outline_Get_BBox(&m_data->face->glyph->outline, &bb) != 0) {
+        return nullptr;
+    }
+
+    FTGlyphMetrics& gm = m_data->designMetrics[ucs4];
+    gm.bb = bb;
+    gm.linearHoriAdvance = m_data->face->glyph->metrics.horiAdvance;
+
+    return &gm;
+}
@@ -24,6 +24,7 @@
 
 #include <QRectF>
 #include "io/path.h"
+#include "types/string.h"
 
 namespace mu::draw {
 struct FTData;
@@ -36,12 +37,30 @@ public:
 
     bool load(const io::path_t& path);
 
+    String familyName() const;
+
     QRectF bbox(char32_t ucs4, double DPI_F) const;
     double advance(char32_t ucs4, double DPI_F) const;
 
+    bool inFont(char32_t ucs4) const;
+
+    //! NOTE font-wide and per-glyph metrics derived from the design (font unit)
+    //! values, scaled to the given pixel size; used by the headless font provider,
+    //! which has no QFontMetrics to fall back on
+    double ascent(double pixelSize) const;
+    double descent(double pixelSize) const;
+    double height(double pixelSize) const;
+    double lineSpacing(double pixelSize) const;
+    double xHeight(double pixelSize) const;
+
+    double charAdvance(char32_t ucs4, double pixelSize) const;
+    QRectF charBBox(char32_t ucs4, double pixelSize) const;
+
 private:
 
     FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
+    FTGlyphMetrics* designMetrics(char32_t ucs4) const;
+    double designToPixels(double value, double pixelSize) const;
 
     FTData* m_data = nullptr;
 };
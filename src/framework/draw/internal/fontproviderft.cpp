@@ -0,0 +1,268 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "fontproviderft.h"
+
+#include "engraving/libmscore/mscore.h"
+#include "fontengineft.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+int FontProviderFT::addSymbolFont(const String& family, const io::path_t& path)
+{
+    m_fonts[family.toQString()] = path;
+    return engine(family) ? 0 : -1;
+}
+
+int FontProviderFT::addTextFont(const io::path_t& path)
+{
+    //! NOTE there is no font database to read the family name out of the file,
+    //! so the face is loaded eagerly and asked directly
+    FontEngineFT* e = m_engines.value(path.toQString(), nullptr);
+    if (!e) {
+        e = new FontEngineFT();
+        if (!e->load(path)) {
+            delete e;
+            return -1;
+        }
+        m_engines[path.toQString()] = e;
+    }
+
+    String family = e->familyName();
+    if (family.empty()) {
+        return -1;
+    }
+
+    m_fonts[family.toQString()] = path;
+    return 0;
+}
+
+void FontProviderFT::insertSubstitution(const String& familyName, const String& substituteName)
+{
+    m_substitutions[familyName.toQString()] = substituteName.toQString();
+}
+
+double FontProviderFT::lineSpacing(const Font& f) const
+{
+    FontEngineFT* e = engine(f);
+    return e ? e->lineSpacing(pixelSize(f)) : 0.0;
+}
+
+double FontProviderFT::xHeight(const Font& f) const
+{
+    FontEngineFT* e = engine(f);
+    return e ? e->xHeight(pixelSize(f)) : 0.0;
+}
+
+double FontProviderFT::height(const Font& f) const
+{
+    FontEngineFT* e = engine(f);
+    return e ? e->height(pixelSize(f)) : 0.0;
+}
+
+double FontProviderFT::ascent(const Font& f) const
+{
+    FontEngineFT* e = engine(f);
+    return e ? e->ascent(pixelSize(f)) : 0.0;
+}
+
+double FontProviderFT::descent(const Font& f) const
+{
+    FontEngineFT* e = engine(f);
+    return e ? e->descent(pixelSize(f)) : 0.0;
+}
+
+bool FontProviderFT::inFont(const Font& f, Char ch) const
+{
+    return inFontUcs4(f, ch.unicode());
+}
+
+bool FontProviderFT::inFontUcs4(const Font& f, char32_t ucs4) const
+{
+    FontEngineFT* e = engine(f);
+    if (!e || !e->inFont(ucs4)) {
+        return false;
+    }
+
+    //! @NOTE some symbols in fonts dont have glyph. For example U+ee80
+    //! exists in Bravura.otf but doesn't have glyph
+    return e->charBBox(ucs4, pixelSize(f)).isValid();
+}
+
+double FontProviderFT::horizontalAdvance(const Font& f, const String& string) const
+{
+    FontEngineFT* e = engine(f);
+    if (!e) {
+        return 0.0;
+    }
+
+    const double ps = pixelSize(f);
+    double advance = 0.0;
+    for (size_t i = 0; i < string.size(); ++i) {
+        advance += e->charAdvance(string.at(i).unicode(), ps);
+    }
+
+    return advance;
+}
+
+double FontProviderFT::horizontalAdvance(const Font& f, const Char& ch) const
+{
+    FontEngineFT* e = engine(f);
+    return e ? e->charAdvance(ch.unicode(), pixelSize(f)) : 0.0;
+}
+
+RectF FontProviderFT::boundingRect(const Font& f, const String& string) const
+{
+    FontEngineFT* e = engine(f);
+    if (!e) {
+        return RectF();
+    }
+
+    const double ps = pixelSize(f);
+    double x = 0.0;
+    QRectF rect;
+    for (size_t i = 0; i < string.size(); ++i) {
+        char32_t ucs4 = string.at(i).unicode();
+        QRectF bb = e->charBBox(ucs4, ps);
+        if (!bb.isNull()) {
+            rect = rect.united(bb.translated(x, 0.0));
+        }
+        x += e->charAdvance(ucs4, ps);
+    }
+
+    return RectF::fromQRectF(rect);
+}
+
+RectF FontProviderFT::boundingRect(const Font& f, const Char& ch) const
+{
+    FontEngineFT* e = engine(f);
+    if (!e) {
+        return RectF();
+    }
+
+    return RectF::fromQRectF(e->charBBox(ch.unicode(), pixelSize(f)));
+}
+
+RectF FontProviderFT::boundingRect(const Font& f, const RectF& r, int flags, const String& string) const
+{
+    //! NOTE alignment flags are not applied here - without a text engine
+    //! the best available answer is the measured extent anchored at the
+    //! given rect's origin
+    UNUSED(flags);
+
+    return RectF(r.x(), r.y(), horizontalAdvance(f, string), height(f));
+}
+
+RectF FontProviderFT::tightBoundingRect(const Font& f, const String& string) const
+{
+    //! NOTE the union of the actual glyph boxes is already tight
+    return boundingRect(f, string);
+}
+
+// Score symbols
+RectF FontProviderFT::symBBox(const Font& f, char32_t ucs4, double dpi_f) const
+{
+    FontEngineFT* e = engine(f.family());
+    RectF rect;
+    if (e) {
+        rect = RectF::fromQRectF(e->bbox(ucs4, dpi_f));
+    }
+
+    if (!rect.isValid()) {
+        QString sub = m_substitutions.value(f.family().toQString());
+        if (!sub.isEmpty()) {
+            e = engine(String::fromQString(sub));
+            if (e) {
+                rect = RectF::fromQRectF(e->bbox(ucs4, dpi_f));
+            }
+        }
+    }
+
+    return rect;
+}
+
+double FontProviderFT::symAdvance(const Font& f, char32_t ucs4, double dpi_f) const
+{
+    FontEngineFT* e = engine(f.family());
+    double advance = 0.0;
+    if (e) {
+        advance = e->advance(ucs4, dpi_f);
+    }
+
+    if (RealIsNull(advance)) {
+        QString sub = m_substitutions.value(f.family().toQString());
+        if (!sub.isEmpty()) {
+            e = engine(String::fromQString(sub));
+            if (e) {
+                advance = e->advance(ucs4, dpi_f);
+            }
+        }
+    }
+
+    return advance;
+}
+
+FontEngineFT* FontProviderFT::engine(const String& family) const
+{
+    QString path = m_fonts.value(family.toQString()).toQString();
+    if (path.isEmpty()) {
+        return nullptr;
+    }
+
+    FontEngineFT* e = m_engines.value(path, nullptr);
+    if (!e) {
+        e = new FontEngineFT();
+        if (!e->load(path)) {
+            delete e;
+            return nullptr;
+        }
+        m_engines[path] = e;
+    }
+
+    return e;
+}
+
+FontEngineFT* FontProviderFT::engine(const Font& f) const
+{
+    FontEngineFT* e = engine(f.family());
+    if (e) {
+        return e;
+    }
+
+    QString sub = m_substitutions.value(f.family().toQString());
+    if (!sub.isEmpty()) {
+        return engine(String::fromQString(sub));
+    }
+
+    return nullptr;
+}
+
+double FontProviderFT::pixelSize(const Font& f) const
+{
+    if (f.pointSizeF() > 0) {
+        return f.pointSizeF() * mu::engraving::DPI / mu::engraving::PPI;
+    }
+
+    return double(f.pixelSize());
+}
@@ -54,6 +54,24 @@ protected:
 
 static FontPaintDevice device;
 
+//! NOTE keys of the measurement caches; the separator cannot occur in a
+//! font key or in measured text
+static QString measureKey(const QFont& qf, const String& string)
+{
+    return qf.key() + QLatin1Char('\x1f') + string.toQString();
+}
+
+//! NOTE keeps the caches from growing without bound on pathological input
+static constexpr int MEASURE_CACHE_LIMIT = 65536;
+
+template<typename V>
+static void ensureCacheCapacity(QHash<QString, V>& cache)
+{
+    if (cache.size() >= MEASURE_CACHE_LIMIT) {
+        cache.clear();
+    }
+}
+
 int QFontProvider::addSymbolFont(const String& family, const io::path_t& path)
 {
     m_symbolsFonts[family] = path;
@@ -114,7 +132,17 @@ bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 
 double QFontProvider::horizontalAdvance(const Font& f, const String& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    const QFont qf = f.toQFont();
+    const QString key = measureKey(qf, string);
+    auto it = m_advanceCache.constFind(key);
+    if (it != m_advanceCache.constEnd()) {
+        return it.value();
+    }
+
+    double advance = QFontMetricsF(qf, &device).horizontalAdvance(string);
+    ensureCacheCapacity(m_advanceCache);
+    m_advanceCache.insert(key, advance);
+    return advance;
 }
 
 double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
@@ -124,7 +152,17 @@ double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
 
 RectF QFontProvider::boundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    const QFont qf = f.toQFont();
+    const QString key = measureKey(qf, string);
+    auto it = m_boundingRectCache.constFind(key);
+    if (it != m_boundingRectCache.constEnd()) {
+        return it.value();
+    }
+
+    RectF rect = RectF::fromQRectF(QFontMetricsF(qf, &device).boundingRect(string));
+    ensureCacheCapacity(m_boundingRectCache);
+    m_boundingRectCache.insert(key, rect);
+    return rect;
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const Char& ch) const
@@ -139,7 +177,17 @@ RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, cons
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    const QFont qf = f.toQFont();
+    const QString key = measureKey(qf, string);
+    auto it = m_tightBoundingRectCache.constFind(key);
+    if (it != m_tightBoundingRectCache.constEnd()) {
+        return it.value();
+    }
+
+    RectF rect = RectF::fromQRectF(QFontMetricsF(qf, &device).tightBoundingRect(string));
+    ensureCacheCapacity(m_tightBoundingRectCache);
+    m_tightBoundingRectCache.insert(key, rect);
+    return rect;
 }
 
 // Score symbols
@@ -64,6 +64,15 @@ private:
 
     QHash<QString /*family*/, io::path_t> m_symbolsFonts;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+
+    //! NOTE Text shaping/measurement is by far the most expensive part of
+    //! text layout and the same (font, string) pairs are measured again on
+    //! every layout pass (lyrics, chord symbols, ...). The results only
+    //! depend on the font and the string, so they are memoized here,
+    //! shared by all scores.
+    mutable QHash<QString /*font key + string*/, double> m_advanceCache;
+    mutable QHash<QString /*font key + string*/, RectF> m_boundingRectCache;
+    mutable QHash<QString /*font key + string*/, RectF> m_tightBoundingRectCache;
 };
 }
 
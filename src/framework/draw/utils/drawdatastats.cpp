@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "drawdatastats.h"
+
+#include <cmath>
+#include <sstream>
+
+using namespace mu;
+using namespace mu::draw;
+
+static double rectArea(const RectF& rect)
+{
+    return std::abs(rect.width() * rect.height());
+}
+
+static void itemStats(const DrawData::Item& item, DrawDataStats::Stats& stats)
+{
+    stats.itemCount++;
+
+    for (const DrawData::Data& data : item.datas) {
+        const Transform& transform = data.state.transform;
+
+        for (const DrawPath& path : data.paths) {
+            stats.pathCount++;
+            stats.pathPointCount += path.path.elementCount();
+            stats.paintedArea += rectArea(transform.map(path.path.boundingRect()));
+        }
+
+        for (const DrawPolygon& polygon : data.polygons) {
+            stats.polygonCount++;
+            stats.polygonPointCount += polygon.polygon.size();
+            stats.paintedArea += rectArea(transform.map(polygon.polygon.boundingRect()));
+        }
+
+        for (const DrawText& text : data.texts) {
+            stats.textCount++;
+            //! NOTE in Point mode the rect is only an anchor, the painted
+            //! size is unknown at record time
+            if (text.mode == DrawText::Rect) {
+                stats.paintedArea += rectArea(transform.map(text.rect));
+            }
+        }
+
+        for (const DrawPixmap& pixmap : data.pixmaps) {
+            stats.pixmapCount++;
+            stats.paintedArea += rectArea(transform.map(pixmap.rect));
+        }
+    }
+
+    for (const DrawData::Item& child : item.chilren) {
+        itemStats(child, stats);
+    }
+}
+
+DrawDataStats::Stats DrawDataStats::stats(const DrawDataPtr& data)
+{
+    Stats stats;
+    if (!data) {
+        return stats;
+    }
+
+    stats.viewportArea = rectArea(data->viewport);
+    itemStats(data->item, stats);
+
+    return stats;
+}
+
+String DrawDataStats::toString(const DrawDataPtr& data)
+{
+    Stats st = stats(data);
+
+    std::stringstream stream;
+    stream << "draw data: " << (data ? data->name : std::string("none")) << "\n";
+    stream << "  items:        " << st.itemCount << "\n";
+    stream << "  draw calls:   " << st.totalCallCount() << "\n";
+    stream << "    paths:      " << st.pathCount << " (points: " << st.pathPointCount << ")\n";
+    stream << "    polygons:   " << st.polygonCount << " (points: " << st.polygonPointCount << ")\n";
+    stream << "    texts:      " << st.textCount << "\n";
+    stream << "    pixmaps:    " << st.pixmapCount << "\n";
+    stream << "  painted area: " << st.paintedArea << " px2\n";
+    stream << "  viewport:     " << st.viewportArea << " px2\n";
+    stream << "  overdraw:     " << st.overdraw() << "x\n";
+
+    return String::fromStdString(stream.str());
+}
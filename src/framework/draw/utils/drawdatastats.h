@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_DRAWDATASTATS_H
+#define MU_DRAW_DRAWDATASTATS_H
+
+#include "global/types/string.h"
+
+#include "../types/drawdata.h"
+
+namespace mu::draw {
+//! NOTE aggregation pass over recorded DrawData: draw-call counts by type,
+//! path point totals and an overdraw estimate (sum of the transformed
+//! draw-call bounding rects relative to the viewport area)
+class DrawDataStats
+{
+public:
+
+    struct Stats {
+        size_t itemCount = 0;
+
+        size_t pathCount = 0;
+        size_t pathPointCount = 0;
+        size_t polygonCount = 0;
+        size_t polygonPointCount = 0;
+        size_t textCount = 0;
+        size_t pixmapCount = 0;
+
+        double paintedArea = 0.0;
+        double viewportArea = 0.0;
+
+        size_t totalCallCount() const { return pathCount + polygonCount + textCount + pixmapCount; }
+        double overdraw() const { return viewportArea > 0.0 ? paintedArea / viewportArea : 0.0; }
+    };
+
+    static Stats stats(const DrawDataPtr& data);
+    static String toString(const DrawDataPtr& data);
+};
+}
+
+#endif // MU_DRAW_DRAWDATASTATS_H
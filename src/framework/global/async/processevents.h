@@ -33,6 +33,18 @@ inline void onMainThreadInvoke(const std::function<void(const std::function<void
 {
     deto::async::onMainThreadInvoke(f);
 }
+
+//! NOTE gives the thread a lock-free message queue,
+//! so that its processEvents() never blocks on the common mutex
+inline void registerLockFreeQueue(const std::thread::id& th)
+{
+    deto::async::registerLockFreeQueue(th);
+}
+
+inline void unregisterLockFreeQueue(const std::thread::id& th)
+{
+    deto::async::unregisterLockFreeQueue(th);
+}
 }
 
 #endif // MU_ASYNC_PROCESSEVENTS_H
@@ -1,211 +1,387 @@
-/*
- * SPDX-License-Identifier: GPL-3.0-only
- * MuseScore-CLA-applies
- *
- * MuseScore
- * Music Composition & Notation
- *
- * Copyright (C) 2022 MuseScore BVBA and others
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License version 3 as
- * published by the Free Software Foundation.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <https://www.gnu.org/licenses/>.
- */
-
-#ifndef MU_GLOBAL_TASKCHEDULER_H
-#define MU_GLOBAL_TASKCHEDULER_H
-
-#include <condition_variable>
-#include <functional>
-#include <future>
-#include <memory>
-#include <mutex>
-#include <atomic>
-#include <queue>
-#include <thread>
-#include <type_traits>
-#include <utility>
-
-#include "log.h"
-
-namespace mu {
-typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
-
-class TaskScheduler
-{
-public:
-
-    //!Note Would be moved into globalmodule.cpp for better lifetime control
-    static TaskScheduler* instance()
-    {
-        static TaskScheduler s;
-        return &s;
-    }
-
-    explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
-        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
-        m_threadPool(std::make_unique<std::thread[]>(vaildateThreadPoolCapacity(desiredThreadCount)))
-    {
-        setupThreads();
-    }
-
-    ~TaskScheduler()
-    {
-        waitForAllTasksComplete();
-        terminateThreads();
-    }
-
-    thread_pool_size_t threadPoolSize() const
-    {
-        return m_threadPoolSize;
-    }
-
-    template<typename FuncT, typename ... ArgsT>
-    void push(FuncT&& task, ArgsT&&... args)
-    {
-        std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        {
-            const std::lock_guard lock(m_mutex);
-            m_taskQueue.push(taskFunctor);
-        }
-        m_newTaskAvailableCv.notify_one();
-    }
-
-    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
-    std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
-    {
-        std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
-        push([taskFunctor, promise] {
-            try {
-                if constexpr (std::is_void_v<ReturnT>) {
-                    std::invoke(taskFunctor);
-                    promise->set_value();
-                } else {
-                    promise->set_value(std::invoke(taskFunctor));
-                }
-            } catch (...) {
-                try {
-                    promise->set_exception(std::current_exception());
-                } catch (...) {
-                    LOGE() << "Unable to schedule a task";
-                }
-            }
-        });
-
-        return promise->get_future();
-    }
-
-    void waitForAllTasksComplete()
-    {
-        m_isWaitingForAllTasksDone = true;
-        std::unique_lock<std::mutex> tasks_lock(m_mutex);
-        m_taskFinishedCv.wait(tasks_lock, [this] { return m_taskQueue.empty(); });
-        m_isWaitingForAllTasksDone = false;
-    }
-
-    const std::set<std::thread::id>& threadIdSet() const
-    {
-        static std::set<std::thread::id> result;
-
-        if (result.empty()) {
-            for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-                result.insert(m_threadPool[i].get_id());
-            }
-        }
-
-        return result;
-    }
-
-    bool containsThread(const std::thread::id& id) const
-    {
-        const auto& idSet = threadIdSet();
-        return idSet.find(id) != idSet.cend();
-    }
-
-private:
-    void setupThreads()
-    {
-        m_isActive = true;
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i] = std::thread(&TaskScheduler::th_workerLoop, this);
-        }
-    }
-
-    void terminateThreads()
-    {
-        m_isActive = false;
-        m_newTaskAvailableCv.notify_all();
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i].join();
-        }
-    }
-
-    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
-    {
-        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
-
-        if (maxCapacity <= 1) {
-            return 1;
-        }
-
-        thread_pool_size_t optimalCapacity = maxCapacity / 2;
-
-        if (desiredThreadCount <= 0) {
-            return optimalCapacity;
-        }
-
-        return desiredThreadCount;
-    }
-
-    void th_workerLoop()
-    {
-        while (m_isActive) {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_newTaskAvailableCv.wait(lock, [this] { return !m_taskQueue.empty() || !m_isActive; });
-
-            if (!m_isActive) {
-                return;
-            }
-
-            std::function<void()> task = m_taskQueue.front();
-            m_taskQueue.pop();
-
-            bool isQueueEmpty = m_taskQueue.empty();
-
-            lock.unlock();
-
-            task();
-
-            if (m_isWaitingForAllTasksDone) {
-                m_taskFinishedCv.notify_one();
-            }
-
-            if (isQueueEmpty) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            }
-        }
-    }
-
-    std::atomic<bool> m_isActive = false;
-    std::atomic<bool> m_isWaitingForAllTasksDone = false;
-
-    mutable std::mutex m_mutex;
-    std::condition_variable m_newTaskAvailableCv;
-    std::condition_variable m_taskFinishedCv;
-    std::queue<std::function<void()> > m_taskQueue;
-
-    thread_pool_size_t m_threadPoolSize = 0;
-    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
-};
-}
-
-#endif // MU_GLOBAL_TASKCHEDULER_H
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_GLOBAL_TASKCHEDULER_H
+#define MU_GLOBAL_TASKCHEDULER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "log.h"
+
+namespace mu {
+typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
+
+enum class TaskPriority {
+    Normal = 0,
+    High
+};
+
+//! NOTE work-stealing pool shared by the whole application (audio mixer,
+//! layout, playback model, ...), so the subsystems parallelize against the
+//! same threads instead of oversubscribing the machine with private pools.
+//! Every worker owns a deque: it pops its own tasks from the front (so
+//! nested tasks pushed by a worker keep cache locality) and steals from the
+//! back of the other workers' deques when it runs dry. High-priority tasks
+//! jump to the front of the queue they land in.
+class TaskScheduler
+{
+public:
+
+    //!Note Would be moved into globalmodule.cpp for better lifetime control
+    static TaskScheduler* instance()
+    {
+        static TaskScheduler s;
+        return &s;
+    }
+
+    explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
+        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount))
+    {
+        setupThreads();
+    }
+
+    ~TaskScheduler()
+    {
+        waitForAllTasksComplete();
+        terminateThreads();
+    }
+
+    thread_pool_size_t threadPoolSize() const
+    {
+        return m_threadPoolSize;
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FuncT>, TaskPriority> > >
+    void push(FuncT&& task, ArgsT&&... args)
+    {
+        push(TaskPriority::Normal, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    template<typename FuncT, typename ... ArgsT>
+    void push(TaskPriority priority, FuncT&& task, ArgsT&&... args)
+    {
+        pushTask(priority, std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...));
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...>,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<FuncT>, TaskPriority> > >
+    std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
+    {
+        return submit(TaskPriority::Normal, std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
+    std::future<ReturnT> submit(TaskPriority priority, FuncT&& task, ArgsT&&... args)
+    {
+        std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
+        std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
+        push(priority, [taskFunctor, promise] {
+            try {
+                if constexpr (std::is_void_v<ReturnT>) {
+                    std::invoke(taskFunctor);
+                    promise->set_value();
+                } else {
+                    promise->set_value(std::invoke(taskFunctor));
+                }
+            } catch (...) {
+                try {
+                    promise->set_exception(std::current_exception());
+                } catch (...) {
+                    LOGE() << "Unable to schedule a task";
+                }
+            }
+        });
+
+        return promise->get_future();
+    }
+
+    void waitForAllTasksComplete()
+    {
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        m_taskFinishedCv.wait(lock, [this] { return m_pendingTaskCount.load() == 0; });
+    }
+
+    std::set<std::thread::id> threadIdSet() const
+    {
+        return m_threadIdSet;
+    }
+
+    bool containsThread(const std::thread::id& id) const
+    {
+        return m_threadIdSet.find(id) != m_threadIdSet.cend();
+    }
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<std::function<void()> > queue;
+    };
+
+    void setupThreads()
+    {
+        m_isActive = true;
+
+        m_workers.reserve(m_threadPoolSize);
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+
+        m_threads.reserve(m_threadPoolSize);
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threads.emplace_back(&TaskScheduler::th_workerLoop, this, size_t(i));
+            m_threadIdSet.insert(m_threads.back().get_id());
+        }
+    }
+
+    void terminateThreads()
+    {
+        m_isActive = false;
+        {
+            const std::lock_guard<std::mutex> lock(m_waitMutex);
+        }
+        m_newTaskAvailableCv.notify_all();
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
+    {
+        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
+
+        if (maxCapacity <= 1) {
+            return 1;
+        }
+
+        thread_pool_size_t optimalCapacity = maxCapacity / 2;
+
+        if (desiredThreadCount <= 0) {
+            return optimalCapacity;
+        }
+
+        return desiredThreadCount;
+    }
+
+    void pushTask(TaskPriority priority, std::function<void()> task)
+    {
+        m_pendingTaskCount.fetch_add(1);
+        m_queuedTaskCount.fetch_add(1);
+
+        //! NOTE a worker pushes nested tasks onto its own deque, outside
+        //! threads distribute round-robin; the modulo also keeps the index
+        //! valid for a worker of another (smaller) scheduler instance
+        size_t workerIdx = (t_workerIndex >= 0
+                            ? size_t(t_workerIndex)
+                            : m_nextWorkerIndex.fetch_add(1)) % m_workers.size();
+
+        Worker& worker = *m_workers.at(workerIdx);
+        {
+            const std::lock_guard<std::mutex> lock(worker.mutex);
+            if (priority == TaskPriority::High) {
+                worker.queue.push_front(std::move(task));
+            } else {
+                worker.queue.push_back(std::move(task));
+            }
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock(m_waitMutex);
+        }
+        m_newTaskAvailableCv.notify_one();
+    }
+
+    bool tryPopLocal(size_t workerIndex, std::function<void()>& task)
+    {
+        Worker& worker = *m_workers.at(workerIndex);
+        const std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.queue.empty()) {
+            return false;
+        }
+
+        task = std::move(worker.queue.front());
+        worker.queue.pop_front();
+        m_queuedTaskCount.fetch_sub(1);
+        return true;
+    }
+
+    bool trySteal(size_t thiefIndex, std::function<void()>& task)
+    {
+        for (size_t i = 1; i < m_workers.size(); ++i) {
+            Worker& victim = *m_workers.at((thiefIndex + i) % m_workers.size());
+            const std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.queue.empty()) {
+                continue;
+            }
+
+            //! NOTE steal from the back: the owner works on the front, so
+            //! the two ends rarely contend
+            task = std::move(victim.queue.back());
+            victim.queue.pop_back();
+            m_queuedTaskCount.fetch_sub(1);
+            return true;
+        }
+
+        return false;
+    }
+
+    void th_workerLoop(size_t workerIndex)
+    {
+        t_workerIndex = int(workerIndex);
+
+        while (m_isActive) {
+            std::function<void()> task;
+            if (!tryPopLocal(workerIndex, task) && !trySteal(workerIndex, task)) {
+                std::unique_lock<std::mutex> lock(m_waitMutex);
+                m_newTaskAvailableCv.wait(lock, [this] { return m_queuedTaskCount.load() > 0 || !m_isActive; });
+                continue;
+            }
+
+            task();
+
+            if (m_pendingTaskCount.fetch_sub(1) == 1) {
+                {
+                    const std::lock_guard<std::mutex> lock(m_waitMutex);
+                }
+                m_taskFinishedCv.notify_all();
+            }
+        }
+    }
+
+    static inline thread_local int t_workerIndex = -1;
+
+    std::atomic<bool> m_isActive = false;
+    std::atomic_int m_pendingTaskCount = 0;
+    std::atomic_int m_queuedTaskCount = 0;
+    std::atomic_size_t m_nextWorkerIndex = 0;
+
+    mutable std::mutex m_waitMutex;
+    std::condition_variable m_newTaskAvailableCv;
+    std::condition_variable m_taskFinishedCv;
+
+    thread_pool_size_t m_threadPoolSize = 0;
+    std::vector<std::unique_ptr<Worker> > m_workers;
+    std::vector<std::thread> m_threads;
+    std::set<std::thread::id> m_threadIdSet;
+};
+
+//! NOTE minimal task-graph support on top of the scheduler: tasks added to
+//! a group run in parallel, a continuation scheduled with then() runs once
+//! after the last of them finishes, and wait() joins the whole group
+class TaskGroup
+{
+public:
+    explicit TaskGroup(TaskScheduler* scheduler = nullptr)
+        : m_scheduler(scheduler ? scheduler : TaskScheduler::instance())
+    {
+        m_state = std::make_shared<State>();
+    }
+
+    template<typename FuncT>
+    void add(FuncT&& task, TaskPriority priority = TaskPriority::Normal)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(m_state->mutex);
+            m_state->remaining++;
+        }
+
+        std::shared_ptr<State> state = m_state;
+        TaskScheduler* scheduler = m_scheduler;
+        m_scheduler->push(priority, [state, scheduler, task = std::forward<FuncT>(task)]() {
+            task();
+            onTaskFinished(state, scheduler);
+        });
+    }
+
+    template<typename FuncT>
+    void then(FuncT&& continuation, TaskPriority priority = TaskPriority::Normal)
+    {
+        bool runNow = false;
+        {
+            const std::lock_guard<std::mutex> lock(m_state->mutex);
+            if (m_state->remaining == 0) {
+                runNow = true;
+            } else {
+                m_state->continuation = std::forward<FuncT>(continuation);
+                m_state->continuationPriority = priority;
+            }
+        }
+
+        if (runNow) {
+            m_scheduler->push(priority, std::forward<FuncT>(continuation));
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_state->mutex);
+        m_state->cv.wait(lock, [this] { return m_state->remaining == 0; });
+    }
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable cv;
+        int remaining = 0;
+        std::function<void()> continuation;
+        TaskPriority continuationPriority = TaskPriority::Normal;
+    };
+
+    static void onTaskFinished(const std::shared_ptr<State>& state, TaskScheduler* scheduler)
+    {
+        std::function<void()> continuation;
+        TaskPriority priority = TaskPriority::Normal;
+        {
+            const std::lock_guard<std::mutex> lock(state->mutex);
+            state->remaining--;
+            if (state->remaining != 0) {
+                return;
+            }
+
+            continuation = std::move(state->continuation);
+            state->continuation = nullptr;
+            priority = state->continuationPriority;
+        }
+
+        state->cv.notify_all();
+
+        if (continuation) {
+            scheduler->push(priority, std::move(continuation));
+        }
+    }
+
+    TaskScheduler* m_scheduler = nullptr;
+    std::shared_ptr<State> m_state;
+};
+}
+
+#endif // MU_GLOBAL_TASKCHEDULER_H
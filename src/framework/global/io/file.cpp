@@ -23,6 +23,15 @@
 
 #include <cstring>
 
+#if defined(Q_OS_WIN) || defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "ioretcodes.h"
 
 using namespace mu::io;
@@ -99,6 +108,13 @@ bool File::doOpen(OpenMode m)
         }
     }
 
+    //! NOTE for read-only access try to map the file instead of reading it in:
+    //! the OS pages the data in on first access, so consumers that touch only parts
+    //! of a big file (like single entries of a zip container) don't pay for the rest
+    if (m == OpenMode::ReadOnly && mapData()) {
+        return true;
+    }
+
     m_data = ByteArray();
     bool ok = fileSystem()->readFile(m_filePath, m_data);
     if (!ok) {
@@ -109,24 +125,113 @@ bool File::doOpen(OpenMode m)
     return true;
 }
 
+void File::doClose()
+{
+    unmapData();
+}
+
+bool File::mapData()
+{
+#if defined(Q_OS_WIN) || defined(_WIN32)
+    HANDLE file = CreateFileW(m_filePath.toStdWString().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data) {
+        return false;
+    }
+
+    m_mappedData = static_cast<const uint8_t*>(data);
+    m_mappedSize = static_cast<size_t>(size.QuadPart);
+
+    return true;
+#else
+    int fd = ::open(m_filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    m_mappedData = static_cast<const uint8_t*>(data);
+    m_mappedSize = static_cast<size_t>(st.st_size);
+
+    return true;
+#endif
+}
+
+void File::unmapData()
+{
+    if (!m_mappedData) {
+        return;
+    }
+
+#if defined(Q_OS_WIN) || defined(_WIN32)
+    UnmapViewOfFile(m_mappedData);
+#else
+    munmap(const_cast<uint8_t*>(m_mappedData), m_mappedSize);
+#endif
+
+    m_mappedData = nullptr;
+    m_mappedSize = 0;
+}
+
+void File::materializeMappedData()
+{
+    if (!m_mappedData) {
+        return;
+    }
+
+    m_data = ByteArray(m_mappedData, m_mappedSize);
+    unmapData();
+}
+
 size_t File::dataSize() const
 {
-    return m_data.size();
+    return m_mappedData ? m_mappedSize : m_data.size();
 }
 
 const uint8_t* File::rawData() const
 {
-    return m_data.constData();
+    return m_mappedData ? m_mappedData : m_data.constData();
 }
 
 bool File::resizeData(size_t size)
 {
+    materializeMappedData();
     m_data.resize(size);
     return true;
 }
 
 size_t File::writeData(const uint8_t* data, size_t len)
 {
+    materializeMappedData();
     std::memcpy(m_data.data() + pos(), data, len);
     bool ok = fileSystem()->writeFile(m_filePath, m_data);
     if (!ok) {
@@ -62,6 +62,7 @@ public:
 protected:
 
     bool doOpen(OpenMode m) override;
+    void doClose() override;
     size_t dataSize() const override;
     const uint8_t* rawData() const override;
     bool resizeData(size_t size) override;
@@ -69,8 +70,16 @@ protected:
 
 private:
 
+    bool mapData();
+    void unmapData();
+    void materializeMappedData();
+
     path_t m_filePath;
     ByteArray m_data;
+    //! NOTE read-only files are memory-mapped instead of being read in,
+    //! so the OS pages the data in only as it is actually accessed
+    const uint8_t* m_mappedData = nullptr;
+    size_t m_mappedSize = 0;
     Error m_error = Error::NoError;
 };
 }
@@ -75,6 +75,10 @@ public:
     void setCompressionPolicy(CompressionPolicy policy);
     CompressionPolicy compressionPolicy() const;
 
+    //! NOTE zlib level: -1 default, 0 store, 1 fastest .. 9 smallest
+    void setCompressionLevel(int level);
+    int compressionLevel() const;
+
     void addFile(const std::string& fileName, const ByteArray& data);
     void addDirectory(const std::string& dirName);
 
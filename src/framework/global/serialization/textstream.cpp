@@ -20,7 +20,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "textstream.h"
-#include <sstream>
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
 
 using namespace mu;
 
@@ -55,59 +58,72 @@ TextStream& TextStream::operator<<(char ch)
     return *this;
 }
 
+//! NOTE numbers used to be formatted through a std::stringstream constructed
+//! per call, so every serialized value paid for the stream's allocations and
+//! locale machinery; saving a score writes numbers by the hundred thousand.
+//! Integers go through std::to_chars, doubles through snprintf, both into a
+//! stack buffer.
+template<typename T>
+static inline size_t toChars(char* buf, size_t size, T val)
+{
+    std::to_chars_result res = std::to_chars(buf, buf + size, val);
+    return res.ptr - buf;
+}
+
 TextStream& TextStream::operator<<(int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    write(buf, toChars(buf, sizeof(buf), val));
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    write(buf, toChars(buf, sizeof(buf), val));
     return *this;
 }
 
 TextStream& TextStream::operator<<(double val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    //! NOTE same format as the stringstream this replaces (%g, precision 6),
+    //! normalized to a '.' decimal separator whatever the C locale says
+    char buf[32];
+    int len = std::snprintf(buf, sizeof(buf), "%g", val);
+    for (int i = 0; i < len; ++i) {
+        if (buf[i] == ',') {
+            buf[i] = '.';
+        }
+    }
+    write(buf, len);
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    write(buf, toChars(buf, sizeof(buf), val));
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    write(buf, toChars(buf, sizeof(buf), val));
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    write(buf, toChars(buf, sizeof(buf), val));
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    char buf[24];
+    write(buf, toChars(buf, sizeof(buf), val));
     return *this;
 }
 
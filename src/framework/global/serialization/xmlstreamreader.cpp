@@ -276,7 +276,19 @@ String XmlStreamReader::attribute(const char* name) const
 
 String XmlStreamReader::attribute(const char* name, const String& def) const
 {
-    return hasAttribute(name) ? attribute(name) : def;
+    if (m_token != TokenType::StartElement) {
+        return def;
+    }
+
+    XMLElement* e = m_xml->node->ToElement();
+    if (!e) {
+        return def;
+    }
+
+    // a single FindAttribute instead of hasAttribute + attribute,
+    // which would walk the attribute list twice
+    const XMLAttribute* a = e->FindAttribute(name);
+    return a ? String::fromUtf8(a->Value()) : def;
 }
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name) const
@@ -294,7 +306,17 @@ AsciiStringView XmlStreamReader::asciiAttribute(const char* name) const
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name, const AsciiStringView& def) const
 {
-    return hasAttribute(name) ? asciiAttribute(name) : def;
+    if (m_token != TokenType::StartElement) {
+        return def;
+    }
+
+    XMLElement* e = m_xml->node->ToElement();
+    if (!e) {
+        return def;
+    }
+
+    const XMLAttribute* a = e->FindAttribute(name);
+    return a ? AsciiStringView(a->Value()) : def;
 }
 
 int XmlStreamReader::intAttribute(const char* name) const
@@ -304,7 +326,17 @@ int XmlStreamReader::intAttribute(const char* name) const
 
 int XmlStreamReader::intAttribute(const char* name, int def) const
 {
-    return hasAttribute(name) ? intAttribute(name) : def;
+    if (m_token != TokenType::StartElement) {
+        return def;
+    }
+
+    XMLElement* e = m_xml->node->ToElement();
+    if (!e) {
+        return def;
+    }
+
+    const XMLAttribute* a = e->FindAttribute(name);
+    return a ? AsciiStringView(a->Value()).toInt() : def;
 }
 
 double XmlStreamReader::doubleAttribute(const char* name) const
@@ -314,7 +346,17 @@ double XmlStreamReader::doubleAttribute(const char* name) const
 
 double XmlStreamReader::doubleAttribute(const char* name, double def) const
 {
-    return hasAttribute(name) ? doubleAttribute(name) : def;
+    if (m_token != TokenType::StartElement) {
+        return def;
+    }
+
+    XMLElement* e = m_xml->node->ToElement();
+    if (!e) {
+        return def;
+    }
+
+    const XMLAttribute* a = e->FindAttribute(name);
+    return a ? AsciiStringView(a->Value()).toDouble() : def;
 }
 
 std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
@@ -34,9 +34,17 @@ struct XmlStreamWriter::Impl {
 
     void putLevel()
     {
-        size_t level = stack.size();
-        for (size_t i = 0; i < level * 2; ++i) {
-            stream << ' ';
+        //! NOTE emitted as whole chunks of a constant instead of one
+        //! character at a time - the indentation runs in front of every
+        //! single line of the document
+        static constexpr const char SPACES[] = "                                                                ";
+        static constexpr size_t SPACES_SIZE = sizeof(SPACES) - 1;
+
+        size_t count = stack.size() * 2;
+        while (count > 0) {
+            size_t chunk = count < SPACES_SIZE ? count : SPACES_SIZE;
+            stream << AsciiStringView(SPACES, chunk);
+            count -= chunk;
         }
     }
 };
@@ -84,6 +84,11 @@ void ZipWriter::close()
     m_impl->isClosed = true;
 }
 
+void ZipWriter::setCompressionLevel(int level)
+{
+    m_impl->zip->setCompressionLevel(level);
+}
+
 bool ZipWriter::hasError() const
 {
     return m_impl->zip->status() != ZipContainer::NoError;
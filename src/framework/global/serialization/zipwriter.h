@@ -37,6 +37,9 @@ public:
     void close();
     bool hasError() const;
 
+    //! NOTE zlib level: -1 default, 0 store, 1 fastest .. 9 smallest
+    void setCompressionLevel(int level);
+
     void addFile(const std::string& fileName, const ByteArray& data);
 
 private:
@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include "concurrency/taskscheduler.h"
+
+using namespace mu;
+
+class Global_TaskSchedulerTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_TaskSchedulerTests, SubmitAndWait)
+{
+    TaskScheduler scheduler(4);
+
+    EXPECT_EQ(scheduler.threadPoolSize(), 4);
+
+    std::vector<std::future<int> > results;
+    for (int i = 0; i < 100; ++i) {
+        results.push_back(scheduler.submit([i]() { return i * 2; }));
+    }
+
+    int sum = 0;
+    for (std::future<int>& result : results) {
+        sum += result.get();
+    }
+
+    // sum of 2*i for i in [0, 100)
+    EXPECT_EQ(sum, 9900);
+}
+
+TEST_F(Global_TaskSchedulerTests, WaitForAllTasksComplete)
+{
+    TaskScheduler scheduler(4);
+
+    std::atomic_int doneCount = 0;
+    for (int i = 0; i < 200; ++i) {
+        scheduler.push([&doneCount]() { doneCount.fetch_add(1); });
+    }
+
+    scheduler.waitForAllTasksComplete();
+
+    EXPECT_EQ(doneCount.load(), 200);
+}
+
+TEST_F(Global_TaskSchedulerTests, NestedTasks)
+{
+    TaskScheduler scheduler(2);
+
+    //! NOTE a task pushed from a worker thread must not deadlock
+    std::atomic_int doneCount = 0;
+    std::future<void> outer = scheduler.submit([&scheduler, &doneCount]() {
+        for (int i = 0; i < 10; ++i) {
+            scheduler.push([&doneCount]() { doneCount.fetch_add(1); });
+        }
+    });
+
+    outer.wait();
+    scheduler.waitForAllTasksComplete();
+
+    EXPECT_EQ(doneCount.load(), 10);
+}
+
+TEST_F(Global_TaskSchedulerTests, GroupContinuation)
+{
+    TaskScheduler scheduler(4);
+
+    std::atomic_int taskCount = 0;
+    std::atomic_bool continuationDone = false;
+
+    TaskGroup group(&scheduler);
+    for (int i = 0; i < 50; ++i) {
+        group.add([&taskCount]() { taskCount.fetch_add(1); });
+    }
+
+    group.then([&taskCount, &continuationDone]() {
+        //! NOTE the continuation must run after the last task of the group
+        EXPECT_EQ(taskCount.load(), 50);
+        continuationDone = true;
+    });
+
+    group.wait();
+    scheduler.waitForAllTasksComplete();
+
+    EXPECT_TRUE(continuationDone.load());
+}
@@ -59,6 +59,15 @@ public:
         return m_ptr && ptr()->isConnected();
     }
 
+    //! NOTE when enabled, cross-thread deliveries are coalesced per
+    //! receiver: an emission replaces the payload of a still-queued
+    //! previous one instead of queuing another invocation, so bulk sends
+    //! deliver only the latest state per event-loop turn
+    void setBatchedMode(bool batched)
+    {
+        ptr()->setBatched(batched);
+    }
+
 private:
 
     enum CallType {
@@ -43,6 +43,10 @@ void AbstractInvoker::invoke(int type, const NotifyData& data)
         if (c.threadID == threadID) {
             invokeCallback(type, c, data);
         } else {
+            if (m_batched.load() && tryCoalesce(type, c, data)) {
+                continue;
+            }
+
             QInvoker* qi = new QInvoker(this, type, c, data);
             QueuedInvoker::instance()->invoke(c.threadID, [qi]() {
                 qi->invoke();
@@ -77,6 +81,39 @@ void AbstractInvoker::onMainThreadInvoke(const std::function<void(const std::fun
     QueuedInvoker::instance()->onMainThreadInvoke(f);
 }
 
+void AbstractInvoker::registerLockFreeQueue(const std::thread::id& th)
+{
+    QueuedInvoker::instance()->registerLockFreeQueue(th);
+}
+
+void AbstractInvoker::unregisterLockFreeQueue(const std::thread::id& th)
+{
+    QueuedInvoker::instance()->unregisterLockFreeQueue(th);
+}
+
+void AbstractInvoker::setBatched(bool batched)
+{
+    m_batched.store(batched);
+}
+
+bool AbstractInvoker::tryCoalesce(int type, const CallBack& c, const NotifyData& data)
+{
+    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
+    for (QInvoker* qi : m_qInvokers) {
+        if (qi->type != type || qi->call.call != c.call) {
+            continue;
+        }
+
+        //! NOTE a pending invocation for the same receiver hasn't run yet,
+        //! just replace its payload with the newer one
+        if (qi->trySetData(data)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool AbstractInvoker::isConnected() const
 {
     for (auto it = m_callbacks.cbegin(); it != m_callbacks.cend(); ++it) {
@@ -1,6 +1,7 @@
 #ifndef DETO_ASYNC_ABSTRACTINVOKER_H
 #define DETO_ASYNC_ABSTRACTINVOKER_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <list>
@@ -74,8 +75,17 @@ public:
 
     bool isConnected() const;
 
+    //! NOTE in batched mode cross-thread emissions are coalesced per
+    //! receiver: while a queued invocation is still pending, a new emission
+    //! only replaces its payload instead of queuing another one, so a bulk
+    //! operation delivers the latest state once per event-loop turn.
+    //! Same-thread deliveries stay synchronous as before.
+    void setBatched(bool batched);
+
     static void processEvents();
     static void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f);
+    static void registerLockFreeQueue(const std::thread::id& th);
+    static void unregisterLockFreeQueue(const std::thread::id& th);
 
 protected:
     explicit AbstractInvoker();
@@ -125,13 +135,16 @@ protected:
         void invoke()
         {
             AbstractInvoker* inv = nullptr;
+            NotifyData d;
             {
                 std::lock_guard<std::mutex> lock(mutex);
                 inv = invoker;
+                d = data;
+                consumed = true;
             }
 
             if (inv) {
-                inv->invokeCallback(type, call, data);
+                inv->invokeCallback(type, call, d);
             }
         }
 
@@ -140,6 +153,19 @@ protected:
             std::lock_guard<std::mutex> lock(mutex);
             invoker = nullptr;
         }
+
+        bool trySetData(const NotifyData& d)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!invoker || consumed) {
+                return false;
+            }
+
+            data = d;
+            return true;
+        }
+
+        bool consumed = false;
     };
 
     void invokeCallback(int type, const CallBack& c, const NotifyData& data);
@@ -151,12 +177,16 @@ protected:
     void addQInvoker(QInvoker* qi);
     void removeQInvoker(QInvoker* qi);
 
+    bool tryCoalesce(int type, const CallBack& c, const NotifyData& data);
+
     bool containsReceiver(Asyncable* receiver) const;
 
     std::map<int /*type*/, CallBacks > m_callbacks;
 
     std::mutex m_qInvokersMutex;
     std::list<QInvoker*> m_qInvokers;
+
+    std::atomic<bool> m_batched = false;
 };
 
 inline void processEvents()
@@ -168,6 +198,16 @@ inline void onMainThreadInvoke(const std::function<void(const std::function<void
 {
     AbstractInvoker::onMainThreadInvoke(f);
 }
+
+inline void registerLockFreeQueue(const std::thread::id& th)
+{
+    AbstractInvoker::registerLockFreeQueue(th);
+}
+
+inline void unregisterLockFreeQueue(const std::thread::id& th)
+{
+    AbstractInvoker::unregisterLockFreeQueue(th);
+}
 }
 }
 
@@ -13,15 +13,58 @@ void QueuedInvoker::invoke(const std::thread::id& th, const Functor& f, bool isA
     if (m_onMainThreadInvoke) {
         if (th == m_mainThreadID) {
             m_onMainThreadInvoke(f, isAlwaysQueued);
+            return;
         }
     }
 
+    if (LockFreeQueue* q = lockFreeQueue(th)) {
+        // While a spill is pending the ring must not be used: the spilled
+        // messages are older than anything pushed now, and processEvents()
+        // drains the ring first. Routing everything through the map until the
+        // spill is gone keeps per-sender delivery order intact.
+        if (m_overflowCount.load(std::memory_order_acquire) == 0) {
+            // When the ring is full the consumer is far behind, so wait for free
+            // space for a while instead of breaking the delivery order
+            for (int attempt = 0; attempt < 1000; ++attempt) {
+                if (q->push(f)) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        // the consumer is badly stalled; spill into the mutex map rather than
+        // blocking here forever - processEvents() drains the spill after the
+        // (strictly older) ring entries
+        m_overflowCount.fetch_add(1, std::memory_order_release);
+    }
+
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     m_queues[th].push(f);
 }
 
 void QueuedInvoker::processEvents()
 {
+    bool ringDrained = false;
+    if (LockFreeQueue* q = lockFreeQueue(std::this_thread::get_id())) {
+        Functor f;
+        while (q->pop(f)) {
+            if (f) {
+                f();
+            }
+        }
+
+        // invoke() spills into the mutex map when the ring stays full and keeps
+        // using the map while the spill is pending, so every ring entry is
+        // older than every spilled one and ring-first draining preserves
+        // per-sender order; the counter keeps the common no-overflow path
+        // free of the lock
+        if (m_overflowCount.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+        ringDrained = true;
+    }
+
     Queue q;
     {
         std::lock_guard<std::recursive_mutex> lock(m_mutex);
@@ -30,6 +73,11 @@ void QueuedInvoker::processEvents()
             q = n.mapped();
         }
     }
+
+    if (ringDrained && !q.empty()) {
+        m_overflowCount.fetch_sub(q.size(), std::memory_order_acq_rel);
+    }
+
     while (!q.empty()) {
         const auto& f = q.front();
         if (f) {
@@ -44,3 +92,130 @@ void QueuedInvoker::onMainThreadInvoke(const std::function<void(const std::funct
     m_onMainThreadInvoke = f;
     m_mainThreadID = std::this_thread::get_id();
 }
+
+void QueuedInvoker::registerLockFreeQueue(const std::thread::id& th)
+{
+    if (lockFreeQueue(th)) {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    for (size_t i = 0; i < MAX_LOCK_FREE_QUEUES; ++i) {
+        LockFreeEntry& entry = m_lockFreeQueues[i];
+
+        if (entry.threadId.load(std::memory_order_acquire) != std::thread::id()) {
+            continue;
+        }
+
+        if (!entry.queue) {
+            entry.queue.reset(new LockFreeQueue(LOCK_FREE_QUEUE_CAPACITY));
+        }
+
+        // keep whatever was queued for the thread before the registration
+        auto n = m_queues.extract(th);
+        if (!n.empty()) {
+            Queue& pending = n.mapped();
+            while (!pending.empty()) {
+                entry.queue->push(pending.front());
+                pending.pop();
+            }
+        }
+
+        entry.threadId.store(th, std::memory_order_release);
+        return;
+    }
+}
+
+void QueuedInvoker::unregisterLockFreeQueue(const std::thread::id& th)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    for (size_t i = 0; i < MAX_LOCK_FREE_QUEUES; ++i) {
+        LockFreeEntry& entry = m_lockFreeQueues[i];
+
+        if (entry.threadId.load(std::memory_order_acquire) != th) {
+            continue;
+        }
+
+        entry.threadId.store(std::thread::id(), std::memory_order_release);
+
+        // drop the leftovers, so that they are not delivered
+        // to whoever reuses the slot
+        Functor f;
+        while (entry.queue->pop(f)) {
+        }
+
+        // same for any overflow spill still sitting in the mutex map
+        auto n = m_queues.extract(th);
+        if (!n.empty()) {
+            m_overflowCount.fetch_sub(n.mapped().size(), std::memory_order_acq_rel);
+        }
+
+        return;
+    }
+}
+
+QueuedInvoker::LockFreeQueue* QueuedInvoker::lockFreeQueue(const std::thread::id& th)
+{
+    for (size_t i = 0; i < MAX_LOCK_FREE_QUEUES; ++i) {
+        if (m_lockFreeQueues[i].threadId.load(std::memory_order_acquire) == th) {
+            return m_lockFreeQueues[i].queue.get();
+        }
+    }
+
+    return nullptr;
+}
+
+QueuedInvoker::LockFreeQueue::LockFreeQueue(size_t capacity)
+    : m_cells(new Cell[capacity]), m_mask(capacity - 1)
+{
+    for (size_t i = 0; i < capacity; ++i) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool QueuedInvoker::LockFreeQueue::push(const Functor& f)
+{
+    Cell* cell = nullptr;
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        cell = &m_cells[pos & m_mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false; // full
+        } else {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->functor = f;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool QueuedInvoker::LockFreeQueue::pop(Functor& f)
+{
+    size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    Cell* cell = &m_cells[pos & m_mask];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+        return false; // empty
+    }
+
+    f = std::move(cell->functor);
+    cell->functor = nullptr;
+    cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+    m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+    return true;
+}
@@ -6,6 +6,8 @@
 #include <map>
 #include <mutex>
 #include <thread>
+#include <atomic>
+#include <memory>
 
 namespace deto {
 namespace async {
@@ -21,15 +23,60 @@ public:
     void processEvents();
     void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f);
 
+    // Gives the thread a bounded lock-free queue, so that neither its processEvents()
+    // nor the producers posting to it ever take the common mutex
+    void registerLockFreeQueue(const std::thread::id& th);
+    void unregisterLockFreeQueue(const std::thread::id& th);
+
 private:
 
     QueuedInvoker() = default;
 
     using Queue = std::queue<Functor>;
 
+    // Bounded multi-producer queue with a single lock-free consumer
+    // (sequence-number ring)
+    class LockFreeQueue
+    {
+    public:
+        explicit LockFreeQueue(size_t capacity); // capacity must be a power of two
+
+        bool push(const Functor& f);
+        bool pop(Functor& f);
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence { 0 };
+            Functor functor;
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        size_t m_mask = 0;
+        std::atomic<size_t> m_enqueuePos { 0 };
+        std::atomic<size_t> m_dequeuePos { 0 };
+    };
+
+    static constexpr size_t LOCK_FREE_QUEUE_CAPACITY = 4096;
+    static constexpr size_t MAX_LOCK_FREE_QUEUES = 4;
+
+    struct LockFreeEntry
+    {
+        std::atomic<std::thread::id> threadId;
+        std::unique_ptr<LockFreeQueue> queue;
+    };
+
+    LockFreeQueue* lockFreeQueue(const std::thread::id& th);
+
     std::recursive_mutex m_mutex;
     std::map<std::thread::id, Queue > m_queues;
 
+    // messages for ring-registered threads that overflowed into m_queues;
+    // lets processEvents() skip the mutex map while the count is zero
+    std::atomic<size_t> m_overflowCount { 0 };
+
+    LockFreeEntry m_lockFreeQueues[MAX_LOCK_FREE_QUEUES];
+
     std::function<void(const std::function<void()>&, bool)> m_onMainThreadInvoke;
     std::thread::id m_mainThreadID;
 };
@@ -41,6 +41,13 @@ public:
         return m_ch.isConnected();
     }
 
+    //! NOTE cross-thread notifications are coalesced per receiver while a
+    //! queued one is still pending, see Channel::setBatchedMode
+    void setBatchedMode(bool batched)
+    {
+        m_ch.setBatchedMode(batched);
+    }
+
 private:
     Channel<> m_ch;
 };
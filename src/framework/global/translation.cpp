@@ -21,6 +21,9 @@
  */
 #include "translation.h"
 
+#include <mutex>
+#include <unordered_map>
+
 #ifndef NO_QT_SUPPORT
 #include <QCoreApplication>
 #endif
@@ -29,7 +32,10 @@
 
 using namespace mu;
 
-static String translate(const char* context, const char* key, const char* disambiguation, int n)
+static std::mutex s_cacheMutex;
+static std::unordered_map<std::string, String> s_cache;
+
+static String translateRaw(const char* context, const char* key, const char* disambiguation, int n)
 {
 #ifndef NO_QT_SUPPORT
     return String::fromQString(QCoreApplication::translate(context, key, disambiguation, n));
@@ -41,6 +47,46 @@ static String translate(const char* context, const char* key, const char* disamb
 #endif
 }
 
+static String translate(const char* context, const char* key, const char* disambiguation, int n)
+{
+    //! NOTE number-dependent (plural) translations aren't cached,
+    //! the number space is unbounded
+    if (n != -1) {
+        return translateRaw(context, key, disambiguation, n);
+    }
+
+    std::string cacheKey;
+    cacheKey.reserve(64);
+    cacheKey += context;
+    cacheKey += '\x1f';
+    cacheKey += key;
+    if (disambiguation) {
+        cacheKey += '\x1f';
+        cacheKey += disambiguation;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_cacheMutex);
+        auto it = s_cache.find(cacheKey);
+        if (it != s_cache.end()) {
+            return it->second;
+        }
+    }
+
+    String result = translateRaw(context, key, disambiguation, n);
+
+    std::lock_guard<std::mutex> lock(s_cacheMutex);
+    s_cache.emplace(std::move(cacheKey), result);
+
+    return result;
+}
+
+void mu::clearTranslationCache()
+{
+    std::lock_guard<std::mutex> lock(s_cacheMutex);
+    s_cache.clear();
+}
+
 std::string mu::trc(const char* context, const char* key, const char* disambiguation, int n)
 {
     return translate(context, key, disambiguation, n).toStdString();
@@ -49,20 +95,20 @@ std::string mu::trc(const char* context, const char* key, const char* disambigua
 #ifndef NO_QT_SUPPORT
 QString mu::qtrc(const char* context, const char* key, const char* disambiguation, int n)
 {
-    return QCoreApplication::translate(context, key, disambiguation, n);
+    return translate(context, key, disambiguation, n).toQString();
 }
 
 QString mu::qtrc(const char* context, const String& key, const char* disambiguation, int n)
 {
     ByteArray utf8 = key.toUtf8();
-    return QCoreApplication::translate(context, utf8.constChar(), disambiguation, n);
+    return translate(context, utf8.constChar(), disambiguation, n).toQString();
 }
 
 QString mu::qtrc(const char* context, const String& key, const String& disambiguation, int n)
 {
     ByteArray keyutf8 = key.toUtf8();
     ByteArray disutf8 = disambiguation.toUtf8();
-    return QCoreApplication::translate(context, keyutf8.constChar(), disutf8.empty() ? nullptr : disutf8.constChar(), n);
+    return translate(context, keyutf8.constChar(), disutf8.empty() ? nullptr : disutf8.constChar(), n).toQString();
 }
 
 #endif
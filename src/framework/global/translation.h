@@ -31,6 +31,11 @@
 namespace mu {
 std::string trc(const char* context, const char* key, const char* disambiguation = nullptr, int n = -1);
 
+//! NOTE translation results are interned on first lookup, since changing
+//! the language requires an app restart; must be called after
+//! (re)installing the translators so already cached results don't stick
+void clearTranslationCache();
+
 String mtrc(const char* context, const char* key, const char* disambiguation = nullptr, int n = -1);
 String mtrc(const char* context, const String& key, const char* disambiguation = nullptr, int n = -1);
 String mtrc(const char* context, const String& key, const String& disambiguation, int n = -1);
@@ -201,6 +201,10 @@ public:
 
     bool operator ==(const SharedHashMap& another) const noexcept
     {
+        if (m_dataPtr == another.m_dataPtr) {
+            return true;
+        }
+
         return *m_dataPtr == *another.m_dataPtr;
     }
 
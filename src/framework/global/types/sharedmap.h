@@ -206,6 +206,10 @@ public:
 
     bool operator ==(const SharedMap& another) const noexcept
     {
+        if (m_dataPtr == another.m_dataPtr) {
+            return true;
+        }
+
         return *m_dataPtr == *another.m_dataPtr;
     }
 
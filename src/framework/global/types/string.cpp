@@ -226,14 +226,28 @@ void UtfCodec::utf32to8(std::u32string_view src, std::string& dst)
 // String
 // ============================
 
+//! NOTE all empty strings share one representation, so default construction
+//! and clear() don't allocate; the permanent reference held here keeps the
+//! use count above 1, which makes detach() copy before any mutation
+static const std::shared_ptr<std::u16string>& sharedEmpty()
+{
+    static const std::shared_ptr<std::u16string> empty = std::make_shared<std::u16string>();
+    return empty;
+}
+
 String::String()
 {
-    m_data = std::make_shared<std::u16string>();
+    m_data = sharedEmpty();
 }
 
 String::String(const char16_t* str)
 {
-    m_data = std::make_shared<std::u16string>(str ? str : u"");
+    if (!str || !*str) {
+        m_data = sharedEmpty();
+        return;
+    }
+
+    m_data = std::make_shared<std::u16string>(str);
 #ifdef STRING_DEBUG_HACK
     updateDebugView();
 #endif
@@ -241,8 +255,20 @@ String::String(const char16_t* str)
 
 String::String(const Char& ch)
 {
-    m_data = std::make_shared<std::u16string>();
-    *m_data.get() += ch.unicode();
+    m_data = std::make_shared<std::u16string>(1, ch.unicode());
+#ifdef STRING_DEBUG_HACK
+    updateDebugView();
+#endif
+}
+
+String::String(std::u16string&& str)
+{
+    if (str.empty()) {
+        m_data = sharedEmpty();
+        return;
+    }
+
+    m_data = std::make_shared<std::u16string>(std::move(str));
 #ifdef STRING_DEBUG_HACK
     updateDebugView();
 #endif
@@ -251,7 +277,7 @@ String::String(const Char& ch)
 String::String(const Char* unicode, size_t size)
 {
     if (!unicode) {
-        m_data = std::make_shared<std::u16string>();
+        m_data = sharedEmpty();
         return;
     }
 
@@ -415,13 +441,15 @@ String& String::append(const String& s)
 
 String& String::prepend(Char ch)
 {
-    mutStr() = ch.unicode() + constStr();
+    Mutator h = mutStr();
+    h.s.insert(0, 1, ch.unicode());
     return *this;
 }
 
 String& String::prepend(const String& s)
 {
-    mutStr() = s.constStr() + constStr();
+    Mutator h = mutStr();
+    h.s.insert(0, s.constStr());
     return *this;
 }
 
@@ -541,7 +569,8 @@ String String::fromQString(const QString& str)
     const char16_t* u = reinterpret_cast<const char16_t*>(qu);
 
     String s;
-    s.mutStr() = std::u16string(u, u + str.size());
+    Mutator h = s.mutStr();
+    h.s.assign(u, str.size());
     return s;
 }
 
@@ -565,7 +594,10 @@ bool String::empty() const
 
 void String::clear()
 {
-    mutStr().clear();
+    m_data = sharedEmpty();
+#ifdef STRING_DEBUG_HACK
+    updateDebugView();
+#endif
 }
 
 Char String::at(size_t i) const
@@ -972,12 +1004,10 @@ String String::arg(const String& val1, const String& val2, const String& val3, c
 
 String String::mid(size_t pos, size_t count) const
 {
-    String s;
     if (pos > size()) {
-        return s;
+        return String();
     }
-    s.mutStr() = constStr().substr(pos, count);
-    return s;
+    return String(constStr().substr(pos, count));
 }
 
 String String::left(size_t n) const
@@ -1029,11 +1059,33 @@ String String::toXmlEscaped(char16_t c)
 
 String String::toXmlEscaped(const String& s)
 {
+    //! NOTE appends into one buffer instead of making a String per
+    //! character, this is on the score write path
     String escaped;
-    escaped.reserve(s.size());
-    for (size_t i = 0; i < s.size(); ++i) {
-        char16_t c = s.at(i).unicode();
-        escaped += toXmlEscaped(c);
+    Mutator h = escaped.mutStr();
+    std::u16string& out = h.s;
+    out.reserve(s.size());
+    for (char16_t c : s.constStr()) {
+        switch (c) {
+        case u'<':
+            out += u"&lt;";
+            break;
+        case u'>':
+            out += u"&gt;";
+            break;
+        case u'&':
+            out += u"&amp;";
+            break;
+        case u'\"':
+            out += u"&quot;";
+            break;
+        default:
+            // ignore invalid characters in xml 1.0
+            if (!(c < 0x0020 && c != 0x0009 && c != 0x000A && c != 0x000D)) {
+                out += c;
+            }
+            break;
+        }
     }
     return escaped;
 }
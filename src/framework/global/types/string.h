@@ -197,6 +197,9 @@ public:
     String(const Char& ch);
     String(const Char* unicode, size_t size = mu::nidx);
 
+    //! NOTE adopts the buffer without copying it
+    explicit String(std::u16string&& str);
+
 #ifndef NO_QT_SUPPORT
     String(const QString& str) { *this = fromQString(str); }
     operator QString() const {
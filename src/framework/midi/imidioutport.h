@@ -50,6 +50,21 @@ public:
     virtual bool supportsMIDI20Output() const = 0;
 
     virtual Ret sendEvent(const Event& e) = 0;
+
+    //! NOTE ports with native batch submission (the ALSA sequencer output buffer,
+    //! CoreMIDI packet lists) override this to hand the whole batch to the OS at
+    //! once; the default just sends the events one by one
+    virtual Ret sendEvents(const std::vector<Event>& events)
+    {
+        for (const Event& e : events) {
+            Ret ret = sendEvent(e);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return Ret(true);
+    }
 };
 }
 
@@ -223,26 +223,8 @@ bool AlsaMidiOutPort::supportsMIDI20Output() const
     return false;
 }
 
-mu::Ret AlsaMidiOutPort::sendEvent(const Event& e)
+static bool fillSeqEvent(snd_seq_event_t& seqev, const Event& e)
 {
-    // LOGI() << e.to_string();
-
-    if (!isConnected()) {
-        return make_ret(Err::MidiNotConnected);
-    }
-
-    if (e.isChannelVoice20()) {
-        auto events = e.toMIDI10();
-        for (auto& event : events) {
-            mu::Ret ret = sendEvent(event);
-            if (!ret) {
-                return ret;
-            }
-        }
-        return Ret(true);
-    }
-
-    snd_seq_event_t seqev;
     memset(&seqev, 0, sizeof(seqev));
     snd_seq_ev_set_direct(&seqev);
     snd_seq_ev_set_source(&seqev, 0);
@@ -266,6 +248,33 @@ mu::Ret AlsaMidiOutPort::sendEvent(const Event& e)
         break;
     default:
         NOT_SUPPORTED << "event: " << e.to_string();
+        return false;
+    }
+
+    return true;
+}
+
+mu::Ret AlsaMidiOutPort::sendEvent(const Event& e)
+{
+    // LOGI() << e.to_string();
+
+    if (!isConnected()) {
+        return make_ret(Err::MidiNotConnected);
+    }
+
+    if (e.isChannelVoice20()) {
+        auto events = e.toMIDI10();
+        for (auto& event : events) {
+            mu::Ret ret = sendEvent(event);
+            if (!ret) {
+                return ret;
+            }
+        }
+        return Ret(true);
+    }
+
+    snd_seq_event_t seqev;
+    if (!fillSeqEvent(seqev, e)) {
         return make_ret(Err::MidiNotSupported);
     }
 
@@ -274,6 +283,43 @@ mu::Ret AlsaMidiOutPort::sendEvent(const Event& e)
     return Ret(true);
 }
 
+mu::Ret AlsaMidiOutPort::sendEvents(const std::vector<Event>& events)
+{
+    if (!isConnected()) {
+        return make_ret(Err::MidiNotConnected);
+    }
+
+    //! NOTE the whole batch is queued in the sequencer's output buffer and
+    //! drained with a single write, instead of one direct write per event
+    bool queued = false;
+
+    auto queueEvent = [this, &queued](const Event& event) {
+        snd_seq_event_t seqev;
+        if (!fillSeqEvent(seqev, event)) {
+            return;
+        }
+
+        snd_seq_event_output(m_alsa->midiOut, &seqev);
+        queued = true;
+    };
+
+    for (const Event& e : events) {
+        if (e.isChannelVoice20()) {
+            for (const Event& event : e.toMIDI10()) {
+                queueEvent(event);
+            }
+        } else {
+            queueEvent(e);
+        }
+    }
+
+    if (queued) {
+        snd_seq_drain_output(m_alsa->midiOut);
+    }
+
+    return Ret(true);
+}
+
 bool AlsaMidiOutPort::deviceExists(const MidiDeviceID& deviceId) const
 {
     for (const MidiDevice& device : availableDevices()) {
@@ -50,6 +50,7 @@ public:
     bool supportsMIDI20Output() const override;
 
     Ret sendEvent(const Event& e) override;
+    Ret sendEvents(const std::vector<Event>& events) override;
 
 private:
     bool deviceExists(const MidiDeviceID& deviceId) const;
@@ -349,3 +349,82 @@ mu::Ret CoreMidiOutPort::sendEvent(const Event& e)
 
     return Ret(true);
 }
+
+mu::Ret CoreMidiOutPort::sendEvents(const std::vector<Event>& events)
+{
+    if (!isConnected()) {
+        return make_ret(Err::MidiNotConnected);
+    }
+
+    if (events.empty()) {
+        return Ret(true);
+    }
+
+    OSStatus result = noErr;
+    MIDITimeStamp timeStamp = AudioGetCurrentHostTime();
+
+    if (__builtin_available(macOS 11.0, *)) {
+        MIDIProtocolID protocolId = configuration()->useMIDI20Output() ? m_core->destinationProtocolId : kMIDIProtocol_1_0;
+
+        MIDIEventList eventList;
+        MIDIEventPacket* packet = MIDIEventListInit(&eventList, protocolId);
+
+        for (const Event& e : events) {
+            MIDIEventPacket* next = MIDIEventListAdd(&eventList, sizeof(eventList), packet, timeStamp, 4, e.rawData());
+
+            //! NOTE the list is full: send what fits and start a new one
+            if (!next) {
+                result = MIDISendEventList(m_core->outputPort, m_core->destinationId, &eventList);
+                if (result != noErr) {
+                    break;
+                }
+
+                packet = MIDIEventListInit(&eventList, protocolId);
+                next = MIDIEventListAdd(&eventList, sizeof(eventList), packet, timeStamp, 4, e.rawData());
+            }
+
+            packet = next;
+        }
+
+        if (result == noErr) {
+            result = MIDISendEventList(m_core->outputPort, m_core->destinationId, &eventList);
+        }
+    } else {
+        std::vector<Event> events10;
+        events10.reserve(events.size());
+
+        for (const Event& e : events) {
+            for (const Event& event : e.toMIDI10()) {
+                events10.push_back(event);
+            }
+        }
+
+        ByteCount listSize = ::packetListSize(events10);
+        if (listSize == 0) {
+            return make_ret(Err::MidiSendError, "midi 1.0 messages list was empty");
+        }
+
+        std::vector<Byte> buffer(listSize);
+        MIDIPacketList* packetList = reinterpret_cast<MIDIPacketList*>(buffer.data());
+        MIDIPacket* packet = MIDIPacketListInit(packetList);
+
+        for (const Event& event : events10) {
+            uint32_t msg = event.to_MIDI10Package();
+
+            if (!msg) {
+                return make_ret(Err::MidiSendError, "message wasn't converted");
+            }
+
+            packet = MIDIPacketListAdd(packetList, listSize, packet, timeStamp, sizeof(msg), reinterpret_cast<Byte*>(&msg));
+        }
+
+        result = MIDISend(m_core->outputPort, m_core->destinationId, packetList);
+    }
+
+    if (result != noErr) {
+        LOGE() << "midi send error: " << result;
+        return make_ret(Err::MidiSendError, "failed send message. Core error: " + std::to_string(result));
+    }
+
+    return Ret(true);
+}
@@ -53,6 +53,7 @@ public:
     bool supportsMIDI20Output() const override;
 
     Ret sendEvent(const Event& e) override;
+    Ret sendEvents(const std::vector<Event>& events) override;
 
 private:
     void initCore();
@@ -25,6 +25,7 @@
 
 #include <variant>
 #include <vector>
+#include <set>
 #include <optional>
 
 #include "async/channel.h"
@@ -151,6 +152,30 @@ private:
         return static_cast<T>(static_cast<float>(v) * f);
     }
 
+    //! NOTE scaling a curve detaches it from the pattern data it was shared with,
+    //! which used to leave every note event with its own copy of an often identical
+    //! curve, so equal curves are interned to keep a single instance of each in memory
+    template<typename T>
+    static void internCurve(ValuesCurve<T>& curve)
+    {
+        struct CurveContentLess {
+            bool operator()(const ValuesCurve<T>& f, const ValuesCurve<T>& s) const
+            {
+                return std::lexicographical_compare(f.cbegin(), f.cend(), s.cbegin(), s.cend());
+            }
+        };
+
+        static constexpr size_t MAX_INTERNED_CURVES_COUNT = 2048;
+
+        static thread_local std::set<ValuesCurve<T>, CurveContentLess> internedCurves;
+
+        if (internedCurves.size() >= MAX_INTERNED_CURVES_COUNT) {
+            internedCurves.clear();
+        }
+
+        curve = *internedCurves.insert(curve).first;
+    }
+
     void setUp(const float requiredVelocityFraction)
     {
         calculateActualDuration(m_expressionCtx.articulations);
@@ -203,6 +228,8 @@ private:
         for (auto& pair : m_pitchCtx.pitchCurve) {
             pair.second = static_cast<pitch_level_t>(RealRound(static_cast<float>(pair.second) * ratio * patternUnitRatio, 0));
         }
+
+        internCurve(m_pitchCtx.pitchCurve);
     }
 
     void calculateExpressionCurve(const ArticulationMap& articulationsApplied, const float requiredVelocityFraction)
@@ -236,6 +263,8 @@ private:
         if (!RealIsNull(requiredVelocityFraction)) {
             m_expressionCtx.expressionCurve.amplifyVelocity(requiredVelocityFraction);
         }
+
+        internCurve(m_expressionCtx.expressionCurve);
     }
 
     ArrangementContext m_arrangementCtx;
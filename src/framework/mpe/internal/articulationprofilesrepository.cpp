@@ -118,7 +118,7 @@ ArticulationsProfilePtr ArticulationProfilesRepository::loadProfile(const io::pa
 
     for (const QString& key : articulationPatterns.keys()) {
         result->setPattern(articulationTypeFromString(key),
-                           patternsScopeFromJson(articulationPatterns.value(key).toArray()));
+                           internPattern(patternsScopeFromJson(articulationPatterns.value(key).toArray())));
     }
 
     return result;
@@ -278,6 +278,18 @@ QJsonObject ArticulationProfilesRepository::pitchPatternToJson(const PitchPatter
     return result;
 }
 
+const ArticulationPattern& ArticulationProfilesRepository::internPattern(ArticulationPattern&& pattern) const
+{
+    for (const ArticulationPattern& pooled : m_patternPool) {
+        if (pooled == pattern) {
+            return pooled;
+        }
+    }
+
+    m_patternPool.push_back(std::move(pattern));
+    return m_patternPool.back();
+}
+
 ExpressionPattern ArticulationProfilesRepository::expressionPatternFromJson(const QJsonObject& obj) const
 {
     ExpressionPattern result;
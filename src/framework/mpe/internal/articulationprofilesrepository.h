@@ -59,8 +59,15 @@ private:
     ExpressionPattern expressionPatternFromJson(const QJsonObject& obj) const;
     QJsonObject expressionPatternToJson(const ExpressionPattern& pattern) const;
 
+    const ArticulationPattern& internPattern(ArticulationPattern&& pattern) const;
+
     mutable std::unordered_map<ArticulationFamily, ArticulationsProfilePtr> m_defaultProfiles;
 
+    //! NOTE The family profiles repeat many identical patterns, so loaded patterns are
+    //! deduplicated against this pool and share their data (SharedMap is copy-on-write,
+    //! customizing a pattern detaches it from the pool automatically)
+    mutable std::vector<ArticulationPattern> m_patternPool;
+
     async::Channel<io::path_t> m_profileChanged;
 };
 }
@@ -229,6 +229,14 @@ void MuseSamplerWrapper::setupEvents(const mpe::PlaybackData& playbackData)
     ONLY_AUDIO_WORKER_THREAD;
 
     m_sequencer.load(playbackData);
+
+    //! NOTE the whole score is in the library at this point, so anchor it at the
+    //! current position right away - the position is what it streams samples from
+    //! disk ahead of, and waiting for the first seek wastes the idle time between
+    //! loading a score and pressing play
+    if (m_samplerLib && m_sampler && m_track) {
+        setCurrentPosition(m_currentPosition);
+    }
 }
 
 void MuseSamplerWrapper::updateRenderingMode(const audio::RenderMode mode)
@@ -68,6 +68,7 @@ mu::Ret MidiRemote::setMidiMappings(const MidiMappingList& midiMappings)
 
     if (ok) {
         m_midiMappings = midiMappings;
+        rebuildEventLookup();
         m_midiMappingsChanged.notify();
     }
 
@@ -80,6 +81,7 @@ void MidiRemote::resetMidiMappings()
     fileSystem()->remove(configuration()->midiMappingUserAppDataPath());
 
     m_midiMappings = {};
+    rebuildEventLookup();
     m_midiMappingsChanged.notify();
 }
 
@@ -112,11 +114,10 @@ mu::Ret MidiRemote::process(const Event& ev)
 
     RemoteEvent event = remoteEventFromMidiEvent(ev);
 
-    for (const MidiControlsMapping& midiMapping : m_midiMappings) {
-        if (midiMapping.event == event) {
-            dispatcher()->dispatch(midiMapping.action);
-            return make_ret(Ret::Code::Ok);
-        }
+    auto it = m_actionsByEvent.find(eventKey(event));
+    if (it != m_actionsByEvent.end()) {
+        dispatcher()->dispatch(it->second);
+        return make_ret(Ret::Code::Ok);
     }
 
     return Ret(Ret::Code::Undefined);
@@ -149,6 +150,26 @@ void MidiRemote::readMidiMappings()
     if (!reader.success()) {
         LOGE() << "failed parse xml, error: " << reader.error();
     }
+
+    rebuildEventLookup();
+}
+
+void MidiRemote::rebuildEventLookup()
+{
+    m_actionsByEvent.clear();
+
+    for (const MidiControlsMapping& midiMapping : m_midiMappings) {
+        if (midiMapping.isValid()) {
+            //! NOTE insert keeps the first mapping for an event,
+            //! same as the previous first-match scan
+            m_actionsByEvent.insert({ eventKey(midiMapping.event), midiMapping.action });
+        }
+    }
+}
+
+int MidiRemote::eventKey(const RemoteEvent& event)
+{
+    return (static_cast<int>(event.type) << 16) | (event.value & 0xFFFF);
 }
 
 MidiControlsMapping MidiRemote::readMidiMapping(XmlReader& reader) const
@@ -22,6 +22,8 @@
 #ifndef MU_SHORTCUTS_MIDIREMOTE_H
 #define MU_SHORTCUTS_MIDIREMOTE_H
 
+#include <unordered_map>
+
 #include "async/asyncable.h"
 
 #include "modularity/ioc.h"
@@ -76,9 +78,18 @@ private:
 
     RemoteEvent remoteEvent(const std::string& action) const;
 
+    void rebuildEventLookup();
+    static int eventKey(const RemoteEvent& event);
+
     bool m_isSettingMode = false;
 
     MidiMappingList m_midiMappings;
+
+    //! NOTE packed (type, value) -> action lookup, rebuilt whenever the
+    //! mapping list changes, so live MIDI events match in O(1) instead of
+    //! scanning the mapping list per event
+    std::unordered_map<int, std::string> m_actionsByEvent;
+
     async::Notification m_midiMappingsChanged;
 };
 }
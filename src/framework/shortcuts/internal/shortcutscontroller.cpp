@@ -43,7 +43,12 @@ void ShortcutsController::activate(const std::string& sequence)
     ActionCode actionCode = resolveAction(sequence);
 
     if (!actionCode.empty()) {
-        dispatcher()->dispatch(actionCode);
+        auto it = m_actionHandles.find(actionCode);
+        if (it == m_actionHandles.end()) {
+            it = m_actionHandles.insert({ actionCode, ActionHandle(actionCode) }).first;
+        }
+
+        dispatcher()->dispatch(it->second);
     }
 }
 
@@ -22,6 +22,8 @@
 #ifndef MU_SHORTCUTS_SHORTCUTSCONTROLLER_H
 #define MU_SHORTCUTS_SHORTCUTSCONTROLLER_H
 
+#include <unordered_map>
+
 #include "../ishortcutscontroller.h"
 #include "async/asyncable.h"
 #include "modularity/ioc.h"
@@ -50,6 +52,11 @@ public:
 
 private:
     actions::ActionCode resolveAction(const std::string& sequence) const;
+
+    //! NOTE shortcut activation is the hottest dispatch path (every note
+    //! input keystroke goes through it), so actions are dispatched through
+    //! cached precompiled handles
+    std::unordered_map<actions::ActionCode, actions::ActionHandle> m_actionHandles;
 };
 }
 
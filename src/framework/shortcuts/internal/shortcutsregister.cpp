@@ -100,10 +100,26 @@ void ShortcutsRegister::reload(bool onlyDef)
     if (ok) {
         expandStandardKeys(m_shortcuts);
         makeUnique(m_shortcuts);
+    }
+
+    rebuildSequenceLookup();
+
+    if (ok) {
         m_shortcutsChanged.notify();
     }
 }
 
+void ShortcutsRegister::rebuildSequenceLookup()
+{
+    m_shortcutsBySequence.clear();
+
+    for (const Shortcut& shortcut : m_shortcuts) {
+        for (const std::string& sequence : shortcut.sequences) {
+            m_shortcutsBySequence[sequence].push_back(shortcut);
+        }
+    }
+}
+
 void ShortcutsRegister::mergeShortcuts(ShortcutList& shortcuts, const ShortcutList& defaultShortcuts) const
 {
     TRACEFUNC;
@@ -306,6 +322,7 @@ mu::Ret ShortcutsRegister::setShortcuts(const ShortcutList& shortcuts)
         m_shortcuts = needToWrite;
         mergeShortcuts(m_shortcuts, m_defaultShortcuts);
         mergeAdditionalShortcuts(m_shortcuts);
+        rebuildSequenceLookup();
         m_shortcutsChanged.notify();
     }
 
@@ -367,6 +384,7 @@ mu::Ret ShortcutsRegister::setAdditionalShortcuts(const std::string& context, co
     m_additionalShortcutsHash[context] = shortcuts;
 
     mergeShortcuts(m_shortcuts, m_additionalShortcutsHash[context]);
+    rebuildSequenceLookup();
     m_shortcutsChanged.notify();
 
     return make_ok();
@@ -384,25 +402,13 @@ const Shortcut& ShortcutsRegister::defaultShortcut(const std::string& actionCode
 
 bool ShortcutsRegister::isRegistered(const std::string& sequence) const
 {
-    for (const Shortcut& sh : m_shortcuts) {
-        auto it = std::find(sh.sequences.cbegin(), sh.sequences.cend(), sequence);
-        if (it != sh.sequences.cend()) {
-            return true;
-        }
-    }
-    return false;
+    return m_shortcutsBySequence.find(sequence) != m_shortcutsBySequence.end();
 }
 
 ShortcutList ShortcutsRegister::shortcutsForSequence(const std::string& sequence) const
 {
-    ShortcutList list;
-    for (const Shortcut& sh : m_shortcuts) {
-        auto it = std::find(sh.sequences.cbegin(), sh.sequences.cend(), sequence);
-        if (it != sh.sequences.cend()) {
-            list.push_back(sh);
-        }
-    }
-    return list;
+    auto it = m_shortcutsBySequence.find(sequence);
+    return it != m_shortcutsBySequence.end() ? it->second : ShortcutList();
 }
 
 mu::Ret ShortcutsRegister::importFromFile(const io::path_t& filePath)
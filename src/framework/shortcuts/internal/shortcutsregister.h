@@ -22,6 +22,8 @@
 #ifndef MU_SHORTCUTS_SHORTCUTSREGISTER_H
 #define MU_SHORTCUTS_SHORTCUTSREGISTER_H
 
+#include <unordered_map>
+
 #include "../ishortcutsregister.h"
 #include "modularity/ioc.h"
 #include "ishortcutsconfiguration.h"
@@ -86,7 +88,14 @@ private:
 
     ShortcutList filterAndUpdateAdditionalShortcuts(const ShortcutList& shortcuts);
 
+    void rebuildSequenceLookup();
+
     ShortcutList m_shortcuts;
+
+    //! NOTE sequence -> shortcuts lookup, rebuilt whenever m_shortcuts
+    //! changes, so matching an incoming key sequence doesn't scan the
+    //! whole shortcut list on every keystroke
+    std::unordered_map<std::string, ShortcutList> m_shortcutsBySequence;
     ShortcutList m_defaultShortcuts;
     QHash<std::string, ShortcutList> m_additionalShortcutsHash;
     async::Notification m_shortcutsChanged;
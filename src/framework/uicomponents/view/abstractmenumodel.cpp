@@ -129,12 +129,58 @@ void AbstractMenuModel::setItems(const MenuItemList& items)
     TRACEFUNC;
 
     beginResetModel();
+
+    QSet<MenuItem*> aliveItems;
+    collectAliveItems(items, aliveItems);
+    collectToPool(m_items, aliveItems);
+
     m_items = items;
     endResetModel();
 
     emit itemsChanged();
 }
 
+MenuItem* AbstractMenuModel::takeOrCreateItem()
+{
+    if (!m_itemsPool.isEmpty()) {
+        return m_itemsPool.takeLast();
+    }
+
+    return new MenuItem(this);
+}
+
+void AbstractMenuModel::collectAliveItems(const MenuItemList& items, QSet<MenuItem*>& aliveItems)
+{
+    for (MenuItem* item : items) {
+        if (!item) {
+            continue;
+        }
+
+        aliveItems.insert(item);
+        collectAliveItems(item->subitems(), aliveItems);
+    }
+}
+
+void AbstractMenuModel::collectToPool(const MenuItemList& items, const QSet<MenuItem*>& aliveItems)
+{
+    for (MenuItem* item : items) {
+        if (!item || aliveItems.contains(item)) {
+            continue;
+        }
+
+        collectToPool(item->subitems(), aliveItems);
+
+        //! NOTE only items this model allocated (and so owns) can be
+        //! pooled; a subclass may insert items it manages itself
+        if (item->parent() != this || m_itemsPool.contains(item)) {
+            continue;
+        }
+
+        item->reset();
+        m_itemsPool << item;
+    }
+}
+
 void AbstractMenuModel::clear()
 {
     setItems(MenuItemList());
@@ -180,7 +226,7 @@ MenuItem& AbstractMenuModel::findMenu(const QString& menuId)
 MenuItem* AbstractMenuModel::makeMenu(const TranslatableString& title, const MenuItemList& items,
                                       const QString& menuId, bool enabled)
 {
-    MenuItem* item = new MenuItem(this);
+    MenuItem* item = takeOrCreateItem();
     item->setId(menuId);
     item->setSubitems(items);
 
@@ -203,7 +249,9 @@ MenuItem* AbstractMenuModel::makeMenuItem(const ActionCode& actionCode, const Tr
         return nullptr;
     }
 
-    MenuItem* item = new MenuItem(action, this);
+    MenuItem* item = takeOrCreateItem();
+    item->setId(QString::fromStdString(action.code));
+    item->setAction(action);
     item->setState(uiActionsRegister()->actionState(actionCode));
 
     if (!title.isEmpty()) {
@@ -215,7 +263,7 @@ MenuItem* AbstractMenuModel::makeMenuItem(const ActionCode& actionCode, const Tr
 
 MenuItem* AbstractMenuModel::makeSeparator()
 {
-    MenuItem* item = new MenuItem(this);
+    MenuItem* item = takeOrCreateItem();
 
     UiAction action;
     action.title = {};
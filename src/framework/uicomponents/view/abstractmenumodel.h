@@ -23,6 +23,7 @@
 #define MU_UICOMPONENTS_ABSTRACTMENUMODEL_H
 
 #include <QAbstractListModel>
+#include <QSet>
 
 #include "async/asyncable.h"
 #include "ui/uitypes.h"
@@ -101,7 +102,16 @@ private:
     MenuItem& item(MenuItemList& items, const actions::ActionCode& actionCode);
     MenuItem& menu(MenuItemList& items, const QString& menuId);
 
+    MenuItem* takeOrCreateItem();
+    void collectToPool(const MenuItemList& items, const QSet<MenuItem*>& aliveItems);
+    static void collectAliveItems(const MenuItemList& items, QSet<MenuItem*>& aliveItems);
+
     MenuItemList m_items;
+
+    //! NOTE items replaced by setItems are reset and kept here, so
+    //! reopening heavy menus and popups reuses the allocations instead of
+    //! creating every item from scratch
+    MenuItemList m_itemsPool;
 };
 }
 
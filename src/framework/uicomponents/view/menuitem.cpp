@@ -111,6 +111,22 @@ QString MenuItem::portableShortcuts() const
     return QString::fromStdString(mu::shortcuts::Shortcut::sequencesToString(m_action.shortcuts));
 }
 
+//! NOTE restores the default-constructed state so the item can be reused
+//! from the model's pool; intentionally doesn't emit change notifications -
+//! a pooled item isn't bound to any view
+void MenuItem::reset()
+{
+    m_id.clear();
+    m_section.clear();
+    m_state = UiActionState();
+    m_selectable = false;
+    m_selected = false;
+    m_role = MenuItemRole::NoRole;
+    m_args = actions::ActionData();
+    m_subitems.clear();
+    m_action = UiAction();
+}
+
 void MenuItem::setId(const QString& id)
 {
     if (m_id == id) {
@@ -99,6 +99,8 @@ public:
     QString shortcutsTitle() const;
     QString portableShortcuts() const;
 
+    void reset();
+
 public slots:
     void setId(const QString& id);
     void setTitle(const TranslatableString& title);
@@ -22,10 +22,14 @@
 
 #include "vstfxprocessor.h"
 
+#include <algorithm>
+
 using namespace mu;
 using namespace mu::vst;
 using namespace mu::audio;
 
+static constexpr audioch_t AUDIO_CHANNELS_COUNT = 2;
+
 VstFxProcessor::VstFxProcessor(VstPluginPtr&& pluginPtr, const AudioFxParams& params)
     : m_pluginPtr(pluginPtr),
     m_vstAudioClient(std::make_unique<VstAudioClient>()),
@@ -33,6 +37,19 @@ VstFxProcessor::VstFxProcessor(VstPluginPtr&& pluginPtr, const AudioFxParams& pa
 {
 }
 
+VstFxProcessor::~VstFxProcessor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_processMutex);
+        m_quitProcessing = true;
+    }
+    m_processCv.notify_all();
+
+    if (m_processThread.joinable()) {
+        m_processThread.join();
+    }
+}
+
 void VstFxProcessor::init()
 {
     m_vstAudioClient->init(VstPluginType::Fx, m_pluginPtr);
@@ -55,6 +72,10 @@ void VstFxProcessor::init()
         m_params.configuration = newConfig;
         m_paramsChanges.send(m_params);
     });
+
+    m_processThread = std::thread([this]() {
+        processingLoop();
+    });
 }
 
 AudioFxType VstFxProcessor::type() const
@@ -74,6 +95,13 @@ async::Channel<AudioFxParams> VstFxProcessor::paramsChanged() const
 
 void VstFxProcessor::setSampleRate(unsigned int sampleRate)
 {
+    //! NOTE the plugin is only ever touched from the processing thread once it is running,
+    //! so wait for the pipeline to drain before reconfiguring it from here
+    std::unique_lock<std::mutex> lock(m_processMutex);
+    m_processCv.wait(lock, [this]() {
+        return !m_hasPendingBlock && !m_workerBusy;
+    });
+
     m_vstAudioClient->setSampleRate(sampleRate);
 }
 
@@ -93,6 +121,66 @@ void VstFxProcessor::process(float* buffer, unsigned int sampleCount)
         return;
     }
 
-    m_vstAudioClient->setBlockSize(sampleCount);
-    m_vstAudioClient->process(buffer, sampleCount);
+    const size_t size = static_cast<size_t>(sampleCount) * AUDIO_CHANNELS_COUNT;
+
+    std::unique_lock<std::mutex> lock(m_processMutex);
+
+    //! NOTE the previous block had the whole buffer period to finish, so normally
+    //! this wait returns immediately; a slow plugin delays only its own pipeline
+    //! instead of stretching the mixer chain it is part of
+    m_processCv.wait(lock, [this]() {
+        return (!m_hasPendingBlock && !m_workerBusy) || m_quitProcessing;
+    });
+
+    if (m_quitProcessing) {
+        return;
+    }
+
+    m_pendingBuffer.assign(buffer, buffer + size);
+    m_pendingSampleCount = sampleCount;
+    m_hasPendingBlock = true;
+
+    //! NOTE return the result of the previous block - the pipeline runs the plugin
+    //! one buffer behind, which is the single block of latency this scheme costs
+    if (m_hasProcessedBlock && m_processedBuffer.size() == size) {
+        std::copy(m_processedBuffer.begin(), m_processedBuffer.end(), buffer);
+    } else {
+        std::fill(buffer, buffer + size, 0.f);
+    }
+
+    lock.unlock();
+    m_processCv.notify_all();
+}
+
+void VstFxProcessor::processingLoop()
+{
+    std::unique_lock<std::mutex> lock(m_processMutex);
+
+    while (!m_quitProcessing) {
+        m_processCv.wait(lock, [this]() {
+            return m_hasPendingBlock || m_quitProcessing;
+        });
+
+        if (m_quitProcessing) {
+            return;
+        }
+
+        m_workBuffer.swap(m_pendingBuffer);
+        unsigned int sampleCount = m_pendingSampleCount;
+        m_hasPendingBlock = false;
+        m_workerBusy = true;
+
+        lock.unlock();
+
+        m_vstAudioClient->setBlockSize(sampleCount);
+        m_vstAudioClient->process(m_workBuffer.data(), sampleCount);
+
+        lock.lock();
+
+        m_processedBuffer.swap(m_workBuffer);
+        m_hasProcessedBlock = true;
+        m_workerBusy = false;
+
+        m_processCv.notify_all();
+    }
 }
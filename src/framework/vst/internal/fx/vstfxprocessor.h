@@ -1,7 +1,11 @@
 #ifndef MU_VST_VSTFXPROCESSOR_H
 #define MU_VST_VSTFXPROCESSOR_H
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "audio/ifxprocessor.h"
@@ -15,6 +19,7 @@ class VstFxProcessor : public audio::IFxProcessor, public async::Asyncable
 {
 public:
     explicit VstFxProcessor(VstPluginPtr&& pluginPtr, const audio::AudioFxParams& params);
+    ~VstFxProcessor() override;
 
     void init();
 
@@ -27,6 +32,8 @@ public:
     void process(float* buffer, unsigned int sampleCount) override;
 
 private:
+    void processingLoop();
+
     bool m_inited = false;
 
     VstPluginPtr m_pluginPtr = nullptr;
@@ -34,6 +41,20 @@ private:
 
     audio::AudioFxParams m_params;
     async::Channel<audio::AudioFxParams> m_paramsChanges;
+
+    //! NOTE pipeline state shared with the dedicated plugin processing thread;
+    //! process() hands the current block over and returns the previous one
+    std::thread m_processThread;
+    std::mutex m_processMutex;
+    std::condition_variable m_processCv;
+    std::vector<float> m_pendingBuffer;
+    std::vector<float> m_workBuffer;
+    std::vector<float> m_processedBuffer;
+    unsigned int m_pendingSampleCount = 0;
+    bool m_hasPendingBlock = false;
+    bool m_hasProcessedBlock = false;
+    bool m_workerBusy = false;
+    bool m_quitProcessing = false;
 };
 
 using VstFxPtr = std::shared_ptr<VstFxProcessor>;
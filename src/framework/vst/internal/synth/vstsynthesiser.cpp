@@ -123,6 +123,17 @@ void VstSynthesiser::flushSound()
     revokePlayingNotes();
 }
 
+void VstSynthesiser::updateRenderingMode(const audio::RenderMode /*mode*/)
+{
+    if (!m_vstAudioClient) {
+        return;
+    }
+
+    //! NOTE make the render mode switch deterministic: whatever was ringing in the plugin
+    //! before the switch must not leak into the first rendered (or played back) buffers
+    flushSound();
+}
+
 void VstSynthesiser::setupSound(const mpe::PlaybackSetupData& /*setupData*/)
 {
     NOT_SUPPORTED;
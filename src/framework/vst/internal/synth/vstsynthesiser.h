@@ -70,6 +70,9 @@ public:
     async::Channel<unsigned int> audioChannelsCountChanged() const override;
     audio::samples_t process(float* buffer, audio::samples_t samplesPerChannel) override;
 
+protected:
+    void updateRenderingMode(const audio::RenderMode mode) override;
+
 private:
     Ret init();
     void toggleVolumeGain(const bool isActive);
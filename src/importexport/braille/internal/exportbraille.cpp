@@ -548,6 +548,10 @@ public:
     }
 
     bool write(QIODevice& device);
+    bool writeMeasures(QIODevice& device, int tickFrom, int tickTo);
+
+private:
+    bool writeMeasureRange(QIODevice& device, MeasureBase* first, int tickTo);
 };
 
 ExportBraille::ExportBraille(Score* score)
@@ -565,6 +569,11 @@ bool ExportBraille::write(QIODevice& device)
     return m_impl->write(device);
 }
 
+bool ExportBraille::writeMeasures(QIODevice& device, int tickFrom, int tickTo)
+{
+    return m_impl->writeMeasures(device, tickFrom, tickTo);
+}
+
 void ExportBrailleImpl::resetOctave(size_t stave)
 {
     previousNote[stave]  = nullptr;
@@ -627,6 +636,32 @@ bool ExportBrailleImpl::write(QIODevice& device)
 {
     credits(device);
     instruments(device);
+    return writeMeasureRange(device, score->measures()->first(), -1);
+}
+
+bool ExportBrailleImpl::writeMeasures(QIODevice& device, int tickFrom, int tickTo)
+{
+    MeasureBase* first = nullptr;
+    for (MeasureBase* mb = score->measures()->first(); mb != nullptr; mb = mb->next()) {
+        if (mb->isMeasure() && toMeasure(mb)->endTick().ticks() > tickFrom) {
+            first = mb;
+            break;
+        }
+    }
+
+    if (!first) {
+        return false;
+    }
+
+    // a braille line always re-marks the octave, so starting the range with
+    // fresh state produces the same cells a line break would
+    resetOctaves();
+
+    return writeMeasureRange(device, first, tickTo);
+}
+
+bool ExportBrailleImpl::writeMeasureRange(QIODevice& device, MeasureBase* first, int tickTo)
+{
     size_t nrStaves = score->staves().size();
     std::vector<QString> measureBraille(nrStaves);
     std::vector<QString> line(nrStaves + 1);
@@ -634,10 +669,13 @@ bool ExportBrailleImpl::write(QIODevice& device)
     int currentMeasureMaxLength = 0;
     bool measureAboveMax = false;
 
-    for (MeasureBase* mb = score->measures()->first(); mb != nullptr; mb = mb->next()) {
+    for (MeasureBase* mb = first; mb != nullptr; mb = mb->next()) {
         if (!mb->isMeasure()) {
             continue;
         }
+        if (tickTo >= 0 && mb->tick().ticks() > tickTo) {
+            break;
+        }
         currentMeasureMaxLength = 0;
         Measure* m = toMeasure(mb);
         // if we are at the beginning of the line
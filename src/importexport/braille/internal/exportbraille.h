@@ -38,6 +38,13 @@ public:
 
     bool write(QIODevice& destinationDevice);
 
+    //! NOTE transcribes only the measures intersecting the given tick range
+    //! (e.g. from a ScoreChangesRange), without the credits/instruments
+    //! preamble. The range starts as a fresh braille line, so octave marks
+    //! are emitted as they would be after any line break; this is what lets
+    //! a live braille view re-transcribe just the edited measures.
+    bool writeMeasures(QIODevice& destinationDevice, int tickFrom, int tickTo);
+
 private:
     ExportBrailleImpl* m_impl = nullptr;
 };
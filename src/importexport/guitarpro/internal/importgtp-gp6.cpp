@@ -372,12 +372,19 @@ XmlDomNode GuitarPro6::getNode(const String& id, XmlDomNode currentDomNode)
 
 void GuitarPro6::readGpif(ByteArray* data)
 {
-    XmlDomDocument domDoc;
-    domDoc.setContent(*data);
-    XmlDomElement domElem = domDoc.rootElement();
-
     auto builder = createGPDomBuilder();
-    builder->buildGPDomModel(&domElem);
+
+    {
+        // build the intermediate GP model, then drop the DOM before the
+        // conversion below starts allocating the engraving score: the parsed
+        // document keeps its own copy of the whole XML text, so on big files
+        // the peak would otherwise be raw text + DOM + score at once
+        XmlDomDocument domDoc;
+        domDoc.setContent(*data);
+        *data = ByteArray();     // parsing copied the text, the raw bytes are no longer needed
+        XmlDomElement domElem = domDoc.rootElement();
+        builder->buildGPDomModel(&domElem);
+    }
 
     GPConverter scoreBuilder(score, builder->getGPDomModel());
     scoreBuilder.convertGP();
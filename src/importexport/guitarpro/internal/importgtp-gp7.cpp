@@ -47,12 +47,17 @@ bool GuitarPro7::read(IODevice* io)
     previousTempo = -1;
 
     ZipReader zip(io);
+
+    {
+        ByteArray partsData = zip.fileData("Content/PartConfiguration");
+        m_properties = readProperties(&partsData);
+    }
+
+    // extract the score XML last so it is the only entry still buffered
+    // when parsing starts
     ByteArray fileData = zip.fileData("Content/score.gpif");
-    ByteArray partsData = zip.fileData("Content/PartConfiguration");
     zip.close();
 
-    m_properties = readProperties(&partsData);
-
     readGpif(&fileData);
     return true;
 }
@@ -23,6 +23,7 @@
 #include <QTextStream>
 #include <QBuffer>
 #include <QFile>
+#include <QHash>
 #include <QTextCodec>
 #include <QPainterPath>
 #include <QMimeType>
@@ -173,9 +174,18 @@ public:
     QTextStream* stream;
     int resolution;
 
-    QString header;
 //    QString defs; // NEEDED FOR GRADIENTS
-    QString body;
+
+    // Shared paths: the first occurrence of a path is written with an id,
+    // identical repetitions (noteheads, clefs, accidentals, staff lines...)
+    // become <use> references to it
+    struct PathDef {
+        int id = 0;
+        qreal dx = 0.0;
+        qreal dy = 0.0;
+    };
+    QHash<QString, PathDef> pathDefs;
+    int pathDefCount = 0;
 
     QBrush brush;
     QPen pen;
@@ -231,6 +241,10 @@ private:
     qreal _dx { 0.0 };
     qreal _dy { 0.0 };
 
+// True when stateString carries a full transform="matrix()"; such paths are
+// never shared, a <use> clone would apply the matrix a second time
+    bool _hasMatrix { false };
+
 protected:
 // The mu::engraving::EngravingItem being generated right now
     const mu::engraving::EngravingItem* _element = NULL;
@@ -271,6 +285,11 @@ protected:
 
 #define SVG_CLASS    " class=\""
 
+#define SVG_USE         "<use"
+#define SVG_ID          " id=\"p"
+#define SVG_XLINK_HREF  " xlink:href=\"#p"
+#define SVG_TRANSLATE   " transform=\"translate("
+
 #define SVG_ELEMENT_END  "/>"
 #define SVG_RPAREN_QUOTE ")\""
 
@@ -1034,8 +1053,15 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         return false;
     }
 
+    // Stream directly to the output device: the document is written out
+    // incrementally instead of being accumulated in one in-memory string
+    d->stream = new QTextStream(d->outputDevice);
+
+#ifndef QT_NO_TEXTCODEC
+    d->stream->setCodec(QTextCodec::codecForName("UTF-8"));
+#endif
+
     // Stream the headers
-    d->stream = new QTextStream(&d->header);
     stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << Qt::endl << SVG_BEGIN;
     if (d->viewBox.isValid()) {
         // viewBox has floating point values, size width/height is integer
@@ -1057,12 +1083,6 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << Qt::endl;
     }
 
-// <defs> is currently empty. It's necessary for gradients.
-//    d->stream->setString(&d->defs);
-//    *d->stream << "<defs>\n";
-
-    // Point the stream at the body string, for other functions to populate
-    d->stream->setString(&d->body);
     return true;
 }
 
@@ -1070,23 +1090,9 @@ bool SvgPaintEngine::end()
 {
     Q_D(SvgPaintEngine);
 
-// <defs> is currently empty
-//    d->stream->setString(&d->defs);
-//    stream() << "</defs>\n";
-
-    // Point the stream at the real output device (the .svg file)
-    d->stream->setDevice(d->outputDevice);
-
-#ifndef QT_NO_TEXTCODEC
-    d->stream->setCodec(QTextCodec::codecForName("UTF-8"));
-#endif
-
-    // Stream our strings out to the device, in order
-    stream() << d->header;
-//    stream() << d->defs;
-    stream() << d->body;
     stream() << SVG_END << Qt::endl;
 
+    d->stream->flush();
     delete d->stream;
     return true;
 }
@@ -1188,10 +1194,12 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
         // No transformation except translation
         _dx = t.m31();
         _dy = t.m32();
+        _hasMatrix = false;
     } else {
         // Other transformations are more straightforward with a full matrix
         _dx = 0;
         _dy = 0;
+        _hasMatrix = true;
         stateStream << SVG_MATRIX << t.m11() << SVG_COMMA
                     << t.m12() << SVG_COMMA
                     << t.m21() << SVG_COMMA
@@ -1203,35 +1211,29 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
 
 void SvgPaintEngine::drawPath(const QPainterPath& p)
 {
-    stream() << SVG_PATH << stateString;
-
-    // fill-rule is here because UpdateState() doesn't have a QPainterPath arg
-    // Majority of <path>s use the default value: fill-rule="nonzero"
-    if (p.fillRule() == Qt::OddEvenFill) {
-        stream() << SVG_FILL_RULE;
-    }
+    Q_D(SvgPaintEngine);
 
-    // Path data
-    stream() << SVG_D;
+    // Path data in element-local coordinates: the translation stays in
+    // _dx/_dy, so repeated glyphs produce identical data and can be shared
+    QString pathData;
+    QTextStream pathStream(&pathData);
     for (int i = 0; i < p.elementCount(); ++i) {
         const QPainterPath::Element& e = p.elementAt(i);
-        qreal x = e.x + _dx;
-        qreal y = e.y + _dy;
         switch (e.type) {
         case QPainterPath::MoveToElement:
-            stream() << SVG_MOVE << x << SVG_COMMA << y;
+            pathStream << SVG_MOVE << e.x << SVG_COMMA << e.y;
             break;
         case QPainterPath::LineToElement:
-            stream() << SVG_LINE << x << SVG_COMMA << y;
+            pathStream << SVG_LINE << e.x << SVG_COMMA << e.y;
             break;
         case QPainterPath::CurveToElement:
-            stream() << SVG_CURVE << x << SVG_COMMA << y;
+            pathStream << SVG_CURVE << e.x << SVG_COMMA << e.y;
             ++i;
             while (i < p.elementCount()) {
                 const QPainterPath::Element& ee = p.elementAt(i);
                 if (ee.type == QPainterPath::CurveToDataElement) {
-                    stream() << SVG_SPACE << ee.x + _dx
-                             << SVG_COMMA << ee.y + _dy;
+                    pathStream << SVG_SPACE << ee.x
+                               << SVG_COMMA << ee.y;
                     ++i;
                 } else {
                     --i;
@@ -1243,10 +1245,59 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
             break;
         }
         if (i <= p.elementCount() - 1) {
-            stream() << SVG_SPACE;
+            pathStream << SVG_SPACE;
         }
     }
-    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+
+    if (!_hasMatrix) {
+        // The attributes are part of the key: a <use> clones the referenced
+        // path with its attributes, so only fully identical paths are shared
+        const QChar rule = QLatin1Char(p.fillRule() == Qt::OddEvenFill ? 'e' : 'n');
+        const QString key = stateString + QLatin1Char('|') + rule + pathData;
+
+        auto it = d->pathDefs.constFind(key);
+        if (it != d->pathDefs.constEnd()) {
+            // An identical path is already in the document: reference it.
+            // The class and paint attributes are repeated on the <use> so
+            // that class-based tooling still sees every instance.
+            stream() << SVG_USE << stateString
+                     << SVG_XLINK_HREF << it->id << SVG_QUOTE
+                     << SVG_X << SVG_QUOTE << _dx - it->dx << SVG_QUOTE
+                     << SVG_Y << SVG_QUOTE << _dy - it->dy << SVG_QUOTE
+                     << SVG_ELEMENT_END << Qt::endl;
+            return;
+        }
+
+        SvgPaintEnginePrivate::PathDef def;
+        def.id = ++d->pathDefCount;
+        def.dx = _dx;
+        def.dy = _dy;
+        d->pathDefs.insert(key, def);
+
+        stream() << SVG_PATH << SVG_ID << def.id << SVG_QUOTE << stateString;
+
+        // fill-rule is here because UpdateState() doesn't have a QPainterPath arg
+        // Majority of <path>s use the default value: fill-rule="nonzero"
+        if (p.fillRule() == Qt::OddEvenFill) {
+            stream() << SVG_FILL_RULE;
+        }
+
+        if (_dx != 0 || _dy != 0) {
+            stream() << SVG_TRANSLATE << _dx << SVG_COMMA << _dy << SVG_RPAREN_QUOTE;
+        }
+
+        stream() << SVG_D << pathData << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+        return;
+    }
+
+    // Full-matrix case: _dx/_dy are zero, the matrix is in stateString
+    stream() << SVG_PATH << stateString;
+
+    if (p.fillRule() == Qt::OddEvenFill) {
+        stream() << SVG_FILL_RULE;
+    }
+
+    stream() << SVG_D << pathData << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
 }
 
 void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
@@ -154,10 +154,10 @@ void MidiFile::writeEvent(const MidiEvent& event)
         // Don't null terminate text meta events
         if (event.metaType() >= 0x1 && event.metaType() <= 0x14) {
             putvl(event.len() - 1);
-            write(event.edata(), event.len() - 1);
+            putData(event.edata(), event.len() - 1);
         } else {
             putvl(event.len());
-            write(event.edata(), event.len());
+            putData(event.edata(), event.len());
         }
         resetRunningStatus();               // really ?!
         break;
@@ -165,7 +165,7 @@ void MidiFile::writeEvent(const MidiEvent& event)
     case ME_SYSEX:
         put(ME_SYSEX);
         putvl(event.len() + 1);            // including 0xf7
-        write(event.edata(), event.len());
+        putData(event.edata(), event.len());
         put(ME_ENDSYSEX);
         resetRunningStatus();
         break;
@@ -178,9 +178,12 @@ void MidiFile::writeEvent(const MidiEvent& event)
 
 bool MidiFile::writeTrack(const MidiTrack& t)
 {
-    write("MTrk", 4);
-    qint64 lenpos = fp->pos();
-    writeLong(0);                   // dummy len
+    // assemble the whole track body in memory: the events are tiny, so
+    // writing them to the device one byte at a time dominated export time,
+    // and buffering also makes the length known up front - no seeking back
+    // to patch the header afterwards
+    _trackData.clear();
+    _trackData.reserve(trackDataUpperBound(t));
 
     status   = -1;
     int tick = 0;
@@ -206,11 +209,34 @@ bool MidiFile::writeTrack(const MidiTrack& t)
     put(0xff);          // Meta
     put(0x2f);          // EOT
     putvl(0);           // len 0
-    qint64 endpos = fp->pos();
-    fp->seek(lenpos);
-    writeLong(endpos - lenpos - 4); // tracklen
-    fp->seek(endpos);
-    return false;
+
+    if (write("MTrk", 4)) {
+        return true;
+    }
+    writeLong(static_cast<int>(_trackData.size()));
+    return write(_trackData.data(), qint64(_trackData.size()));
+}
+
+//---------------------------------------------------------
+//   trackDataUpperBound
+//    upper bound of the encoded track body size, computed
+//    from the event list so the buffer is sized once
+//---------------------------------------------------------
+
+size_t MidiFile::trackDataUpperBound(const MidiTrack& t) const
+{
+    // per event: up to 5 bytes of tick delta vlq, status byte and
+    // two data bytes; meta/sysex events additionally carry their
+    // payload plus a length vlq and terminator
+    size_t size = 8;    // end-of-track meta
+    for (const auto& i : t.events()) {
+        size += 8;
+        const MidiEvent& ev = i.second;
+        if (ev.type() == ME_META || ev.type() == ME_SYSEX) {
+            size += static_cast<size_t>(ev.len()) + 6;
+        }
+    }
+    return size;
 }
 
 //---------------------------------------------------------
@@ -89,7 +89,10 @@ class MidiFile
     int click;                   ///< current tick position in file
     qint64 curPos;               ///< current file byte position
 
+    std::vector<unsigned char> _trackData;    ///< track body being assembled by writeTrack()
+
     void writeEvent(const MidiEvent& event);
+    size_t trackDataUpperBound(const MidiTrack& t) const;
 
 protected:
     // write
@@ -98,7 +101,8 @@ protected:
     void writeLong(int);
     bool writeTrack(const MidiTrack&);
     void putvl(unsigned);
-    void put(unsigned char c) { write(&c, 1); }
+    void put(unsigned char c) { _trackData.push_back(c); }
+    void putData(const unsigned char* p, int len) { _trackData.insert(_trackData.end(), p, p + len); }
     void writeStatus(int type, int channel);
 
     // read
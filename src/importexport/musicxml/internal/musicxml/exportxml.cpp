@@ -272,6 +272,8 @@ class SlurHandler
 {
     const Slur* slur[MAX_NUMBER_LEVEL];
     bool started[MAX_NUMBER_LEVEL];
+    std::multimap<const EngravingItem*, const Slur*> slursByChordRest;   // built on first doSlurs call
+    bool slursByChordRestValid = false;
     int findSlur(const Slur* s) const;
 
 public:
@@ -369,6 +371,8 @@ class ExportMusicXml
     TrillHash _trillStart;
     TrillHash _trillStop;
     MxmlInstrumentMap instrMap;
+    std::multimap<Fraction, Spanner*> _spannerStopsByTick;   // built on first spannerStops() call
+    bool _spannerStopsValid = false;
 
     int findBracket(const TextLineBase* tl) const;
     int findDashes(const TextLineBase* tl) const;
@@ -437,6 +441,7 @@ public:
     void tempoText(TempoText const* const text, staff_idx_t staff);
     void harmony(Harmony const* const, FretDiagram const* const fd, int offset = 0);
     Score* score() const { return _score; }
+    const std::multimap<Fraction, Spanner*>& spannerStops();
     double getTenthsFromInches(double) const;
     double getTenthsFromDots(double) const;
     Fraction tick() const { return _tick; }
@@ -806,28 +811,40 @@ static const ChordRest* findFirstChordRest(const Slur* s)
 
 void SlurHandler::doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml)
 {
-    // loop over all slurs twice, first to handle the stops, then the starts
-    for (int i = 0; i < 2; ++i) {
-        // search for slur(s) starting or stopping at this chord
+    // the spanners don't change during the export; collect the slurs per
+    // start/stop element once instead of rescanning every spanner in the
+    // score for every chord or rest written
+    if (!slursByChordRestValid) {
         for (const auto& it : chordRest->score()->spanner()) {
             auto sp = it.second;
             if (sp->generated() || sp->type() != ElementType::SLUR || !ExportMusicXml::canWrite(sp)) {
                 continue;
             }
-            if (chordRest == sp->startElement() || chordRest == sp->endElement()) {
-                const auto s = static_cast<const Slur*>(sp);
-                const auto firstChordRest = findFirstChordRest(s);
-                if (firstChordRest) {
-                    if (i == 0) {
-                        // first time: do slur stops
-                        if (firstChordRest != chordRest) {
-                            doSlurStop(s, notations, xml);
-                        }
-                    } else {
-                        // second time: do slur starts
-                        if (firstChordRest == chordRest) {
-                            doSlurStart(s, notations, xml);
-                        }
+            const auto s = static_cast<const Slur*>(sp);
+            slursByChordRest.insert({ sp->startElement(), s });
+            if (sp->endElement() != sp->startElement()) {
+                slursByChordRest.insert({ sp->endElement(), s });
+            }
+        }
+        slursByChordRestValid = true;
+    }
+
+    // loop over the slurs at this chord twice, first to handle the stops, then the starts
+    const auto range = slursByChordRest.equal_range(chordRest);
+    for (int i = 0; i < 2; ++i) {
+        for (auto it = range.first; it != range.second; ++it) {
+            const Slur* s = it->second;
+            const auto firstChordRest = findFirstChordRest(s);
+            if (firstChordRest) {
+                if (i == 0) {
+                    // first time: do slur stops
+                    if (firstChordRest != chordRest) {
+                        doSlurStop(s, notations, xml);
+                    }
+                } else {
+                    // second time: do slur starts
+                    if (firstChordRest == chordRest) {
+                        doSlurStart(s, notations, xml);
                     }
                 }
             }
@@ -5782,26 +5799,48 @@ static void spannerStart(ExportMusicXml* exp, track_idx_t strack, track_idx_t et
     }
 }
 
+//---------------------------------------------------------
+//  spannerStops
+//---------------------------------------------------------
+
+/**
+ The score's spanner map is keyed by start tick; index the spanners by
+ their end tick once, so the stop checks after every chord or rest don't
+ have to scan the whole map.
+ */
+
+const std::multimap<Fraction, Spanner*>& ExportMusicXml::spannerStops()
+{
+    if (!_spannerStopsValid) {
+        for (const auto& it : _score->spanner()) {
+            _spannerStopsByTick.insert({ it.second->tick2(), it.second });
+        }
+        _spannerStopsValid = true;
+    }
+    return _spannerStopsByTick;
+}
+
 //---------------------------------------------------------
 //  spannerStop
 //---------------------------------------------------------
 
 // called after writing each chord or rest to check if a spanner must be stopped
-// loop over all spanners and find spanners in strack ending at tick2
+// loop over the spanners ending at tick2 and find those in strack
 // note that more than one voice may contains notes ending at tick2,
 // remember which spanners have already been stopped (the "stopped" set)
 
 static void spannerStop(ExportMusicXml* exp, track_idx_t strack, track_idx_t etrack, const Fraction& tick2, staff_idx_t sstaff,
                         QSet<const Spanner*>& stopped)
 {
-    for (auto it : exp->score()->spanner()) {
-        Spanner* e = it.second;
+    const auto& stops = exp->spannerStops();
+    for (auto it = stops.lower_bound(tick2); it != stops.upper_bound(tick2); ++it) {
+        Spanner* e = it->second;
 
         if (!exp->canWrite(e)) {
             continue;
         }
 
-        if (e->tick2() != tick2 || e->track() < strack || e->track() >= etrack) {
+        if (e->track() < strack || e->track() >= etrack) {
             continue;
         }
 
@@ -230,14 +230,26 @@ static Err doValidate(const QString& name, QIODevice* dev)
 
 static Err doValidateAndImport(Score* score, const QString& name, QIODevice* dev)
 {
-    // validate the file
-    Err res = doValidate(name, dev);
-    if (res != Err::NoError) {
-        return res;
+    // the schema validator materializes an in-memory model of the whole
+    // document, which for big DAW exports costs many times the file size and
+    // dwarfs the actual (streaming) import; in converter mode its verdict is
+    // ignored anyway, and above a size cap the memory is not worth a nicer
+    // error dialog
+    constexpr qint64 maxValidationSize = 20 * 1024 * 1024;
+    const bool skipValidation = MScore::noGui || dev->size() > maxValidationSize;
+
+    if (!skipValidation) {
+        // validate the file
+        Err res = doValidate(name, dev);
+        if (res != Err::NoError) {
+            return res;
+        }
+    } else {
+        LOGD("importMusicXml() skipping validation of '%s'", qPrintable(name));
     }
 
     // actually do the import
-    res = importMusicXMLfromBuffer(score, name, dev);
+    Err res = importMusicXMLfromBuffer(score, name, dev);
     //LOGD("res %d", static_cast<int>(res));
     return res;
 }
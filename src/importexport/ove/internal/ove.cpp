@@ -137,60 +137,48 @@ bool MeasurePos::operator>=(const MeasurePos& mp) const
 
 PairElement::PairElement()
 {
-    m_start = new MeasurePos();
-    m_stop = new MeasurePos();
 }
 
 PairElement::~PairElement()
 {
-    delete m_start;
-    delete m_stop;
 }
 
 MeasurePos* PairElement::start() const
 {
-    return m_start;
+    return &m_start;
 }
 
 MeasurePos* PairElement::stop() const
 {
-    return m_stop;
+    return &m_stop;
 }
 
 PairEnds::PairEnds()
 {
-    m_leftLine = new LineElement();
-    m_rightLine = new LineElement();
-    m_leftShoulder = new OffsetElement();
-    m_rightShoulder = new OffsetElement();
 }
 
 PairEnds::~PairEnds()
 {
-    delete m_leftLine;
-    delete m_rightLine;
-    delete m_leftShoulder;
-    delete m_rightShoulder;
 }
 
 LineElement* PairEnds::getLeftLine() const
 {
-    return m_leftLine;
+    return &m_leftLine;
 }
 
 LineElement* PairEnds::getRightLine() const
 {
-    return m_rightLine;
+    return &m_rightLine;
 }
 
 OffsetElement* PairEnds::getLeftShoulder() const
 {
-    return m_leftShoulder;
+    return &m_leftShoulder;
 }
 
 OffsetElement* PairEnds::getRightShoulder() const
 {
-    return m_rightShoulder;
+    return &m_rightShoulder;
 }
 
 LineElement::LineElement()
@@ -2439,12 +2427,10 @@ Tuplet::Tuplet()
     : m_tuplet(3), m_space(2), m_height(0), m_noteType(NoteType::Note_Quarter)
 {
     m_musicDataType = MusicDataType::Tuplet;
-    m_mark = new OffsetElement();
 }
 
 Tuplet::~Tuplet()
 {
-    delete m_mark;
 }
 
 void Tuplet::setTuplet(int tuplet)
@@ -2469,7 +2455,7 @@ int Tuplet::getSpace() const
 
 OffsetElement* Tuplet::getMarkHandle() const
 {
-    return m_mark;
+    return &m_mark;
 }
 
 void Tuplet::setHeight(int height)
@@ -2628,14 +2614,10 @@ Slur::Slur()
     m_showOnTop = true;
     m_noteTimePercent = 100;
 
-    m_handle_2 = new OffsetElement();
-    m_handle_3 = new OffsetElement();
 }
 
 Slur::~Slur()
 {
-    delete m_handle_2;
-    delete m_handle_3;
 }
 
 void Slur::setContainerCount(int count)
@@ -2660,12 +2642,12 @@ bool Slur::getShowOnTop() const
 
 OffsetElement* Slur::getHandle2() const
 {
-    return m_handle_2;
+    return &m_handle_2;
 }
 
 OffsetElement* Slur::getHandle3() const
 {
-    return m_handle_3;
+    return &m_handle_3;
 }
 
 void Slur::setNoteTimePercent(int percent)
@@ -2791,13 +2773,10 @@ Pedal::Pedal()
     m_half = false;
     m_playback = false;
     m_playOffset = 0;
-
-    m_pedalHandle = new OffsetElement();
 }
 
 Pedal::~Pedal()
 {
-    delete m_pedalHandle;
 }
 
 void Pedal::setHalf(bool half)
@@ -2812,7 +2791,7 @@ bool Pedal::getHalf() const
 
 OffsetElement* Pedal::getPedalHandle() const
 {
-    return m_pedalHandle;
+    return &m_pedalHandle;
 }
 
 void Pedal::setIsPlayback(bool playback)
@@ -3520,17 +3499,15 @@ NumericEnding::NumericEnding()
 
     m_height = 0;
     m_text = QString();
-    m_numericHandle = new OffsetElement();
 }
 
 NumericEnding::~NumericEnding()
 {
-    delete m_numericHandle;
 }
 
 OffsetElement* NumericEnding::getNumericHandle() const
 {
-    return m_numericHandle;
+    return &m_numericHandle;
 }
 
 void NumericEnding::setHeight(int height)
@@ -3731,9 +3708,7 @@ int MidiPitchWheel::getValue() const
 
 Measure::Measure(int index)
 {
-    m_barNumber = new BarNumber();
-    m_barNumber->setIndex(index);
-    m_time = new TimeSignature();
+    m_barNumber.setIndex(index);
 
     clear();
 }
@@ -3741,19 +3716,16 @@ Measure::Measure(int index)
 Measure::~Measure()
 {
     clear();
-
-    delete m_barNumber;
-    delete m_time;
 }
 
 BarNumber* Measure::getBarNumber() const
 {
-    return m_barNumber;
+    return &m_barNumber;
 }
 
 TimeSignature* Measure::getTime() const
 {
-    return m_time;
+    return &m_time;
 }
 
 void Measure::setLeftBarline(int barline)
@@ -3840,8 +3812,6 @@ void Measure::clear()
 
 MeasureData::MeasureData()
 {
-    m_key = new Key();
-    m_clef = new Clef();
 }
 
 MeasureData::~MeasureData()
@@ -3867,19 +3837,16 @@ MeasureData::~MeasureData()
         delete m_midiDatas[i];
     }
     m_midiDatas.clear();
-
-    delete m_key;
-    delete m_clef;
 }
 
 Key* MeasureData::getKey() const
 {
-    return m_key;
+    return &m_key;
 }
 
 Clef* MeasureData::getClef() const
 {
-    return m_clef;
+    return &m_clef;
 }
 
 void MeasureData::addNoteContainer(NoteContainer* ptr)
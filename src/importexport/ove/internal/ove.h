@@ -565,28 +565,10 @@ public:
     MeasurePos* stop() const;
 
 private:
-    MeasurePos* m_start;
-    MeasurePos* m_stop;
-};
-
-class PairEnds
-{
-public:
-    PairEnds();
-    virtual ~PairEnds();
-
-public:
-    LineElement* getLeftLine() const;
-    LineElement* getRightLine() const;
-
-    OffsetElement* getLeftShoulder() const;
-    OffsetElement* getRightShoulder() const;
-
-private:
-    LineElement* m_leftLine;
-    LineElement* m_rightLine;
-    OffsetElement* m_leftShoulder;
-    OffsetElement* m_rightShoulder;
+    // every MusicData carries a pair, so the two positions are kept
+    // inline instead of individually heap allocated
+    mutable MeasurePos m_start;
+    mutable MeasurePos m_stop;
 };
 
 class LineElement
@@ -621,6 +603,27 @@ private:
     int m_yOffset;
 };
 
+// defined after LineElement and OffsetElement so its parts can live inline
+class PairEnds
+{
+public:
+    PairEnds();
+    virtual ~PairEnds();
+
+public:
+    LineElement* getLeftLine() const;
+    LineElement* getRightLine() const;
+
+    OffsetElement* getLeftShoulder() const;
+    OffsetElement* getRightShoulder() const;
+
+private:
+    mutable LineElement m_leftLine;
+    mutable LineElement m_rightLine;
+    mutable OffsetElement m_leftShoulder;
+    mutable OffsetElement m_rightShoulder;
+};
+
 class LengthElement
 {
 public:
@@ -1482,7 +1485,7 @@ private:
     int m_space;
     int m_height;
     NoteType m_noteType;
-    OffsetElement* m_mark;
+    mutable OffsetElement m_mark;
 };
 
 class Harmony : public MusicData, public LengthElement
@@ -1578,8 +1581,8 @@ private:
     int m_containerCount;
     bool m_showOnTop;
     int m_noteTimePercent;
-    OffsetElement* m_handle_2;
-    OffsetElement* m_handle_3;
+    mutable OffsetElement m_handle_2;
+    mutable OffsetElement m_handle_3;
 };
 
 class Dynamics : public MusicData
@@ -1666,7 +1669,7 @@ private:
     bool m_half;
     bool m_playback;
     int m_playOffset;
-    OffsetElement* m_pedalHandle;
+    mutable OffsetElement m_pedalHandle;
 };
 
 class KuoHao : public MusicData, public PairEnds
@@ -2032,7 +2035,7 @@ public:
 private:
     int m_height;
     QString m_text;
-    OffsetElement* m_numericHandle;
+    mutable OffsetElement m_numericHandle;
 };
 
 class BarNumber : public MusicData
@@ -2168,8 +2171,8 @@ public:
 private:
     void clear();
 
-    BarNumber* m_barNumber;
-    TimeSignature* m_time;
+    mutable BarNumber m_barNumber;
+    mutable TimeSignature m_time;
 
     BarLineType m_leftBarline;
     BarLineType m_rightBarline;
@@ -2212,8 +2215,8 @@ public:
     QList<MidiData*> getMidiDatas(MidiType type);
 
 private:
-    Key* m_key;
-    Clef* m_clef;
+    mutable Key m_key;
+    mutable Clef m_clef;
     QList<MusicData*> m_musicDatas;
     QList<NoteContainer*> m_noteContainers;
     QList<QPair<MusicData*, bool> > m_crossMeasureElements;
@@ -158,19 +158,39 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     score->update();
 
     // Setup painting
-    QImage frame(config.width, config.height, QImage::Format_RGB32);
-    frame.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-    frame.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-
-    QPainter qp(&frame);
-    qp.setRenderHint(QPainter::Antialiasing, true);
-    qp.setRenderHint(QPainter::TextAntialiasing, true);
-    RectF frameRect = RectF::fromQRectF(QRectF(frame.rect()));
-
-    draw::Painter painter(&qp, "video_writer");
+    RectF frameRect(0, 0, config.width, config.height);
 
     auto painting = masterNotation->notation()->painting();
 
+    //! NOTE the score is laid out once, above, and the pages don't change
+    //! while the video is generated, so each page is rendered only when the
+    //! playhead first reaches it and cached; a frame is then the cached page
+    //! plus the cursor overlay instead of a full score repaint
+    std::vector<QImage> renderedPages;
+
+    auto renderPage = [&](int pageNo) -> const QImage& {
+        QImage& img = renderedPages[pageNo];
+        if (img.isNull()) {
+            img = QImage(config.width, config.height, QImage::Format_RGB32);
+            img.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+            img.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+
+            QPainter qp(&img);
+            qp.setRenderHint(QPainter::Antialiasing, true);
+            qp.setRenderHint(QPainter::TextAntialiasing, true);
+
+            draw::Painter painter(&qp, "video_writer");
+            painter.fillRect(frameRect, draw::Color::WHITE);
+
+            INotationPainting::Options opt;
+            opt.fromPage = pageNo;
+            opt.toPage = pageNo;
+            opt.deviceDpi = CANVAS_DPI;
+            painting->paintPrint(&painter, opt);
+        }
+        return img;
+    };
+
     // Setup duration
     INotationPlaybackPtr playback = masterNotation->playback();
     float totalPlayTimeSec = playback->totalPlayTime() / 1000.0;
@@ -180,6 +200,7 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     int frameCount = (totalPlayTimeSec + config.leadingSec + config.trailingSec) * config.fps;
 
     PageList pages = masterNotation->notation()->elements()->pages();
+    renderedPages.resize(pages.size());
 
     auto pageByTick = [](const PageList& pages, midi::tick_t tick) -> const Page* {
         for (const Page* p : pages) {
@@ -210,14 +231,7 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
             break;
         }
 
-        INotationPainting::Options opt;
-        opt.fromPage = page->no();
-        opt.toPage = opt.fromPage;
-        opt.deviceDpi = CANVAS_DPI;
-
-        painter.fillRect(frameRect, draw::Color::WHITE);
-
-        painting->paintPrint(&painter, opt);
+        QImage frame = renderPage(page->no()).copy();
 
         cursor.move(tick);
 
@@ -225,7 +239,15 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
         PointF pagePos = page->pos();
         RectF cursorAbsRect = cursorRect.translated(-pagePos);
 
-        painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        //! NOTE the cached page is in device pixels, the cursor rect is in
+        //! score units; map it with the same scale paintPrint rendered at
+        const double scale = CANVAS_DPI / engraving::DPI;
+        QRectF cursorDeviceRect(cursorAbsRect.x() * scale, cursorAbsRect.y() * scale,
+                                cursorAbsRect.width() * scale, cursorAbsRect.height() * scale);
+
+        QPainter qp(&frame);
+        qp.fillRect(cursorDeviceRect, CURSOR_COLOR.toQColor());
+        qp.end();
 
         encoder.encodeImage(frame);
     }
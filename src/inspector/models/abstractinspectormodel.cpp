@@ -21,6 +21,7 @@
  */
 #include "abstractinspectormodel.h"
 
+#include "libmscore/score.h"
 #include "types/texttypes.h"
 
 #include "log.h"
@@ -282,6 +283,16 @@ void AbstractInspectorModel::setPropertyValue(const QList<engraving::EngravingIt
 
     beginCommand();
 
+    //! NOTE Elements whose converted value and flags are equal are applied as
+    //! one bulk command; a big selection would otherwise record (and notify
+    //! about) one command per element
+    struct Batch {
+        PropertyValue value;
+        mu::engraving::PropertyFlags flags = mu::engraving::PropertyFlags::NOSTYLE;
+        std::vector<mu::engraving::EngravingObject*> elements;
+    };
+    std::vector<Batch> batches;
+
     for (mu::engraving::EngravingItem* item : items) {
         IF_ASSERT_FAILED(item) {
             continue;
@@ -294,7 +305,27 @@ void AbstractInspectorModel::setPropertyValue(const QList<engraving::EngravingIt
         }
 
         PropertyValue propValue = valueToElementUnits(pid, newValue, item);
-        item->undoChangeProperty(pid, propValue, ps);
+
+        Batch* batch = nullptr;
+        for (Batch& b : batches) {
+            if (b.flags == ps && b.value == propValue) {
+                batch = &b;
+                break;
+            }
+        }
+        if (!batch) {
+            batches.push_back(Batch { propValue, ps, {} });
+            batch = &batches.back();
+        }
+        batch->elements.push_back(item);
+    }
+
+    for (const Batch& batch : batches) {
+        if (batch.elements.size() == 1) {
+            batch.elements.front()->undoChangeProperty(pid, batch.value, batch.flags);
+        } else {
+            batch.elements.front()->score()->undoChangeProperties(batch.elements, pid, batch.value, batch.flags);
+        }
     }
 
     updateNotation();
@@ -303,6 +334,8 @@ void AbstractInspectorModel::setPropertyValue(const QList<engraving::EngravingIt
 
 void AbstractInspectorModel::updateProperties()
 {
+    m_styleIdByPidCache.clear();
+
     requestElements();
 
     emit isEmptyChanged();
@@ -321,6 +354,14 @@ void AbstractInspectorModel::requestElements()
 
 mu::engraving::Sid AbstractInspectorModel::styleIdByPropertyId(const mu::engraving::Pid pid) const
 {
+    //! NOTE called once per loaded property; when the property has no style
+    //! the lookup below scans the whole selection, so the result is cached
+    //! until the element list changes
+    auto it = m_styleIdByPidCache.find(int(pid));
+    if (it != m_styleIdByPidCache.cend()) {
+        return it.value();
+    }
+
     mu::engraving::Sid result = mu::engraving::Sid::NOSTYLE;
 
     for (const mu::engraving::EngravingItem* element : m_elementList) {
@@ -331,6 +372,8 @@ mu::engraving::Sid AbstractInspectorModel::styleIdByPropertyId(const mu::engravi
         }
     }
 
+    m_styleIdByPidCache.insert(int(pid), result);
+
     return result;
 }
 
@@ -554,7 +597,6 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem, const
         }
 
         QVariant elementCurrentValue = valueFromElementUnits(pid, element->getProperty(pid), element);
-        QVariant elementDefaultValue = valueFromElementUnits(pid, element->propertyDefault(pid), element);
 
         bool isPropertySupportedByElement = elementCurrentValue.isValid();
 
@@ -564,10 +606,19 @@ void AbstractInspectorModel::loadPropertyItem(PropertyItem* propertyItem, const
 
         if (convertElementPropertyValueFunc) {
             elementCurrentValue = convertElementPropertyValueFunc(elementCurrentValue);
-            elementDefaultValue = convertElementPropertyValueFunc(elementDefaultValue);
         }
 
         if (!(propertyValue.isValid() && defaultPropertyValue.isValid())) {
+            //! NOTE the default is only resolved while it is still unsettled
+            //! (normally just for the first element that supports the
+            //! property); propertyDefault() walks the style chain and is the
+            //! expensive half of this loop on a big selection
+            QVariant elementDefaultValue = valueFromElementUnits(pid, element->propertyDefault(pid), element);
+
+            if (convertElementPropertyValueFunc) {
+                elementDefaultValue = convertElementPropertyValueFunc(elementDefaultValue);
+            }
+
             propertyValue = elementCurrentValue;
             defaultPropertyValue = elementDefaultValue;
         }
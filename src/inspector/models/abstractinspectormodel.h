@@ -23,6 +23,7 @@
 #define MU_INSPECTOR_ABSTRACTINSPECTORMODEL_H
 
 #include <QList>
+#include <QHash>
 #include <functional>
 
 #include "async/asyncable.h"
@@ -213,6 +214,8 @@ protected slots:
 private:
     void setupCurrentNotationChangedConnection();
 
+    mutable QHash<int, mu::engraving::Sid> m_styleIdByPidCache;
+
     void initPropertyItem(PropertyItem* propertyItem, std::function<void(const mu::engraving::Pid propertyId,
                                                                          const QVariant& newValue)> onPropertyChangedCallBack = nullptr,
                           std::function<void(const mu::engraving::Sid styleId,
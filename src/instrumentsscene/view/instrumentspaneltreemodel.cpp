@@ -186,10 +186,50 @@ void InstrumentsPanelTreeModel::setupPartsConnections()
         updateRemovingAvailability();
     };
 
-    notationParts.onItemAdded(m_partsNotifyReceiver.get(), [updateMasterPartItem](const Part* part) {
+    notationParts.onItemAdded(m_partsNotifyReceiver.get(), [this, updateMasterPartItem](const Part* part) {
+        //! NOTE a part added outside the panel (e.g. through the API) has no
+        //! item yet; insert a single row for it instead of rebuilding the
+        //! whole tree
+        if (!m_isLoadingBlocked && m_rootItem && !m_rootItem->childAtId(part->id())) {
+            const Part* masterPart = m_masterNotation->parts()->part(part->id());
+            if (!masterPart) {
+                return;
+            }
+
+            int row = m_rootItem->childCount();
+            beginInsertRows(QModelIndex(), row, row);
+            m_rootItem->appendChild(loadMasterPart(masterPart));
+            endInsertRows();
+
+            emit isEmptyChanged();
+            return;
+        }
+
         updateMasterPartItem(part->id());
     });
 
+    notationParts.onItemRemoved(m_partsNotifyReceiver.get(), [this](const Part* part) {
+        //! NOTE the part is already gone from the score, so only the row is
+        //! removed here; the panel-initiated removal path detaches its rows
+        //! itself before this notification can see them
+        if (m_isLoadingBlocked || !m_rootItem) {
+            return;
+        }
+
+        AbstractInstrumentsPanelTreeItem* item = m_rootItem->childAtId(part->id());
+        if (!item) {
+            return;
+        }
+
+        int row = item->row();
+        beginRemoveRows(QModelIndex(), row, row);
+        m_rootItem->removeChildren(row, 1, false);
+        item->deleteLater();
+        endRemoveRows();
+
+        emit isEmptyChanged();
+    });
+
     notationParts.onItemChanged(m_partsNotifyReceiver.get(), [updateMasterPartItem](const Part* part) {
         updateMasterPartItem(part->id());
     });
@@ -193,6 +193,10 @@ void LanguagesService::setCurrentLanguage(const QString& languageCode)
         }
     }
 
+    //! NOTE translation results are interned on first lookup; drop
+    //! anything cached before the translators were (re)installed
+    clearTranslationCache();
+
     QLocale locale(lang.code);
     QLocale::setDefault(locale);
     qApp->setLayoutDirection(locale.textDirection());
@@ -266,41 +270,27 @@ QString LanguagesService::effectiveLanguageCode(const QString& languageCode) con
 
 Ret LanguagesService::loadLanguage(Language& lang)
 {
-    io::path_t languagesAppDataPath = configuration()->languagesAppDataPath();
-    io::path_t languagesUserAppDataPath = configuration()->languagesUserAppDataPath();
-
-    QString languageSuffix = QString("_%1.qm").arg(lang.code);
-
-    std::string filter = ("*" + languageSuffix).toStdString();
-
-    RetVal<io::paths_t> appFilePaths = fileSystem()->scanFiles(languagesAppDataPath, { filter });
-    if (!appFilePaths.ret) {
-        LOGE() << "Failed to scan files for language " << lang.code << ": " << appFilePaths.ret.toString();
-        return appFilePaths.ret;
-    }
-
-    for (const io::path_t& appFilePath : appFilePaths.val) {
-        io::path_t filename = io::filename(appFilePath);
-        io::path_t userFilePath = languagesUserAppDataPath.appendingComponent(filename);
+    //! NOTE the resource set is fixed, so the file names are known up
+    //! front; probing them directly avoids scanning the languages
+    //! directory, which holds the files of every shipped language
+    for (const QString& resourceName : LANGUAGE_RESOURCE_NAMES) {
+        io::path_t appFilePath = configuration()->builtinLanguageFilePath(resourceName, lang.code);
+        io::path_t userFilePath = configuration()->userLanguageFilePath(resourceName, lang.code);
 
         QFileInfo appFileInfo(appFilePath.toQString());
         QFileInfo userFileInfo(userFilePath.toQString());
-        bool useUserPath = userFileInfo.exists() && userFileInfo.lastModified() > appFileInfo.lastModified();
 
-        QString resourceName = filename.toQString().chopped(languageSuffix.size());
-        lang.files[resourceName] = useUserPath ? userFilePath : appFilePath;
-    }
+        bool appExists = appFileInfo.exists();
+        bool userExists = userFileInfo.exists();
 
-    assert([&lang]() {
-        for (const QString& resourceName : LANGUAGE_RESOURCE_NAMES) {
-            if (!lang.files.contains(resourceName)) {
-                LOGE() << "Could not find resource " << resourceName << " for language " << lang.code;
-                return false;
-            }
+        if (!appExists && !userExists) {
+            LOGE() << "Could not find resource " << resourceName << " for language " << lang.code;
+            continue;
         }
 
-        return true;
-    }());
+        bool useUserPath = userExists && (!appExists || userFileInfo.lastModified() > appFileInfo.lastModified());
+        lang.files[resourceName] = useUserPath ? userFilePath : appFilePath;
+    }
 
     return make_ok();
 }
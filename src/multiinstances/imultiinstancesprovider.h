@@ -45,6 +45,7 @@ public:
     virtual bool isHasAppInstanceWithoutProject() const = 0;
     virtual void activateWindowWithoutProject() = 0;
     virtual bool openNewAppInstance(const QStringList& args) = 0;
+    virtual bool openNewAppInstances(const QList<QStringList>& argsList) = 0;
 
     // Settings
     virtual bool isPreferencesAlreadyOpened() const = 0;
@@ -214,6 +214,11 @@ void MultiInstancesProvider::activateWindowWithoutProject()
 }
 
 bool MultiInstancesProvider::openNewAppInstance(const QStringList& args)
+{
+    return openNewAppInstances({ args });
+}
+
+bool MultiInstancesProvider::openNewAppInstances(const QList<QStringList>& argsList)
 {
     if (!isInited()) {
         return false;
@@ -222,12 +227,18 @@ bool MultiInstancesProvider::openNewAppInstance(const QStringList& args)
     QList<ID> currentApps = m_ipcChannel->instances();
 
     QString appPath = QCoreApplication::applicationFilePath();
-    bool ok = QProcess::startDetached(appPath, args);
-    if (ok) {
-        LOGI() << "success start: " << appPath << ", args: " << args;
-    } else {
-        LOGE() << "failed start: " << appPath << ", args: " << args;
-        return ok;
+    int startedCount = 0;
+    for (const QStringList& args : argsList) {
+        if (QProcess::startDetached(appPath, args)) {
+            LOGI() << "success start: " << appPath << ", args: " << args;
+            ++startedCount;
+        } else {
+            LOGE() << "failed start: " << appPath << ", args: " << args;
+        }
+    }
+
+    if (startedCount == 0) {
+        return false;
     }
 
     auto sleep = [](int msec) {
@@ -238,27 +249,33 @@ bool MultiInstancesProvider::openNewAppInstance(const QStringList& args)
         loop.exec();
     };
 
-    auto waitNewInstance = [this, sleep, currentApps](int waitMs, int count) {
+    auto waitNewInstances = [this, sleep, currentApps](int waitMs, int count, int expectedCount) {
         for (int i = 0; i < count; ++i) {
             sleep(waitMs);
+            int createdCount = 0;
             QList<ID> apps = m_ipcChannel->instances();
             for (const ID& id : apps) {
                 if (!currentApps.contains(id)) {
-                    LOGI() << "created new instance with ID: " << id;
-                    return true;
+                    ++createdCount;
                 }
             }
+            if (createdCount >= expectedCount) {
+                LOGI() << "created " << createdCount << " new instance(s)";
+                return true;
+            }
         }
         return false;
     };
 
-    //! NOTE Waiting for a new instance to be created
-    ok = waitNewInstance(100, 50);
+    //! NOTE Waiting for the new instances to be created; they all start and
+    //! register concurrently, so the wait is bounded by the slowest startup,
+    //! not by the sum of them
+    bool ok = waitNewInstances(100, 50, startedCount);
     if (!ok) {
         LOGE() << "we didn't wait for registration and response from the new instance";
     }
 
-    return ok;
+    return ok && startedCount == argsList.size();
 }
 
 bool MultiInstancesProvider::isPreferencesAlreadyOpened() const
@@ -57,6 +57,7 @@ public:
     bool isHasAppInstanceWithoutProject() const override;
     void activateWindowWithoutProject() override;
     bool openNewAppInstance(const QStringList& args) override;
+    bool openNewAppInstances(const QList<QStringList>& argsList) override;
 
     // Settings
     bool isPreferencesAlreadyOpened() const override;
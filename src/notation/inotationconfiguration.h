@@ -85,6 +85,9 @@ public:
     virtual int selectionProximity() const = 0;
     virtual void setSelectionProximity(int proximity) = 0;
 
+    virtual int undoHistoryLimit() const = 0;
+    virtual void setUndoHistoryLimit(int limit) = 0;
+
     virtual ZoomType defaultZoomType() const = 0;
     virtual void setDefaultZoomType(ZoomType zoomType) = 0;
 
@@ -142,6 +145,9 @@ public:
     virtual void setIsLimitCanvasScrollArea(bool limited) = 0;
     virtual async::Notification isLimitCanvasScrollAreaChanged() const = 0;
 
+    virtual bool useGpuPainting() const = 0;
+    virtual void setUseGpuPainting(bool use) = 0;
+
     virtual bool colorNotesOutsideOfUsablePitchRange() const = 0;
     virtual void setColorNotesOutsideOfUsablePitchRange(bool value) = 0;
 
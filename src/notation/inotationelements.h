@@ -42,6 +42,8 @@ public:
 
     virtual PageList pages() const = 0;
     virtual const Page* pageByPoint(const PointF& point) const = 0;
+
+    virtual ScoreComplexityStats complexityStats() const = 0;
 };
 
 using INotationElementsPtr = std::shared_ptr<INotationElements>;
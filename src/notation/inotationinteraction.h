@@ -34,6 +34,10 @@
 class QKeyEvent;
 class QInputMethodEvent;
 
+namespace mu::draw {
+class Painter;
+}
+
 namespace mu::notation {
 class INotationInteraction
 {
@@ -46,6 +50,8 @@ public:
     // Shadow note
     virtual void showShadowNote(const PointF& pos) = 0;
     virtual void hideShadowNote() = 0;
+    virtual RectF shadowNoteRect() const = 0;
+    virtual void paintShadowNote(draw::Painter* painter) = 0;
 
     // Visibility
     virtual void toggleVisible() = 0;
@@ -31,19 +31,37 @@ using namespace mu::notation;
 void InstrumentsRepository::init()
 {
     configuration()->scoreOrderListPathsChanged().onNotify(this, [this]() {
+        waitLoadingCompleted();
         load();
     });
 
-    load();
+    //! NOTE parsing the instrument list is one of the heaviest startup items,
+    //! so it runs in the background while the remaining modules initialize.
+    //! Everything that reads the templates afterwards - the accessors here and,
+    //! for the engraving globals, NotationModule::onAllInited - joins it first
+    m_loading = std::async(std::launch::async, [this]() {
+        load();
+    });
+}
+
+void InstrumentsRepository::waitLoadingCompleted() const
+{
+    if (m_loading.valid()) {
+        m_loading.get();
+    }
 }
 
 const InstrumentTemplateList& InstrumentsRepository::instrumentTemplates() const
 {
+    waitLoadingCompleted();
+
     return m_instrumentTemplates;
 }
 
 const InstrumentTemplate& InstrumentsRepository::instrumentTemplate(const std::string& instrumentId) const
 {
+    waitLoadingCompleted();
+
     const InstrumentTemplateList& templates = m_instrumentTemplates;
 
     auto it = std::find_if(templates.begin(), templates.end(), [instrumentId](const InstrumentTemplate* templ) {
@@ -61,11 +79,15 @@ const InstrumentTemplate& InstrumentsRepository::instrumentTemplate(const std::s
 
 const ScoreOrderList& InstrumentsRepository::orders() const
 {
+    waitLoadingCompleted();
+
     return mu::engraving::instrumentOrders;
 }
 
 const ScoreOrder& InstrumentsRepository::order(const std::string& orderId) const
 {
+    waitLoadingCompleted();
+
     const ScoreOrderList& orders = mu::engraving::instrumentOrders;
 
     auto it = std::find_if(orders.begin(), orders.end(), [orderId](const ScoreOrder& order) {
@@ -82,11 +104,15 @@ const ScoreOrder& InstrumentsRepository::order(const std::string& orderId) const
 
 const InstrumentGenreList& InstrumentsRepository::genres() const
 {
+    waitLoadingCompleted();
+
     return m_genres;
 }
 
 const InstrumentGroupList& InstrumentsRepository::groups() const
 {
+    waitLoadingCompleted();
+
     return m_groups;
 }
 
@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_INSTRUMENTSREPOSITORY_H
 #define MU_NOTATION_INSTRUMENTSREPOSITORY_H
 
+#include <future>
+
 #include "modularity/ioc.h"
 
 #include "async/channel.h"
@@ -38,6 +40,10 @@ class InstrumentsRepository : public IInstrumentsRepository, public async::Async
 public:
     void init();
 
+    //! NOTE joins the background parse started by init(); cheap once loading
+    //! has completed. Called before anything reads the template globals
+    void waitLoadingCompleted() const;
+
     const InstrumentTemplateList& instrumentTemplates() const override;
     const InstrumentTemplate& instrumentTemplate(const std::string& instrumentId) const override;
 
@@ -54,6 +60,8 @@ private:
     InstrumentTemplateList m_instrumentTemplates;
     InstrumentGroupList m_groups;
     InstrumentGenreList m_genres;
+
+    mutable std::future<void> m_loading;
 };
 }
 
@@ -26,6 +26,7 @@
 
 #include "log.h"
 #include "translation.h"
+#include "async/async.h"
 
 #include "engraving/style/defaultstyle.h"
 #include "engraving/style/pagestyle.h"
@@ -452,7 +453,30 @@ void MasterNotation::applyOptions(mu::engraving::MasterScore* score, const Score
 
     {
         mu::engraving::ScoreLoad sl;
-        score->doLayout();
+
+        // lay out enough measures to fill the first pages synchronously so
+        // that big scores show up right away; the remaining measures are
+        // laid out from the event loop, after the view had a chance to paint
+        static constexpr int INITIAL_LAYOUT_MEASURES = 100;
+        MeasureBase* mb = score->first();
+        for (int i = 0; mb && i < INITIAL_LAYOUT_MEASURES; ++i) {
+            mb = mb->next();
+        }
+
+        if (mb) {
+            const Fraction continueTick = mb->tick();
+            score->doLayoutUpTo(continueTick);
+            Async::call(this, [this, score, continueTick]() {
+                if (masterScore() != score) {
+                    return;
+                }
+                mu::engraving::ScoreLoad sl;
+                score->doLayoutRange(continueTick, Fraction(-1, 1));
+                notifyAboutNotationChanged();
+            });
+        } else {
+            score->doLayout();
+        }
     }
 }
 
@@ -621,12 +645,30 @@ void MasterNotation::setExcerptIsOpen(const INotationPtr excerptNotation, bool o
     excerptNotation->setIsOpen(open);
 
     if (open) {
-        excerptNotation->elements()->msScore()->doLayout();
+        scheduleExcerptLayout(excerptNotation);
     }
 
     markScoreAsNeedToSave();
 }
 
+void MasterNotation::scheduleExcerptLayout(INotationPtr excerptNotation)
+{
+    //! NOTE Part scores share the master score's undo stack and the global
+    //! font measurement caches, so laying several of them out on worker
+    //! threads is not safe. Queuing each layout on the event loop keeps
+    //! "open all parts" responsive instead: every part is laid out in its
+    //! own slice and shows up as soon as it is ready, rather than the UI
+    //! blocking for the sum of all part layouts.
+    Async::call(this, [excerptNotation]() {
+        if (!excerptNotation->isOpen()) {
+            return;
+        }
+
+        excerptNotation->elements()->msScore()->doLayout();
+        excerptNotation->notationChanged().notify();
+    });
+}
+
 void MasterNotation::doSetExcerpts(ExcerptNotationList excerpts)
 {
     TRACEFUNC;
@@ -65,6 +65,7 @@ public:
     void sortExcerpts(ExcerptNotationList& excerpts) override;
 
     void setExcerptIsOpen(const INotationPtr excerptNotation, bool open) override;
+    void scheduleExcerptLayout(INotationPtr excerptNotation);
 
     INotationPartsPtr parts() const override;
     bool hasParts() const override;
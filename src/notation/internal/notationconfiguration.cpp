@@ -50,6 +50,8 @@ static const Settings::Key FOREGROUND_USE_COLOR(module_name, "ui/canvas/foregrou
 
 static const Settings::Key SELECTION_PROXIMITY(module_name, "ui/canvas/misc/selectionProximity");
 
+static const Settings::Key UNDO_HISTORY_LIMIT(module_name, "score/undoHistoryLimit");
+
 static const Settings::Key DEFAULT_ZOOM_TYPE(module_name, "ui/canvas/zoomDefaultType");
 static const Settings::Key DEFAULT_ZOOM(module_name, "ui/canvas/zoomDefaultLevel");
 static const Settings::Key KEYBOARD_ZOOM_PRECISION(module_name, "ui/canvas/zoomPrecisionKeyboard");
@@ -69,6 +71,8 @@ static const Settings::Key TOOLBAR_KEY(module_name, "ui/toolbar/");
 static const Settings::Key IS_CANVAS_ORIENTATION_VERTICAL_KEY(module_name, "ui/canvas/scroll/verticalOrientation");
 static const Settings::Key IS_LIMIT_CANVAS_SCROLL_AREA_KEY(module_name, "ui/canvas/scroll/limitScrollArea");
 
+static const Settings::Key USE_GPU_PAINTING_KEY(module_name, "ui/canvas/useGpuPainting");
+
 static const Settings::Key COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE(module_name, "score/note/warnPitchRange");
 static const Settings::Key REALTIME_DELAY(module_name, "io/midi/realtimeDelay");
 static const Settings::Key NOTE_DEFAULT_PLAY_DURATION(module_name, "score/note/defaultPlayDuration");
@@ -154,6 +158,7 @@ void NotationConfiguration::init()
     fileSystem()->makePath(userStylesPath());
 
     settings()->setDefaultValue(SELECTION_PROXIMITY, Val(2));
+    settings()->setDefaultValue(UNDO_HISTORY_LIMIT, Val(1000));
     settings()->setDefaultValue(IS_MIDI_INPUT_ENABLED, Val(true));
     settings()->setDefaultValue(IS_AUTOMATICALLY_PAN_ENABLED, Val(true));
     settings()->setDefaultValue(IS_PLAY_REPEATS_ENABLED, Val(true));
@@ -175,6 +180,8 @@ void NotationConfiguration::init()
         m_isLimitCanvasScrollAreaChanged.notify();
     });
 
+    settings()->setDefaultValue(USE_GPU_PAINTING_KEY, Val(false));
+
     settings()->setDefaultValue(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE, Val(true));
     settings()->setDefaultValue(REALTIME_DELAY, Val(750));
     settings()->setDefaultValue(NOTE_DEFAULT_PLAY_DURATION, Val(500));
@@ -425,6 +432,16 @@ void NotationConfiguration::setSelectionProximity(int proximity)
     settings()->setSharedValue(SELECTION_PROXIMITY, Val(proximity));
 }
 
+int NotationConfiguration::undoHistoryLimit() const
+{
+    return settings()->value(UNDO_HISTORY_LIMIT).toInt();
+}
+
+void NotationConfiguration::setUndoHistoryLimit(int limit)
+{
+    settings()->setSharedValue(UNDO_HISTORY_LIMIT, Val(limit));
+}
+
 ZoomType NotationConfiguration::defaultZoomType() const
 {
     return settings()->value(DEFAULT_ZOOM_TYPE).toEnum<ZoomType>();
@@ -632,6 +649,16 @@ Notification NotationConfiguration::isLimitCanvasScrollAreaChanged() const
     return m_isLimitCanvasScrollAreaChanged;
 }
 
+bool NotationConfiguration::useGpuPainting() const
+{
+    return settings()->value(USE_GPU_PAINTING_KEY).toBool();
+}
+
+void NotationConfiguration::setUseGpuPainting(bool use)
+{
+    settings()->setSharedValue(USE_GPU_PAINTING_KEY, Val(use));
+}
+
 bool NotationConfiguration::colorNotesOutsideOfUsablePitchRange() const
 {
     return settings()->value(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE).toBool();
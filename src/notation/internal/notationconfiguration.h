@@ -89,6 +89,9 @@ public:
     int selectionProximity() const override;
     void setSelectionProximity(int proximity) override;
 
+    int undoHistoryLimit() const override;
+    void setUndoHistoryLimit(int limit) override;
+
     ZoomType defaultZoomType() const override;
     void setDefaultZoomType(ZoomType zoomType) override;
 
@@ -146,6 +149,9 @@ public:
     void setIsLimitCanvasScrollArea(bool limited) override;
     async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool useGpuPainting() const override;
+    void setUseGpuPainting(bool use) override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value) override;
 
@@ -26,6 +26,7 @@
 #include "libmscore/page.h"
 #include "libmscore/rehearsalmark.h"
 #include "libmscore/segment.h"
+#include "libmscore/textbase.h"
 
 #include "log.h"
 #include "searchcommandsparser.h"
@@ -99,7 +100,37 @@ mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string&
 {
     QString qname = QString::fromStdString(name).toLower();
 
-    for (mu::engraving::Segment* segment = score()->firstSegment(mu::engraving::SegmentType::ChordRest); segment;
+    updateRehearsalMarks();
+
+    for (const auto& pair : m_rehearsalMarks) {
+        if (pair.first.startsWith(qname)) {
+            return pair.second;
+        }
+    }
+
+    return nullptr;
+}
+
+void NotationElements::updateRehearsalMarks() const
+{
+    mu::engraving::Score* score = this->score();
+
+    if (score != m_rehearsalMarksScore) {
+        m_rehearsalMarksScore = score;
+        m_rehearsalMarksValid = false;
+
+        score->changesChannel().onReceive(this, [this](const mu::engraving::ScoreChangesRange&) {
+            m_rehearsalMarksValid = false;
+        });
+    }
+
+    if (m_rehearsalMarksValid) {
+        return;
+    }
+
+    m_rehearsalMarks.clear();
+
+    for (mu::engraving::Segment* segment = score->firstSegment(mu::engraving::SegmentType::ChordRest); segment;
          segment = segment->next1(mu::engraving::SegmentType::ChordRest)) {
         for (EngravingItem* element: segment->annotations()) {
             if (element->type() != ElementType::REHEARSAL_MARK) {
@@ -107,14 +138,11 @@ mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string&
             }
 
             mu::engraving::RehearsalMark* rehearsalMark = static_cast<mu::engraving::RehearsalMark*>(element);
-            QString rehearsalMarkName = rehearsalMark->plainText().toQString().toLower();
-            if (rehearsalMarkName.startsWith(qname)) {
-                return rehearsalMark;
-            }
+            m_rehearsalMarks.emplace_back(rehearsalMark->plainText().toQString().toLower(), rehearsalMark);
         }
     }
 
-    return nullptr;
+    m_rehearsalMarksValid = true;
 }
 
 mu::engraving::Measure* NotationElements::measure(const int measureIndex) const
@@ -137,6 +165,38 @@ const Page* NotationElements::pageByPoint(const PointF& point) const
     return score()->searchPage(point);
 }
 
+ScoreComplexityStats NotationElements::complexityStats() const
+{
+    TRACEFUNC;
+
+    ScoreComplexityStats stats;
+
+    mu::engraving::Score* score = this->score();
+    if (!score) {
+        return stats;
+    }
+
+    stats.measureCount = score->nmeasures();
+    stats.spannerCount = score->spannerMap().map().size();
+
+    score->scanElements(&stats, [](void* data, EngravingItem* element) {
+        ScoreComplexityStats* stats = static_cast<ScoreComplexityStats*>(data);
+
+        stats->totalElementCount++;
+        stats->elementCountsByType[element->typeName()]++;
+
+        if (element->isNote()) {
+            stats->noteCount++;
+        } else if (element->isChordRest()) {
+            stats->chordRestCount++;
+        } else if (element->isTextBase()) {
+            stats->textCharCount += mu::engraving::toTextBase(element)->plainText().size();
+        }
+    });
+
+    return stats;
+}
+
 mu::engraving::Page* NotationElements::page(const int pageIndex) const
 {
     if (pageIndex < 0 || size_t(pageIndex) >= score()->pages().size()) {
@@ -22,11 +22,13 @@
 #ifndef MU_NOTATION_NOTATIONELEMENTS_H
 #define MU_NOTATION_NOTATIONELEMENTS_H
 
+#include "async/asyncable.h"
+
 #include "inotationelements.h"
 #include "igetscore.h"
 
 namespace mu::notation {
-class NotationElements : public INotationElements
+class NotationElements : public INotationElements, public async::Asyncable
 {
 public:
     NotationElements(IGetScore* getScore);
@@ -40,10 +42,13 @@ public:
     PageList pages() const override;
     const Page* pageByPoint(const PointF& point) const override;
 
+    ScoreComplexityStats complexityStats() const override;
+
 private:
     mu::engraving::Score* score() const;
 
     mu::engraving::RehearsalMark* rehearsalMark(const std::string& name) const;
+    void updateRehearsalMarks() const;
     mu::engraving::Page* page(const int pageIndex) const;
 
     std::vector<EngravingItem*> allScoreElements() const;
@@ -55,6 +60,12 @@ private:
     mu::engraving::NotePattern* constructNotePattern(const FilterNotesOptions* notesOptions) const;
 
     IGetScore* m_getScore = nullptr;
+
+    //! NOTE the search popup queries per keystroke, so the rehearsal marks are collected
+    //! once per score state instead of rescanning every segment on each query
+    mutable std::vector<std::pair<QString, mu::engraving::RehearsalMark*> > m_rehearsalMarks;
+    mutable const mu::engraving::Score* m_rehearsalMarksScore = nullptr;
+    mutable bool m_rehearsalMarksValid = false;
 };
 }
 
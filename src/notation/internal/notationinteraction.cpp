@@ -386,8 +386,6 @@ void NotationInteraction::notifyAboutNoteInputStateChanged()
 
 void NotationInteraction::paint(mu::draw::Painter* painter)
 {
-    score()->shadowNote().draw(painter);
-
     drawAnchorLines(painter);
     drawTextEditMode(painter);
     drawSelectionRange(painter);
@@ -496,6 +494,26 @@ void NotationInteraction::hideShadowNote()
     score()->shadowNote().setVisible(false);
 }
 
+RectF NotationInteraction::shadowNoteRect() const
+{
+    const mu::engraving::ShadowNote& shadowNote = score()->shadowNote();
+    if (!shadowNote.visible()) {
+        return RectF();
+    }
+
+    RectF rect = shadowNote.bbox().translated(shadowNote.pagePos());
+
+    //! NOTE articulations and ledger lines are drawn around the bbox,
+    //! so add a margin to be sure the whole shadow note is covered
+    double margin = shadowNote.spatium() * 4.0;
+    return rect.adjusted(-margin, -margin, margin, margin);
+}
+
+void NotationInteraction::paintShadowNote(draw::Painter* painter)
+{
+    score()->shadowNote().draw(painter);
+}
+
 void NotationInteraction::toggleVisible()
 {
     startEdit();
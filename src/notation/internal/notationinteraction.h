@@ -64,6 +64,8 @@ public:
     // Shadow note
     void showShadowNote(const PointF& pos) override;
     void hideShadowNote() override;
+    RectF shadowNoteRect() const override;
+    void paintShadowNote(draw::Painter* painter) override;
 
     // Visibility
     void toggleVisible() override;
@@ -32,7 +32,6 @@
 
 #include "notationtypes.h"
 
-#include "defer.h"
 #include "log.h"
 
 using namespace mu::notation;
@@ -115,11 +114,21 @@ void NotationMidiInput::doProcessEvents()
         return;
     }
 
+    const bool noteInput = isNoteInputMode();
+
+    //! NOTE everything queued since the last tick is applied inside a single
+    //! edit cycle: one undo record, one layout, one repaint. A fast chord
+    //! arrives as several note-ons within one interval and used to pay a full
+    //! cycle each, which backed up the queue under fast playing
+    if (noteInput) {
+        m_undoStack->prepareChanges();
+    }
+
     std::vector<const Note*> notes;
 
     for (size_t i = 0; i < m_eventsQueue.size(); ++i) {
         const midi::Event& event = m_eventsQueue.at(i);
-        Note* note = isNoteInputMode() ? addNoteToScore(event) : makeNote(event);
+        Note* note = noteInput ? addNoteToScore(event) : makeNote(event);
         if (note) {
             notes.push_back(note);
         }
@@ -133,6 +142,15 @@ void NotationMidiInput::doProcessEvents()
         }
     }
 
+    if (noteInput) {
+        m_undoStack->commitChanges();
+
+        mu::engraving::Score* sc = score();
+        if (!notes.empty() && sc && sc->inputState().cr()) {
+            m_notationInteraction->showItem(sc->inputState().cr());
+        }
+    }
+
     if (!notes.empty()) {
         std::vector<const EngravingItem*> notesItems;
         for (const Note* note : notes) {
@@ -167,11 +185,8 @@ Note* NotationMidiInput::addNoteToScore(const midi::Event& e)
         return nullptr;
     }
 
-    DEFER {
-        m_undoStack->commitChanges();
-    };
-
-    m_undoStack->prepareChanges();
+    //! NOTE the undo transaction is opened and committed by doProcessEvents,
+    //! once around the whole staged batch
 
     if (e.opcode() == midi::Event::Opcode::NoteOff) {
         if (isRealtime()) {
@@ -206,8 +221,6 @@ Note* NotationMidiInput::addNoteToScore(const midi::Event& e)
 
     sc->activeMidiPitches().push_back(inputEv);
 
-    m_notationInteraction->showItem(is.cr());
-
     return note;
 }
 
@@ -89,6 +89,16 @@ std::vector<mu::RectF> NotationSelectionRange::boundingArea() const
         return {};
     }
 
+    const unsigned layoutGeneration = score()->layoutGeneration();
+    if (m_boundingAreaCache.valid
+        && m_boundingAreaCache.startSegment == startSegment
+        && m_boundingAreaCache.endSegment == endSegment
+        && m_boundingAreaCache.staffStart == selection.staffStart()
+        && m_boundingAreaCache.staffEnd == selection.staffEnd()
+        && m_boundingAreaCache.layoutGeneration == layoutGeneration) {
+        return m_boundingAreaCache.rects;
+    }
+
     std::vector<RectF> result;
 
     std::vector<RangeSection> rangeSections = splitRangeBySections(startSegment, endSegment);
@@ -119,6 +129,14 @@ std::vector<mu::RectF> NotationSelectionRange::boundingArea() const
         result.push_back(rect);
     }
 
+    m_boundingAreaCache.rects = result;
+    m_boundingAreaCache.startSegment = startSegment;
+    m_boundingAreaCache.endSegment = endSegment;
+    m_boundingAreaCache.staffStart = selection.staffStart();
+    m_boundingAreaCache.staffEnd = selection.staffEnd();
+    m_boundingAreaCache.layoutGeneration = layoutGeneration;
+    m_boundingAreaCache.valid = true;
+
     return result;
 }
 
@@ -69,6 +69,20 @@ private:
     int sectionElementsMinY(const RangeSection& selection) const;
 
     IGetScore* m_getScore = nullptr;
+
+    //! NOTE the bounding rects are queried on every paint and on every
+    //! mouse move during a drag; they only change when the selected range
+    //! or the layout changes, so cache them keyed on both
+    struct BoundingAreaCache {
+        std::vector<RectF> rects;
+        const mu::engraving::Segment* startSegment = nullptr;
+        const mu::engraving::Segment* endSegment = nullptr;
+        engraving::staff_idx_t staffStart = 0;
+        engraving::staff_idx_t staffEnd = 0;
+        unsigned layoutGeneration = 0;
+        bool valid = false;
+    };
+    mutable BoundingAreaCache m_boundingAreaCache;
 };
 }
 
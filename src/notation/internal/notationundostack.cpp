@@ -101,6 +101,11 @@ void NotationUndoStack::prepareChanges()
         return;
     }
 
+    //! NOTE keeps the finished macro count within the configured budget;
+    //! the stack evicts the oldest macros when the budget is exceeded
+    int limit = configuration()->undoHistoryLimit();
+    undoStack()->setMaxMacroCount(limit > 0 ? static_cast<size_t>(limit) : 0);
+
     score()->startCmd();
 }
 
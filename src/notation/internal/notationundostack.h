@@ -26,6 +26,9 @@
 #include "inotationundostack.h"
 #include "igetscore.h"
 
+#include "modularity/ioc.h"
+#include "inotationconfiguration.h"
+
 namespace mu::engraving {
 class Score;
 class MasterScore;
@@ -36,6 +39,8 @@ class EditData;
 namespace mu::notation {
 class NotationUndoStack : public INotationUndoStack
 {
+    INJECT(notation, INotationConfiguration, configuration)
+
 public:
     NotationUndoStack(IGetScore* getScore, async::Notification notationChanged);
 
@@ -242,3 +242,15 @@ void NotationModule::onInit(const framework::IApplication::RunMode& mode)
         }
     }
 }
+
+void NotationModule::onAllInited(const framework::IApplication::RunMode& mode)
+{
+    if (mode == framework::IApplication::RunMode::AudioPluginProbe) {
+        return;
+    }
+
+    //! NOTE scores resolve instruments through the engraving template globals
+    //! directly, bypassing the repository, so the background load started in
+    //! onInit must be finished before any score can be opened
+    s_instrumentsRepository->waitLoadingCompleted();
+}
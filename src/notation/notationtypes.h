@@ -24,6 +24,7 @@
 
 #include <QPixmap>
 #include <QDate>
+#include <map>
 #include <unordered_set>
 
 #include "translation.h"
@@ -471,6 +472,19 @@ struct SelectionRange
     Fraction endTick;
 };
 
+//! NOTE complexity metrics collected in a single score traversal;
+//! measure density is chordRestCount / measureCount on the consumer side
+struct ScoreComplexityStats
+{
+    size_t measureCount = 0;
+    size_t noteCount = 0;
+    size_t chordRestCount = 0;
+    size_t spannerCount = 0;
+    size_t textCharCount = 0;
+    size_t totalElementCount = 0;
+    std::map<std::string, size_t> elementCountsByType;
+};
+
 struct StaffConfig
 {
     bool visible = false;
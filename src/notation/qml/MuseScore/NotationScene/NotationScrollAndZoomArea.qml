@@ -28,10 +28,18 @@ import "internal"
 PinchArea {
     required default property AbstractNotationPaintView notationView
 
+    onPinchStarted: function(pinch) {
+        notationView.beginInteractiveZoom()
+    }
+
     onPinchUpdated: function(pinch) {
         notationView.pinchToZoom(pinch.scale / pinch.previousScale, pinch.center)
     }
 
+    onPinchFinished: function(pinch) {
+        notationView.endInteractiveZoom()
+    }
+
     // A macOS feature which allows double-tapping with two fingers to zoom in or out
     onSmartZoom: function(pinch) {
         notationView.pinchToZoom(pinch.scale === 0 ? 0.5 : 2, pinch.center)
@@ -21,6 +21,14 @@
  */
 #include "abstractnotationpaintview.h"
 
+#include <cmath>
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QPainter>
 
 #include "actions/actiontypes.h"
@@ -35,6 +43,12 @@ using namespace mu::notation;
 static constexpr qreal SCROLL_LIMIT_OFF_OFFSET = 0.75;
 static constexpr qreal SCROLL_LIMIT_ON_OFFSET = 0.02;
 
+static constexpr int PAINT_TILE_SIZE = 512; // device independent pixels
+static constexpr size_t MAX_PAINT_TILE_COUNT = 32;
+
+static constexpr qint64 JANK_FRAME_MSECS = 16;
+static constexpr size_t MAX_JANK_LOG_SIZE = 256;
+
 AbstractNotationPaintView::AbstractNotationPaintView(QQuickItem* parent)
     : uicomponents::QuickPaintedView(parent)
 {
@@ -66,9 +80,19 @@ AbstractNotationPaintView::AbstractNotationPaintView(QQuickItem* parent)
 
     //! NOTE For diagnostic tools
     dispatcher()->reg(this, "diagnostic-notationview-redraw", [this]() {
+        invalidatePaintTiles();
+        update();
+    });
+
+    dispatcher()->reg(this, "diagnostic-notationview-perf-hud", [this]() {
+        m_perfHudEnabled = !m_perfHudEnabled;
         update();
     });
 
+    dispatcher()->reg(this, "diagnostic-notationview-jank-log", [this]() {
+        writeJankLog();
+    });
+
     m_enableAutoScrollTimer.setSingleShot(true);
     connect(&m_enableAutoScrollTimer, &QTimer::timeout, this, [this]() {
         m_autoScrollEnabled = true;
@@ -89,6 +113,15 @@ void AbstractNotationPaintView::load()
 
     m_inputController->init();
 
+    //! NOTE When enabled, the view is painted into a framebuffer object and
+    //! the content is rasterized by the GL paint engine on the GPU instead
+    //! of the CPU raster engine; the CPU-side tile cache is bypassed then,
+    //! since re-rasterizing on the GPU is cheaper than uploading tiles
+    m_useGpuPainting = configuration()->useGpuPainting();
+    if (m_useGpuPainting) {
+        setRenderTarget(QQuickPaintedItem::FramebufferObject);
+    }
+
     onNotationSetup();
 
     initBackground();
@@ -188,7 +221,9 @@ void AbstractNotationPaintView::selectOnNavigationActive()
 
 bool AbstractNotationPaintView::canReceiveAction(const actions::ActionCode& actionCode) const
 {
-    if (actionCode == "diagnostic-notationview-redraw") {
+    if (actionCode == "diagnostic-notationview-redraw"
+        || actionCode == "diagnostic-notationview-perf-hud"
+        || actionCode == "diagnostic-notationview-jank-log") {
         return true;
     }
 
@@ -232,6 +267,8 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
 
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
         interaction->hideShadowNote();
+        markFrameCause("notation-changed");
+        invalidatePaintTiles();
         update();
     });
 
@@ -241,6 +278,7 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->selectionChanged().onNotify(this, [this]() {
+        invalidatePaintTiles();
         update();
     });
 
@@ -464,8 +502,19 @@ bool AbstractNotationPaintView::isNoteEnterMode() const
 void AbstractNotationPaintView::showShadowNote(const PointF& pos)
 {
     TRACEFUNC;
-    notationInteraction()->showShadowNote(pos);
-    update();
+    INotationInteractionPtr interaction = notationInteraction();
+
+    //! NOTE repaint only the area the shadow note occupied before and
+    //! after the move, instead of the whole view
+    RectF dirtyRect = interaction->shadowNoteRect();
+    interaction->showShadowNote(pos);
+    dirtyRect = dirtyRect.united(interaction->shadowNoteRect());
+
+    if (dirtyRect.isNull()) {
+        return;
+    }
+
+    update(fromLogical(dirtyRect).toQRect().adjusted(-1, -1, 1, 1));
 }
 
 void AbstractNotationPaintView::showContextMenu(const ElementType& elementType, const QPointF& pos, bool activateFocus)
@@ -494,6 +543,9 @@ void AbstractNotationPaintView::paint(QPainter* qp)
 {
     TRACEFUNC;
 
+    QElapsedTimer paintTimer;
+    paintTimer.start();
+
     mu::draw::Painter mup(qp, objectName().toStdString());
     mu::draw::Painter* painter = &mup;
 
@@ -508,10 +560,19 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
+    bool isPrinting = publishMode() || m_inputController->readonly();
+    if (m_useGpuPainting) {
+        painter->setWorldTransform(m_matrix * guiScalingCompensation);
+        notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    } else {
+        paintTiles(qp, rect, isPrinting);
+    }
+
     painter->setWorldTransform(m_matrix * guiScalingCompensation);
 
-    bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    //! NOTE the shadow note is painted as an overlay, so that moving it
+    //! during note input never touches the cached score content
+    notationInteraction()->paintShadowNote(painter);
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -526,6 +587,226 @@ void AbstractNotationPaintView::paint(QPainter* qp)
         ctx.fromLogical = [this](const PointF& pos) -> PointF { return fromLogical(pos); };
         m_continuousPanel->paint(*painter, ctx);
     }
+
+    recordFrame(paintTimer.elapsed());
+
+    if (m_perfHudEnabled) {
+        paintPerfHud(qp);
+    }
+}
+
+void AbstractNotationPaintView::markFrameCause(const QString& cause)
+{
+    m_frameCause = cause;
+    m_frameCauseArmed = true;
+    m_frameCauseTimer.start();
+}
+
+void AbstractNotationPaintView::recordFrame(qint64 paintMs)
+{
+    m_lastPaintMs = paintMs;
+
+    if (m_frameCauseArmed) {
+        m_lastLatencyMs = m_frameCauseTimer.elapsed();
+        m_frameCauseArmed = false;
+    }
+
+    if (paintMs <= JANK_FRAME_MSECS) {
+        return;
+    }
+
+    FrameStat stat;
+    stat.timestampMs = QDateTime::currentMSecsSinceEpoch();
+    stat.paintMs = paintMs;
+    stat.latencyMs = m_lastLatencyMs;
+    stat.cause = m_frameCause;
+
+    m_jankLog.push_back(stat);
+    if (m_jankLog.size() > MAX_JANK_LOG_SIZE) {
+        m_jankLog.pop_front();
+    }
+}
+
+void AbstractNotationPaintView::paintPerfHud(QPainter* qp)
+{
+    qp->save();
+    qp->resetTransform();
+
+    QStringList lines;
+    lines << QString("paint: %1 ms").arg(m_lastPaintMs)
+          << QString("event to frame: %1 ms (%2)").arg(m_lastLatencyMs).arg(m_frameCause)
+          << QString("jank frames (>%1 ms): %2").arg(JANK_FRAME_MSECS).arg(m_jankLog.size());
+
+    QFontMetrics metrics(qp->font());
+    int lineHeight = metrics.height();
+    QRect hudRect(8, 8, 280, lineHeight * lines.size() + 8);
+
+    qp->fillRect(hudRect, QColor(0, 0, 0, 160));
+    qp->setPen(Qt::white);
+
+    int y = hudRect.top() + 4 + metrics.ascent();
+    for (const QString& line : lines) {
+        qp->drawText(hudRect.left() + 6, y, line);
+        y += lineHeight;
+    }
+
+    qp->restore();
+}
+
+void AbstractNotationPaintView::writeJankLog()
+{
+    QJsonArray frames;
+    for (const FrameStat& stat : m_jankLog) {
+        QJsonObject frame;
+        frame["timestamp_ms"] = stat.timestampMs;
+        frame["paint_ms"] = stat.paintMs;
+        frame["latency_ms"] = stat.latencyMs;
+        frame["cause"] = stat.cause;
+        frames.append(frame);
+    }
+
+    QJsonObject root;
+    root["jank_threshold_ms"] = JANK_FRAME_MSECS;
+    root["frames"] = frames;
+
+    QString filePath = QDir::tempPath() + "/notationview_jank.json";
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open file: " << filePath;
+        return;
+    }
+
+    file.write(QJsonDocument(root).toJson());
+    LOGI() << "jank log saved: " << filePath;
+}
+
+void AbstractNotationPaintView::paintTiles(QPainter* qp, const RectF& viewRect, bool isPrinting)
+{
+    TRACEFUNC;
+
+    const qreal guiScaling = configuration()->guiScaling();
+    const qreal sx = m_matrix.m11() * guiScaling;
+    const qreal sy = m_matrix.m22() * guiScaling;
+    const qreal dx = m_matrix.dx() * guiScaling;
+    const qreal dy = m_matrix.dy() * guiScaling;
+    const qreal dpr = qp->device() ? qp->device()->devicePixelRatioF() : 1.0;
+
+    if (sx != m_paintTilesScaleX || sy != m_paintTilesScaleY || dpr != m_paintTilesDpr || isPrinting != m_paintTilesPrinting) {
+        //! NOTE while a pinch gesture is in progress the cached tiles are
+        //! scaled to the requested zoom instead of being re-rendered for
+        //! every intermediate scale; the final scale is rendered at full
+        //! quality when the gesture ends (see endInteractiveZoom)
+        if (m_interactiveZoomActive && !isPrinting && !m_paintTiles.empty()
+            && dpr == m_paintTilesDpr && m_paintTilesScaleX > 0.0 && m_paintTilesScaleY > 0.0) {
+            paintScaledTiles(qp, viewRect, sx, sy, dx, dy);
+            return;
+        }
+
+        m_paintTiles.clear();
+        m_paintTilesScaleX = sx;
+        m_paintTilesScaleY = sy;
+        m_paintTilesDpr = dpr;
+        m_paintTilesPrinting = isPrinting;
+    }
+
+    if (sx <= 0.0 || sy <= 0.0) {
+        return;
+    }
+
+    const int ts = PAINT_TILE_SIZE;
+    RectF canvasRect = viewRect.translated(-dx, -dy);
+    const int x1 = static_cast<int>(std::floor(canvasRect.left() / ts));
+    const int x2 = static_cast<int>(std::floor(canvasRect.right() / ts));
+    const int y1 = static_cast<int>(std::floor(canvasRect.top() / ts));
+    const int y2 = static_cast<int>(std::floor(canvasRect.bottom() / ts));
+
+    qp->save();
+    qp->setRenderHint(QPainter::SmoothPixmapTransform, true);
+
+    for (int ty = y1; ty <= y2; ++ty) {
+        for (int tx = x1; tx <= x2; ++tx) {
+            TileKey key { tx, ty };
+            auto it = m_paintTiles.find(key);
+            if (it == m_paintTiles.end()) {
+                it = m_paintTiles.insert({ key, renderPaintTile(key, isPrinting) }).first;
+            }
+            qp->drawPixmap(QPointF(tx * ts + dx, ty * ts + dy), it->second);
+        }
+    }
+
+    qp->restore();
+
+    //! NOTE keep the cache bounded: when over budget, drop the tiles that are
+    //! no longer near the viewport (one tile of margin for small pans)
+    if (m_paintTiles.size() > MAX_PAINT_TILE_COUNT) {
+        RectF keepRect = canvasRect.adjusted(-ts, -ts, ts, ts);
+        for (auto it = m_paintTiles.begin(); it != m_paintTiles.end();) {
+            RectF tileRect(it->first.x * ts, it->first.y * ts, ts, ts);
+            if (!tileRect.intersects(keepRect)) {
+                it = m_paintTiles.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+void AbstractNotationPaintView::paintScaledTiles(QPainter* qp, const RectF& viewRect, qreal sx, qreal sy, qreal dx, qreal dy)
+{
+    TRACEFUNC;
+
+    const int ts = PAINT_TILE_SIZE;
+    const qreal rx = sx / m_paintTilesScaleX;
+    const qreal ry = sy / m_paintTilesScaleY;
+
+    qp->save();
+    qp->setRenderHint(QPainter::SmoothPixmapTransform, true);
+
+    for (const auto& pair : m_paintTiles) {
+        QRectF target(pair.first.x * ts * rx + dx, pair.first.y * ts * ry + dy, ts * rx, ts * ry);
+        if (!target.intersects(viewRect.toQRectF())) {
+            continue;
+        }
+
+        //! NOTE tiles that were never rendered at the cached scale are simply
+        //! missing for the duration of the gesture; the background shows
+        //! through until the full-quality repaint
+        qp->drawPixmap(target, pair.second, QRectF(pair.second.rect()));
+    }
+
+    qp->restore();
+}
+
+QPixmap AbstractNotationPaintView::renderPaintTile(const TileKey& key, bool isPrinting)
+{
+    TRACEFUNC;
+
+    const int ts = PAINT_TILE_SIZE;
+    QPixmap tile(static_cast<int>(ts * m_paintTilesDpr), static_cast<int>(ts * m_paintTilesDpr));
+    tile.setDevicePixelRatio(m_paintTilesDpr);
+    //! NOTE only the score content is rendered into the tile; the view
+    //! background is painted underneath on every frame, so tiles stay valid
+    //! when the background settings change
+    tile.fill(Qt::transparent);
+
+    QPainter qp(&tile);
+    mu::draw::Painter painter(&qp, "notationview_tile");
+
+    const double tx = static_cast<double>(key.x) * ts;
+    const double ty = static_cast<double>(key.y) * ts;
+
+    Transform worldTransform(m_paintTilesScaleX, 0.0, 0.0, m_paintTilesScaleY, -tx, -ty);
+    painter.setWorldTransform(worldTransform);
+
+    RectF logicRect(tx / m_paintTilesScaleX, ty / m_paintTilesScaleY, ts / m_paintTilesScaleX, ts / m_paintTilesScaleY);
+    notation()->painting()->paintView(&painter, logicRect, isPrinting);
+
+    return tile;
+}
+
+void AbstractNotationPaintView::invalidatePaintTiles()
+{
+    m_paintTiles.clear();
 }
 
 void AbstractNotationPaintView::onNotationSetup()
@@ -547,14 +828,17 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        invalidatePaintTiles();
         update();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        invalidatePaintTiles();
         update();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        invalidatePaintTiles();
         update();
     });
 }
@@ -960,9 +1244,28 @@ void AbstractNotationPaintView::pinchToZoom(qreal scaleFactor, const QPointF& po
     }
 }
 
+void AbstractNotationPaintView::beginInteractiveZoom()
+{
+    m_interactiveZoomActive = true;
+}
+
+void AbstractNotationPaintView::endInteractiveZoom()
+{
+    if (!m_interactiveZoomActive) {
+        return;
+    }
+
+    m_interactiveZoomActive = false;
+
+    //! NOTE re-render the final scale at full quality
+    markFrameCause("pinch end");
+    update();
+}
+
 void AbstractNotationPaintView::wheelEvent(QWheelEvent* event)
 {
     TRACEFUNC;
+    markFrameCause("wheel");
     if (isInited()) {
         m_inputController->wheelEvent(event);
     }
@@ -980,6 +1283,7 @@ void AbstractNotationPaintView::mousePressEvent(QMouseEvent* event)
 {
     TRACEFUNC;
     forceFocusIn();
+    markFrameCause("mouse-press");
 
     if (isInited()) {
         m_inputController->mousePressEvent(event);
@@ -989,6 +1293,7 @@ void AbstractNotationPaintView::mousePressEvent(QMouseEvent* event)
 void AbstractNotationPaintView::mouseMoveEvent(QMouseEvent* event)
 {
     TRACEFUNC;
+    markFrameCause("mouse-move");
     if (isInited()) {
         m_inputController->mouseMoveEvent(event);
     }
@@ -1029,6 +1334,7 @@ bool AbstractNotationPaintView::shortcutOverride(QKeyEvent* event)
 
 void AbstractNotationPaintView::keyPressEvent(QKeyEvent* event)
 {
+    markFrameCause("key-press");
     if (isInited()) {
         m_inputController->keyPressEvent(event);
     }
@@ -1104,6 +1410,7 @@ void AbstractNotationPaintView::dragMoveEvent(QDragMoveEvent* event)
 
 void AbstractNotationPaintView::dropEvent(QDropEvent* event)
 {
+    markFrameCause("drop");
     if (isInited()) {
         m_inputController->dropEvent(event);
     }
@@ -1113,6 +1420,7 @@ void AbstractNotationPaintView::setNotation(INotationPtr notation)
 {
     clear();
     m_notation = notation;
+    invalidatePaintTiles();
     update();
 }
 
@@ -1204,6 +1512,7 @@ void AbstractNotationPaintView::movePlaybackCursor(midi::tick_t tick)
         return;
     }
 
+    RectF dirtyRect = m_playbackCursor->rect();
     m_playbackCursor->move(tick);
     const RectF& cursorRect = m_playbackCursor->rect();
 
@@ -1219,7 +1528,11 @@ void AbstractNotationPaintView::movePlaybackCursor(midi::tick_t tick)
         }
     }
 
-    update(); //! TODO set rect to optimization
+    //! NOTE the cursor is painted as an overlay above the cached score content,
+    //! so a position tick only needs to repaint the area the cursor occupied
+    //! before and after the move, not the whole view
+    dirtyRect = dirtyRect.united(cursorRect);
+    update(fromLogical(dirtyRect).toQRect().adjusted(-1, -1, 1, 1));
 }
 
 bool AbstractNotationPaintView::needAdjustCanvasVerticallyWhilePlayback(const RectF& cursorRect)
@@ -22,8 +22,13 @@
 #ifndef MU_NOTATION_ABSTRACTNOTATIONPAINTVIEW_H
 #define MU_NOTATION_ABSTRACTNOTATIONPAINTVIEW_H
 
+#include <QElapsedTimer>
+#include <QPixmap>
 #include <QTimer>
 
+#include <deque>
+#include <map>
+
 #include "modularity/ioc.h"
 
 #include "notation/inotationconfiguration.h"
@@ -108,6 +113,8 @@ public:
     void scale(qreal factor, const PointF& pos, bool overrideZoomType = true);
 
     Q_INVOKABLE void pinchToZoom(qreal scaleFactor, const QPointF& pos);
+    Q_INVOKABLE void beginInteractiveZoom();
+    Q_INVOKABLE void endInteractiveZoom();
 
     bool isNoteEnterMode() const override;
     void showShadowNote(const PointF& pos) override;
@@ -231,6 +238,38 @@ private:
 
     void paintBackground(const RectF& rect, draw::Painter* painter);
 
+    //! NOTE zoom-level-aware tile cache: already rendered score regions are
+    //! blitted while panning instead of being re-rasterized. Tiles live in
+    //! "canvas space" (device coordinates with the pan translation removed),
+    //! so only the blit positions change while scrolling; any content change
+    //! (notation, selection, shadow note...) drops the cache, and a zoom or
+    //! device-pixel-ratio change re-keys it implicitly.
+    struct TileKey {
+        int x = 0;
+        int y = 0;
+        bool operator<(const TileKey& o) const { return x < o.x || (x == o.x && y < o.y); }
+    };
+
+    void paintTiles(QPainter* qp, const RectF& viewRect, bool isPrinting);
+    void paintScaledTiles(QPainter* qp, const RectF& viewRect, qreal sx, qreal sy, qreal dx, qreal dy);
+    QPixmap renderPaintTile(const TileKey& key, bool isPrinting);
+    void invalidatePaintTiles();
+
+    //! NOTE on-demand frame-time HUD with a rolling jank log; the cause
+    //! breadcrumb is the last input event or notification that requested
+    //! the frame, so slow frames in the log can be tied to an interaction
+    struct FrameStat {
+        qint64 timestampMs = 0;
+        qint64 paintMs = 0;
+        qint64 latencyMs = 0;
+        QString cause;
+    };
+
+    void markFrameCause(const QString& cause);
+    void recordFrame(qint64 paintMs);
+    void paintPerfHud(QPainter* qp);
+    void writeJankLog();
+
     PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
 
@@ -253,6 +292,23 @@ private:
 
     bool m_autoScrollEnabled = true;
     QTimer m_enableAutoScrollTimer;
+
+    bool m_useGpuPainting = false;
+
+    bool m_perfHudEnabled = false;
+    QElapsedTimer m_frameCauseTimer;
+    QString m_frameCause;
+    bool m_frameCauseArmed = false;
+    qint64 m_lastPaintMs = 0;
+    qint64 m_lastLatencyMs = 0;
+    std::deque<FrameStat> m_jankLog;
+
+    std::map<TileKey, QPixmap> m_paintTiles;
+    qreal m_paintTilesScaleX = 0.0;
+    qreal m_paintTilesScaleY = 0.0;
+    qreal m_paintTilesDpr = 0.0;
+    bool m_paintTilesPrinting = false;
+    bool m_interactiveZoomActive = false;
 };
 }
 
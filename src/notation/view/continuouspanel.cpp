@@ -47,9 +47,26 @@ using namespace mu::notation;
 
 static constexpr bool ACCESSIBILITY_DISABLED = false;
 
+static constexpr qreal PANEL_RIGHT_PADDING = 5;    // Extra space for the panel after last element
+
+ContinuousPanel::~ContinuousPanel()
+{
+    invalidateElementsCache();
+}
+
 void ContinuousPanel::setNotation(INotationPtr notation)
 {
+    invalidateElementsCache();
+
     m_notation = notation;
+
+    if (m_notation) {
+        //! NOTE the cached panel elements are laid out from the score,
+        //! so any score change drops them
+        m_notation->notationChanged().onNotify(this, [this]() {
+            invalidateElementsCache();
+        });
+    }
 }
 
 //! NOTE: Copied from MU3
@@ -68,7 +85,6 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
     qreal newWidth = 0;          // New panel width
     qreal height = 0;
     qreal leftMarginTotal = 0;   // Sum of all elements left margin
-    qreal panelRightPadding = 5;    // Extra space for the panel after last element
 
     mu::engraving::Measure* measure = score->firstMeasure();
 
@@ -130,9 +146,8 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
             continue;
         }
 
-        if (e->isStaffLines()) {
+        if (!currentMeasure && e->isStaffLines()) {
             currentMeasure = toStaffLines(e)->measure();
-            break;
         }
     }
 
@@ -153,111 +168,26 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
     qreal xPosMeasure = currentMeasure->canvasX();
     qreal _measureWidth = currentMeasure->width();
     int tick = currentMeasure->tick().ticks();
-    mu::engraving::Fraction currentTimeSigFraction = currentMeasure->timesig();
-
-    //---------------------------------------------------------
-    //   findElementWidths
-    //      determines the max width for each element types
-    //---------------------------------------------------------
-
-    // The first pass serves to get the maximum width for each elements
-
-    qreal lineWidthName = 0;
-    qreal widthClef    = 0;
-    qreal widthKeySig  = 0;
-    qreal widthTimeSig = 0;
-    qreal xPosTimeSig  = 0;
-
-    for (const mu::engraving::EngravingItem* e : qAsConst(el)) {
-        e->itemDiscovered = false;
-        if (!e->visible() && !showInvisible) {
-            continue;
-        }
-
-        if (e->isRest() && toRest(e)->isGap()) {
-            continue;
-        }
 
-        if (e->isStaffLines()) {
-            mu::engraving::Staff* currentStaff = score->staff(e->staffIdx());
-            mu::engraving::Segment* parent = score->tick2segment(Fraction::fromTicks(tick));
-
-            // Find maximum width for the staff name
-            std::list<mu::engraving::StaffName>& staffNamesLong
-                = currentStaff->part()->instrument(mu::engraving::Fraction::fromTicks(tick))->longNames();
-            QString staffName = staffNamesLong.empty() ? u" " : staffNamesLong.front().name();
-            if (staffName == "") {
-                std::list<mu::engraving::StaffName>& staffNamesShort
-                    = currentStaff->part()->instrument(mu::engraving::Fraction::fromTicks(tick))->shortNames();
-                staffName = staffNamesShort.empty() ? u"" : staffNamesShort.front().name();
-            }
-
-            mu::engraving::Text* newName = engraving::Factory::createText(parent, mu::engraving::TextStyleType::DEFAULT,
-                                                                          ACCESSIBILITY_DISABLED);
-            newName->setXmlText(staffName);
-            newName->setTrack(e->track());
-            newName->setFamily(u"FreeSans");
-            newName->setSizeIsSpatiumDependent(true);
-            newName->layout();
-            newName->setPlainText(newName->plainText());
-            newName->layout();
-
-            // Find maximum width for the current Clef
-            mu::engraving::Clef* newClef = engraving::Factory::createClef(parent, ACCESSIBILITY_DISABLED);
-            mu::engraving::ClefType currentClef = currentStaff->clef(mu::engraving::Fraction::fromTicks(tick));
-            newClef->setClefType(currentClef);
-            newClef->setTrack(e->track());
-            newClef->layout();
-            if (newClef->width() > widthClef) {
-                widthClef = newClef->width();
-            }
-
-            // Find maximum width for the current KeySignature
-            mu::engraving::KeySig* newKs = engraving::Factory::createKeySig(parent, ACCESSIBILITY_DISABLED);
-            mu::engraving::KeySigEvent currentKeySigEvent = currentStaff->keySigEvent(mu::engraving::Fraction::fromTicks(tick));
-            newKs->setKeySigEvent(currentKeySigEvent);
-            // The Parent and the Track must be set to have the key signature layout adjusted to different clefs
-            // This also adds naturals to the key signature (if set in the score style)
-            newKs->setTrack(e->track());
-            newKs->setHideNaturals(true);
-            newKs->layout();
-            if (newKs->width() > widthKeySig) {
-                widthKeySig = newKs->width();
-            }
-
-            // Find maximum width for the current TimeSignature
-            mu::engraving::TimeSig* newTs = engraving::Factory::createTimeSig(parent, ACCESSIBILITY_DISABLED);
-
-            // Try to get local time signature, if not, get the current measure one
-            mu::engraving::TimeSig* currentTimeSig = currentStaff->timeSig(mu::engraving::Fraction::fromTicks(tick));
-            if (currentTimeSig) {
-                newTs->setFrom(currentTimeSig);
-            } else {
-                newTs->setSig(Fraction(currentTimeSigFraction.numerator(), currentTimeSigFraction.denominator()), TimeSigType::NORMAL);
-            }
-            newTs->setTrack(e->track());
-            newTs->layout();
-
-            if ((newName->width() > lineWidthName) && (newName->xmlText() != "")) {
-                lineWidthName = newName->width();
-            }
-
-            if (newTs->width() > widthTimeSig) {
-                widthTimeSig = newTs->width();
-            }
-
-            delete newClef;
-            delete newName;
-            delete newKs;
-            delete newTs;
-        }
+    //! NOTE Creating and laying out the panel elements is the expensive part
+    //! of this routine. While scrolling, only the panel offset changes from
+    //! frame to frame, so the laid out elements are cached and reused until
+    //! the measure at the panel position (or the score itself) changes.
+    mu::draw::Color color = engravingConfiguration()->formattingMarksColor();
+    if (m_cache.measure != currentMeasure || m_cache.tick != tick || m_cache.color != color) {
+        updateElementsCache(el, currentMeasure, tick, color, showInvisible);
     }
 
+    qreal lineWidthName = m_cache.lineWidthName;
+    qreal widthClef = m_cache.widthClef;
+    qreal widthKeySig = m_cache.widthKeySig;
+    qreal widthTimeSig = m_cache.widthTimeSig;
+
     leftMarginTotal = styleMM(mu::engraving::Sid::clefLeftMargin);
     leftMarginTotal += styleMM(mu::engraving::Sid::keysigLeftMargin);
     leftMarginTotal += styleMM(mu::engraving::Sid::timesigLeftMargin);
 
-    newWidth = widthClef + widthKeySig + widthTimeSig + leftMarginTotal + panelRightPadding;
+    newWidth = widthClef + widthKeySig + widthTimeSig + leftMarginTotal + PANEL_RIGHT_PADDING;
     xPosMeasure -= offsetPanel;
 
     lineWidthName += score->spatium() + styleMM(mu::engraving::Sid::clefLeftMargin) + widthClef;
@@ -302,7 +232,7 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
     painter.setBrush(notationConfiguration()->foregroundColor());
 
     RectF bg(m_rect);
-    bg.setWidth(widthClef + widthKeySig + widthTimeSig + leftMarginTotal + panelRightPadding);
+    bg.setWidth(widthClef + widthKeySig + widthTimeSig + leftMarginTotal + PANEL_RIGHT_PADDING);
 
     const QPixmap& wallpaper = notationConfiguration()->foregroundWallpaper();
 
@@ -315,28 +245,75 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
     painter.setClipRect(m_rect);
     painter.setClipping(true);
 
-    mu::draw::Color color = engravingConfiguration()->formattingMarksColor();
-
     // Draw measure text number
-    // TODO: simplify (no Text element)
-    QString text = QString("#%1").arg(currentMeasure->no() + 1);
-    mu::engraving::Text* newElement = engraving::Factory::createText(
-        score->dummy(), mu::engraving::TextStyleType::DEFAULT, ACCESSIBILITY_DISABLED);
-    newElement->setFlag(mu::engraving::ElementFlag::MOVABLE, false);
-    newElement->setXmlText(text);
-    newElement->setFamily(u"FreeSans");
-    newElement->setSizeIsSpatiumDependent(true);
-    newElement->setColor(color);
-    newElement->layout1();
-    pos = PointF(styleMM(mu::engraving::Sid::clefLeftMargin) + widthClef, y + newElement->height());
+    qreal measureNumberHeight = m_cache.measureNumber ? m_cache.measureNumber->height() : 0.0;
+    pos = PointF(styleMM(mu::engraving::Sid::clefLeftMargin) + widthClef, y + measureNumberHeight);
     painter.translate(pos);
-    newElement->draw(&painter);
+    if (m_cache.measureNumber) {
+        m_cache.measureNumber->draw(&painter);
+    }
     pos += PointF(offsetPanel, 0);
     painter.translate(-pos);
-    delete newElement;
 
-    // This second pass draws the elements spaced evenly using the width of the largest element
-    for (const mu::engraving::EngravingItem* e : qAsConst(el)) {
+    // This second pass draws the cached elements spaced evenly using the width of the largest element
+    for (const StaffItems& items : m_cache.staves) {
+        painter.save();
+
+        pos = PointF(offsetPanel, items.y);
+        painter.translate(pos);
+
+        // Draw staff lines
+        items.staffLines->draw(&painter);
+
+        // Draw barline
+        items.barLine->draw(&painter);
+
+        // Draw the current staff name
+        if (items.drawStaffName) {
+            const double spatium = score->spatium();
+            pos = PointF(styleMM(mu::engraving::Sid::clefLeftMargin) + widthClef, -spatium * 2);
+            painter.translate(pos);
+            items.staffName->draw(&painter);
+            painter.translate(-pos);
+        }
+
+        qreal posX = 0.0;
+
+        // Draw the current Clef
+        posX += styleMM(mu::engraving::Sid::clefLeftMargin);
+        items.clef->drawAt(&painter, PointF(posX, items.clef->pos().y()));
+        posX += widthClef;
+
+        // Draw the current KeySignature
+        posX += styleMM(mu::engraving::Sid::keysigLeftMargin);
+        items.keySig->drawAt(&painter, PointF(posX, 0.0));
+
+        posX += widthKeySig;
+
+        // Draw the current TimeSignature
+        if (items.drawTimeSig) {
+            posX += styleMM(mu::engraving::Sid::timesigLeftMargin);
+            items.timeSig->drawAt(&painter, PointF(posX, 0.0));
+        }
+
+        painter.restore();
+    }
+
+    painter.restore();
+}
+
+void ContinuousPanel::updateElementsCache(const std::vector<mu::engraving::EngravingItem*>& el,
+                                          const mu::engraving::Measure* currentMeasure,
+                                          int tick, const mu::draw::Color& color, bool showInvisible)
+{
+    invalidateElementsCache();
+
+    const mu::engraving::Score* score = this->score();
+    mu::engraving::Fraction currentTimeSigFraction = currentMeasure->timesig();
+
+    // This pass creates and lays out the elements for each staff
+    // and determines the max width for each element type
+    for (const mu::engraving::EngravingItem* e : el) {
         if (!e->visible() && !showInvisible) {
             continue;
         }
@@ -345,114 +322,146 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
             continue;
         }
 
-        if (e->isStaffLines()) {
-            painter.save();
-            mu::engraving::Staff* currentStaff = score->staff(e->staffIdx());
-            mu::engraving::Segment* parent = score->tick2segmentMM(Fraction::fromTicks(tick));
+        if (!e->isStaffLines()) {
+            continue;
+        }
+
+        mu::engraving::Staff* currentStaff = score->staff(e->staffIdx());
+        mu::engraving::Segment* parent = score->tick2segmentMM(Fraction::fromTicks(tick));
+
+        StaffItems items;
+        items.y = e->pagePos().y();
+
+        // Staff lines (laid out for the final panel width below)
+        items.staffLines = new mu::engraving::StaffLines(*toStaffLines(e));
+        items.staffLines->setParent(parent->measure());
+        items.staffLines->setTrack(e->track());
+        items.staffLines->setColor(color);
+
+        // Barline
+        items.barLine = engraving::Factory::createBarLine(parent, ACCESSIBILITY_DISABLED);
+        items.barLine->setBarLineType(mu::engraving::BarLineType::NORMAL);
+        items.barLine->setTrack(e->track());
+        items.barLine->setSpanStaff(currentStaff->barLineSpan());
+        items.barLine->setSpanFrom(currentStaff->barLineFrom());
+        items.barLine->setSpanTo(currentStaff->barLineTo());
+        items.barLine->layout();
+        items.barLine->setColor(color);
+
+        // The current staff name
+        std::list<mu::engraving::StaffName>& staffNamesLong
+            = currentStaff->part()->instrument(mu::engraving::Fraction::fromTicks(tick))->longNames();
+        QString staffName = staffNamesLong.empty() ? u" " : staffNamesLong.front().name();
+        if (staffName == "") {
+            std::list<mu::engraving::StaffName>& staffNamesShort
+                = currentStaff->part()->instrument(mu::engraving::Fraction::fromTicks(tick))->shortNames();
+            staffName = staffNamesShort.empty() ? u"" : staffNamesShort.front().name();
+        }
 
-            pos = PointF(offsetPanel, e->pagePos().y());
-            painter.translate(pos);
+        items.staffName = engraving::Factory::createText(parent, mu::engraving::TextStyleType::DEFAULT,
+                                                         ACCESSIBILITY_DISABLED);
+        items.staffName->setXmlText(staffName);
+        items.staffName->setTrack(e->track());
+        items.staffName->setColor(color);
+        items.staffName->setFamily(u"FreeSans");
+        items.staffName->setSizeIsSpatiumDependent(true);
+        items.staffName->layout();
+        items.staffName->setPlainText(items.staffName->plainText());
+        items.staffName->layout();
+        items.drawStaffName = currentStaff->part()->staff(0) == currentStaff;
+
+        if ((items.staffName->width() > m_cache.lineWidthName) && (items.staffName->xmlText() != "")) {
+            m_cache.lineWidthName = items.staffName->width();
+        }
 
-            // Draw staff lines
-            mu::engraving::StaffLines newStaffLines(*toStaffLines(e));
-            newStaffLines.setParent(parent->measure());
-            newStaffLines.setTrack(e->track());
-            newStaffLines.layoutForWidth(bg.width());
-            newStaffLines.setColor(color);
-            newStaffLines.draw(&painter);
-
-            // Draw barline
-            mu::engraving::BarLine* barLine = engraving::Factory::createBarLine(parent, ACCESSIBILITY_DISABLED);
-            barLine->setBarLineType(mu::engraving::BarLineType::NORMAL);
-            barLine->setTrack(e->track());
-            barLine->setSpanStaff(currentStaff->barLineSpan());
-            barLine->setSpanFrom(currentStaff->barLineFrom());
-            barLine->setSpanTo(currentStaff->barLineTo());
-            barLine->layout();
-            barLine->setColor(color);
-            barLine->draw(&painter);
-
-            // Draw the current staff name
-            std::list<mu::engraving::StaffName>& staffNamesLong
-                = currentStaff->part()->instrument(mu::engraving::Fraction::fromTicks(tick))->longNames();
-            QString staffName = staffNamesLong.empty() ? u" " : staffNamesLong.front().name();
-            if (staffName == "") {
-                std::list<mu::engraving::StaffName>& staffNamesShort
-                    = currentStaff->part()->instrument(mu::engraving::Fraction::fromTicks(tick))->shortNames();
-                staffName = staffNamesShort.empty() ? u"" : staffNamesShort.front().name();
-            }
-
-            mu::engraving::Text* newName = engraving::Factory::createText(parent, mu::engraving::TextStyleType::DEFAULT,
-                                                                          ACCESSIBILITY_DISABLED);
-            newName->setXmlText(staffName);
-            newName->setTrack(e->track());
-            newName->setColor(color);
-            newName->setFamily(u"FreeSans");
-            newName->setSizeIsSpatiumDependent(true);
-            newName->layout();
-            newName->setPlainText(newName->plainText());
-            newName->layout();
-
-            if (currentStaff->part()->staff(0) == currentStaff) {
-                const double spatium = score->spatium();
-                pos = PointF(styleMM(mu::engraving::Sid::clefLeftMargin) + widthClef, -spatium * 2);
-                painter.translate(pos);
-                newName->draw(&painter);
-                painter.translate(-pos);
-            }
-            delete newName;
-
-            qreal posX = 0.0;
-
-            // Draw the current Clef
-            mu::engraving::Clef* clef = engraving::Factory::createClef(parent, ACCESSIBILITY_DISABLED);
-            clef->setClefType(currentStaff->clef(mu::engraving::Fraction::fromTicks(tick)));
-            clef->setTrack(e->track());
-            clef->setColor(color);
-            clef->layout();
-            posX += styleMM(mu::engraving::Sid::clefLeftMargin);
-            clef->drawAt(&painter, PointF(posX, clef->pos().y()));
-            posX += widthClef;
-
-            // Draw the current KeySignature
-            mu::engraving::KeySig* newKs = engraving::Factory::createKeySig(parent, ACCESSIBILITY_DISABLED);
-            newKs->setKeySigEvent(currentStaff->keySigEvent(mu::engraving::Fraction::fromTicks(tick)));
-
-            // The Parent and the track must be set to have the key signature layout adjusted to different clefs
-            // This also adds naturals to the key signature (if set in the score style)
-            newKs->setTrack(e->track());
-            newKs->setColor(color);
-            newKs->setHideNaturals(true);
-            newKs->layout();
-            posX += styleMM(mu::engraving::Sid::keysigLeftMargin);
-            newKs->drawAt(&painter, PointF(posX, 0.0));
-
-            posX += widthKeySig + xPosTimeSig;
-
-            // Draw the current TimeSignature
-            mu::engraving::TimeSig* newTs = engraving::Factory::createTimeSig(parent, ACCESSIBILITY_DISABLED);
-
-            // Try to get local time signature, if not, get the current measure one
-            mu::engraving::TimeSig* currentTimeSig = currentStaff->timeSig(mu::engraving::Fraction::fromTicks(tick));
-            if (currentTimeSig) {
-                newTs->setFrom(currentTimeSig);
-                newTs->setTrack(e->track());
-                newTs->setColor(color);
-                newTs->layout();
-                posX += styleMM(mu::engraving::Sid::timesigLeftMargin);
-                newTs->drawAt(&painter, PointF(posX, 0.0));
-            }
-
-            delete newKs;
-            delete newTs;
-            delete clef;
-            delete barLine;
-
-            painter.restore();
+        // The current Clef
+        items.clef = engraving::Factory::createClef(parent, ACCESSIBILITY_DISABLED);
+        items.clef->setClefType(currentStaff->clef(mu::engraving::Fraction::fromTicks(tick)));
+        items.clef->setTrack(e->track());
+        items.clef->setColor(color);
+        items.clef->layout();
+        if (items.clef->width() > m_cache.widthClef) {
+            m_cache.widthClef = items.clef->width();
         }
+
+        // The current KeySignature
+        items.keySig = engraving::Factory::createKeySig(parent, ACCESSIBILITY_DISABLED);
+        items.keySig->setKeySigEvent(currentStaff->keySigEvent(mu::engraving::Fraction::fromTicks(tick)));
+
+        // The Parent and the Track must be set to have the key signature layout adjusted to different clefs
+        // This also adds naturals to the key signature (if set in the score style)
+        items.keySig->setTrack(e->track());
+        items.keySig->setColor(color);
+        items.keySig->setHideNaturals(true);
+        items.keySig->layout();
+        if (items.keySig->width() > m_cache.widthKeySig) {
+            m_cache.widthKeySig = items.keySig->width();
+        }
+
+        // The current TimeSignature
+        items.timeSig = engraving::Factory::createTimeSig(parent, ACCESSIBILITY_DISABLED);
+
+        // Try to get local time signature, if not, get the current measure one
+        mu::engraving::TimeSig* currentTimeSig = currentStaff->timeSig(mu::engraving::Fraction::fromTicks(tick));
+        if (currentTimeSig) {
+            items.timeSig->setFrom(currentTimeSig);
+            items.drawTimeSig = true;
+        } else {
+            items.timeSig->setSig(Fraction(currentTimeSigFraction.numerator(), currentTimeSigFraction.denominator()),
+                                  TimeSigType::NORMAL);
+        }
+        items.timeSig->setTrack(e->track());
+        items.timeSig->setColor(color);
+        items.timeSig->layout();
+        if (items.timeSig->width() > m_cache.widthTimeSig) {
+            m_cache.widthTimeSig = items.timeSig->width();
+        }
+
+        m_cache.staves.push_back(items);
     }
 
-    painter.restore();
+    // Measure text number
+    // TODO: simplify (no Text element)
+    QString text = QString("#%1").arg(currentMeasure->no() + 1);
+    m_cache.measureNumber = engraving::Factory::createText(
+        score->dummy(), mu::engraving::TextStyleType::DEFAULT, ACCESSIBILITY_DISABLED);
+    m_cache.measureNumber->setFlag(mu::engraving::ElementFlag::MOVABLE, false);
+    m_cache.measureNumber->setXmlText(text);
+    m_cache.measureNumber->setFamily(u"FreeSans");
+    m_cache.measureNumber->setSizeIsSpatiumDependent(true);
+    m_cache.measureNumber->setColor(color);
+    m_cache.measureNumber->layout1();
+
+    // Now that the panel width is known, lay out the staff lines for it
+    qreal panelContentWidth = m_cache.widthClef + m_cache.widthKeySig + m_cache.widthTimeSig
+                              + styleMM(mu::engraving::Sid::clefLeftMargin)
+                              + styleMM(mu::engraving::Sid::keysigLeftMargin)
+                              + styleMM(mu::engraving::Sid::timesigLeftMargin)
+                              + PANEL_RIGHT_PADDING;
+
+    for (StaffItems& items : m_cache.staves) {
+        items.staffLines->layoutForWidth(panelContentWidth);
+    }
+
+    m_cache.measure = currentMeasure;
+    m_cache.tick = tick;
+    m_cache.color = color;
+}
+
+void ContinuousPanel::invalidateElementsCache()
+{
+    for (StaffItems& items : m_cache.staves) {
+        delete items.staffLines;
+        delete items.barLine;
+        delete items.staffName;
+        delete items.clef;
+        delete items.keySig;
+        delete items.timeSig;
+    }
+
+    delete m_cache.measureNumber;
+
+    m_cache = ElementsCache();
 }
 
 qreal ContinuousPanel::styleMM(const mu::engraving::Sid styleId) const
@@ -24,6 +24,7 @@
 #define MU_NOTATION_CONTINUOUSPANEL_H
 
 #include "modularity/ioc.h"
+#include "async/asyncable.h"
 #include "notation/inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
 
@@ -32,6 +33,14 @@
 
 namespace mu::engraving {
 class Score;
+class Measure;
+class EngravingItem;
+class StaffLines;
+class BarLine;
+class Text;
+class Clef;
+class KeySig;
+class TimeSig;
 }
 
 namespace mu::draw {
@@ -39,12 +48,15 @@ class Painter;
 }
 
 namespace mu::notation {
-class ContinuousPanel
+class ContinuousPanel : public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, notationConfiguration)
     INJECT(notation, engraving::IEngravingConfiguration, engravingConfiguration)
 
 public:
+    ContinuousPanel() = default;
+    ~ContinuousPanel();
+
     void setNotation(INotationPtr notation);
 
     struct NotationViewContext {
@@ -60,9 +72,40 @@ private:
     qreal styleMM(const mu::engraving::Sid styleId) const;
     const mu::engraving::Score* score() const;
 
+    //! NOTE laid out panel elements for one staff; the positions at which
+    //! they are drawn are computed per frame from the cached widths
+    struct StaffItems {
+        qreal y = 0.;
+        mu::engraving::StaffLines* staffLines = nullptr;
+        mu::engraving::BarLine* barLine = nullptr;
+        mu::engraving::Text* staffName = nullptr;
+        bool drawStaffName = false;
+        mu::engraving::Clef* clef = nullptr;
+        mu::engraving::KeySig* keySig = nullptr;
+        mu::engraving::TimeSig* timeSig = nullptr;
+        bool drawTimeSig = false;
+    };
+
+    struct ElementsCache {
+        const mu::engraving::Measure* measure = nullptr;
+        int tick = -1;
+        draw::Color color;
+        qreal lineWidthName = 0.;
+        qreal widthClef = 0.;
+        qreal widthKeySig = 0.;
+        qreal widthTimeSig = 0.;
+        mu::engraving::Text* measureNumber = nullptr;
+        std::vector<StaffItems> staves;
+    };
+
+    void updateElementsCache(const std::vector<mu::engraving::EngravingItem*>& el, const mu::engraving::Measure* currentMeasure,
+                             int tick, const draw::Color& color, bool showInvisible);
+    void invalidateElementsCache();
+
     INotationPtr m_notation;
     qreal m_width = 0;
     RectF m_rect;
+    ElementsCache m_cache;
 };
 }
 
@@ -37,6 +37,7 @@ using namespace mu::actions;
 using namespace mu::commonscene;
 
 static constexpr int PIXELSSTEPSFACTOR = 5;
+static constexpr int DRAG_MOVE_INTERVAL_MSECS = 16; // one frame at 60 Hz
 
 NotationViewInputController::NotationViewInputController(IControlledView* view)
     : m_view(view)
@@ -705,7 +706,7 @@ void NotationViewInputController::mouseMoveEvent(QMouseEvent* event)
                 mode = DragMode::OnlyX;
             }
 
-            viewInteraction()->drag(m_beginPoint, logicPos, mode);
+            dragElements(logicPos, mode);
 
             return;
         } else if (hitElement == nullptr && (keyState & Qt::ShiftModifier)) {
@@ -744,6 +745,48 @@ void NotationViewInputController::startDragElements(ElementType elementsType, co
     viewInteraction()->startDrag(elements, elementsOffset, isDraggable);
 }
 
+void NotationViewInputController::dragElements(const PointF& logicPos, DragMode mode)
+{
+    //! NOTE each applied drag can trigger a layout pass, which is far slower
+    //! than the rate mouse moves arrive at; apply at most one drag per frame
+    //! and remember the latest position, so the element follows the pointer
+    //! without flooding layout
+    m_pendingDragPos = logicPos;
+    m_pendingDragMode = mode;
+
+    if (m_dragMoveTimer.isValid() && m_dragMoveTimer.elapsed() < DRAG_MOVE_INTERVAL_MSECS) {
+        if (!m_dragMovePending) {
+            m_dragMovePending = true;
+            QTimer::singleShot(DRAG_MOVE_INTERVAL_MSECS, [this]() {
+                flushPendingDragMove();
+            });
+        }
+        return;
+    }
+
+    m_dragMovePending = false;
+    m_dragMoveTimer.start();
+
+    viewInteraction()->drag(m_beginPoint, logicPos, mode);
+}
+
+void NotationViewInputController::flushPendingDragMove()
+{
+    if (!m_dragMovePending) {
+        return;
+    }
+
+    m_dragMovePending = false;
+
+    if (!viewInteraction()->isDragStarted()) {
+        return;
+    }
+
+    m_dragMoveTimer.start();
+
+    viewInteraction()->drag(m_beginPoint, m_pendingDragPos, m_pendingDragMode);
+}
+
 void NotationViewInputController::mouseReleaseEvent(QMouseEvent* event)
 {
     INotationInteractionPtr interaction = viewInteraction();
@@ -762,9 +805,15 @@ void NotationViewInputController::mouseReleaseEvent(QMouseEvent* event)
     m_isCanvasDragged = false;
 
     if (interaction->isDragStarted()) {
+        // apply the last coalesced move so the element ends up where
+        // the pointer was released
+        flushPendingDragMove();
         interaction->endDrag();
     }
 
+    m_dragMoveTimer.invalidate();
+    m_dragMovePending = false;
+
     if (interaction->isDragCopyStarted()) {
         interaction->endDragCopy();
     }
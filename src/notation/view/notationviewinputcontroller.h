@@ -23,6 +23,7 @@
 #define MU_NOTATION_NOTATIONVIEWINPUTCONTROLLER_H
 
 #include <QtEvents>
+#include <QElapsedTimer>
 
 #include "modularity/ioc.h"
 
@@ -152,6 +153,8 @@ private:
     void setViewMode(const ViewMode& viewMode);
 
     void startDragElements(ElementType elementsType, const PointF& elementsOffset);
+    void dragElements(const PointF& logicPos, DragMode mode);
+    void flushPendingDragMove();
 
     float hitWidth() const;
 
@@ -180,6 +183,14 @@ private:
 
     PointF m_beginPoint;
 
+    //! NOTE mouse moves arrive much faster than a dragged element can be
+    //! laid out; the moves are coalesced to roughly one applied drag per
+    //! frame (see dragElements)
+    QElapsedTimer m_dragMoveTimer;
+    bool m_dragMovePending = false;
+    PointF m_pendingDragPos;
+    DragMode m_pendingDragMode = DragMode::BothXY;
+
     mu::engraving::EngravingItem* m_prevHitElement = nullptr;
 };
 }
@@ -27,6 +27,7 @@
 #include <QScrollBar>
 #include <QTextDocument>
 #include <QMouseEvent>
+#include <QVector>
 
 #include "translation.h"
 
@@ -1015,6 +1016,28 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
 
     QList<Part*> partList = getParts();
 
+    // The tooltip part names depend only on the row; resolve them once here
+    // instead of parsing the part name HTML again for every measure of every
+    // staff
+    const QString translateMeasure = qtrc("notation/timeline", "Measure");
+    const QChar initialLetter = translateMeasure[0];
+    QVector<QString> partNames(globalRows);
+    {
+        QTextDocument doc;
+        for (int row = 0; row < globalRows && row < partList.size(); row++) {
+            doc.setHtml(partList.at(row)->longName());
+            QString partName = doc.toPlainText();
+            if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
+                doc.setHtml(partList.at(row)->partName());
+                partName = doc.toPlainText();
+            }
+            if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
+                partName = partList.at(row)->instrumentName();
+            }
+            partNames[row] = partName;
+        }
+    }
+
     for (int col = startMeasure; col < endMeasure; col++) {
         for (int row = 0; row < globalRows; row++) {
             QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
@@ -1022,23 +1045,8 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
 
             setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
 
-            QString translateMeasure = qtrc("notation/timeline", "Measure");
-            QChar initialLetter = translateMeasure[0];
-            QTextDocument doc;
-            QString partName = "";
-            if (partList.size() > row) {
-                doc.setHtml(partList.at(row)->longName());
-                partName = doc.toPlainText();
-                if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
-                    doc.setHtml(partList.at(row)->partName());
-                    partName = doc.toPlainText();
-                }
-                if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
-                    partName = partList.at(row)->instrumentName();
-                }
-            }
-
-            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
+            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ")
+                                         + partNames.at(row));
             graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
             graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
             graphicsRectItem->setZValue(-3);
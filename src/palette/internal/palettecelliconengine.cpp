@@ -50,11 +50,35 @@ QIconEngine* PaletteCellIconEngine::clone() const
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
     qreal dpi = qp->device()->logicalDpiX();
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On, dpi);
-    p.restore();
+    qreal dpr = qp->device()->devicePixelRatioF();
+
+    PreviewCacheKey key;
+    key.size = rect.size();
+    key.dpr = dpr;
+    key.mode = mode;
+    key.state = state;
+    key.elementsColor = configuration()->elementsColor().rgba();
+    key.accentColor = configuration()->accentColor().rgba();
+
+    if (m_previewCache.isNull() || !(m_previewCacheKey == key)) {
+        QPixmap pm(rect.size() * dpr);
+        pm.setDevicePixelRatio(dpr);
+        pm.fill(Qt::transparent);
+
+        {
+            QPainter pp(&pm);
+            Painter p(&pp, "palettecell");
+            p.save();
+            p.setAntialiasing(true);
+            paintCell(p, RectF(0, 0, rect.width(), rect.height()), mode == QIcon::Selected, state == QIcon::On, dpi);
+            p.restore();
+        }
+
+        m_previewCache = pm;
+        m_previewCacheKey = key;
+    }
+
+    qp->drawPixmap(rect.topLeft(), m_previewCache);
 }
 
 void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const
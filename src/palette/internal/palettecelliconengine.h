@@ -23,6 +23,7 @@
 #define MU_PALETTE_PALETTECELLICONENGINE_H
 
 #include <QIconEngine>
+#include <QPixmap>
 
 #include "palettecell.h"
 
@@ -64,6 +65,28 @@ private:
 
     PaletteCellConstPtr m_cell;
     qreal m_extraMag = 1.0;
+
+    //! NOTE a cell is repainted far more often than its content changes
+    //! (hovering, selection and scrolling all trigger repaints); the last
+    //! rendered preview is kept and replayed while the size, icon state
+    //! and palette colors are unchanged
+    struct PreviewCacheKey {
+        QSize size;
+        qreal dpr = 0.0;
+        int mode = -1;
+        int state = -1;
+        QRgb elementsColor = 0;
+        QRgb accentColor = 0;
+
+        bool operator==(const PreviewCacheKey& other) const
+        {
+            return size == other.size && dpr == other.dpr && mode == other.mode && state == other.state
+                   && elementsColor == other.elementsColor && accentColor == other.accentColor;
+        }
+    };
+
+    mutable PreviewCacheKey m_previewCacheKey;
+    mutable QPixmap m_previewCache;
 };
 }
 
@@ -299,19 +299,26 @@ bool PaletteWidget::setFilterText(const QString& text)
         }
     }
 
+    // the search text is the same for every cell; split and trim it once
+    // out here instead of per name token of every cell. As before, the last
+    // non-empty search token decides the match.
+    QString searchToken;
+    for (const QString& ns : t.split(" ")) {
+        QString trimmed = ns.trimmed();
+        if (!trimmed.isEmpty()) {
+            searchToken = trimmed;
+        }
+    }
+
     for (PaletteCellPtr cell : cells()) {
-        QStringList h = cell->name.toLower().split(" ");
-        bool c        = false;
-        QStringList n = t.split(" ");
-        for (QString hs : h) {
-            for (QString ns : n) {
-                if (!ns.trimmed().isEmpty()) {
-                    c = hs.trimmed().startsWith(ns.trimmed());
+        bool c = false;
+        if (!searchToken.isEmpty()) {
+            for (const QString& hs : cell->name.toLower().split(" ")) {
+                if (hs.trimmed().startsWith(searchToken)) {
+                    c = true;
+                    break;
                 }
             }
-            if (c) {
-                break;
-            }
         }
         if (t.isEmpty() || c) {
             m_filteredCells.push_back(cell);
@@ -76,6 +76,10 @@ void PlaybackConfiguration::init()
     for (MixerSectionType sectionType : allMixerSectionTypes()) {
         bool sectionEnabledByDefault = sectionType != MixerSectionType::Volume;
         settings()->setDefaultValue(mixerSectionVisibleKey(sectionType), Val(sectionEnabledByDefault));
+
+        settings()->valueChanged(mixerSectionVisibleKey(sectionType)).onReceive(nullptr, [this, sectionType](const Val& visible) {
+            m_isMixerSectionVisibleChanged.send(sectionType, visible.toBool());
+        });
     }
 
     settings()->setDefaultValue(DEFAULT_SOUND_PROFILE_FOR_NEW_PROJECTS, Val(fallbackSoundProfileStr().toStdString()));
@@ -126,6 +130,11 @@ void PlaybackConfiguration::setMixerSectionVisible(MixerSectionType sectionType,
     settings()->setSharedValue(mixerSectionVisibleKey(sectionType), Val(visible));
 }
 
+mu::async::Channel<MixerSectionType, bool> PlaybackConfiguration::isMixerSectionVisibleChanged() const
+{
+    return m_isMixerSectionVisibleChanged;
+}
+
 const SoundProfileName& PlaybackConfiguration::basicSoundProfileName() const
 {
     return BASIC_PROFILE_NAME;
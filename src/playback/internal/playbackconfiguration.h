@@ -48,6 +48,7 @@ public:
 
     bool isMixerSectionVisible(MixerSectionType sectionType) const override;
     void setMixerSectionVisible(MixerSectionType sectionType, bool visible) override;
+    async::Channel<MixerSectionType, bool> isMixerSectionVisibleChanged() const override;
 
     const SoundProfileName& basicSoundProfileName() const override;
     const SoundProfileName& museSoundProfileName() const override;
@@ -55,6 +56,8 @@ public:
     void setDefaultProfileForNewProjects(const SoundProfileName& name) override;
 private:
     const SoundProfileName& fallbackSoundProfileStr() const;
+
+    async::Channel<MixerSectionType, bool> m_isMixerSectionVisibleChanged;
 };
 }
 
@@ -47,6 +47,7 @@ public:
 
     virtual bool isMixerSectionVisible(MixerSectionType sectionType) const = 0;
     virtual void setMixerSectionVisible(MixerSectionType sectionType, bool visible) = 0;
+    virtual async::Channel<MixerSectionType, bool> isMixerSectionVisibleChanged() const = 0;
 
     virtual const SoundProfileName& basicSoundProfileName() const = 0;
     virtual const SoundProfileName& museSoundProfileName() const = 0;
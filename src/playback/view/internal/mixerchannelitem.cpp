@@ -212,6 +212,31 @@ void MixerChannelItem::subscribeOnAudioSignalChanges(AudioSignalChanges&& audioS
 {
     m_audioSignalChanges = audioSignalChanges;
 
+    if (m_metersEnabled) {
+        listenAudioSignalChanges();
+    }
+}
+
+void MixerChannelItem::setMetersEnabled(bool enabled)
+{
+    if (m_metersEnabled == enabled) {
+        return;
+    }
+
+    m_metersEnabled = enabled;
+
+    //!Note Every channel meter means constant cross-thread traffic from the audio worker,
+    //!     so we only listen to the signal changes while the meters are actually on screen
+    if (enabled) {
+        listenAudioSignalChanges();
+    } else {
+        m_audioSignalChanges.resetOnReceive(this);
+        resetAudioChannelsVolumePressure();
+    }
+}
+
+void MixerChannelItem::listenAudioSignalChanges()
+{
     m_audioSignalChanges.onReceive(this, [this](const audioch_t audioChNum, const AudioSignalVal& newValue) {
         //!Note There should be no signal changes when the mixer channel is muted.
         //!     But some audio signal changes still might be "on the way" from the times when the mixer channel wasn't muted
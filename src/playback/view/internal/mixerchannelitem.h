@@ -89,6 +89,7 @@ public:
     void loadSoloMuteState(project::IProjectAudioSettings::SoloMuteState&& newState);
 
     void subscribeOnAudioSignalChanges(audio::AudioSignalChanges&& audioSignalChanges);
+    void setMetersEnabled(bool enabled);
 
     bool outputOnly() const;
 
@@ -126,6 +127,8 @@ signals:
     void outputResourceItemListChanged();
 
 protected:
+    void listenAudioSignalChanges();
+
     void setAudioChannelVolumePressure(const audio::audioch_t chNum, const float newValue);
     void resetAudioChannelsVolumePressure();
 
@@ -150,6 +153,7 @@ protected:
     QMap<audio::AudioFxChainOrder, OutputResourceItem*> m_outputResourceItems;
 
     audio::AudioSignalChanges m_audioSignalChanges;
+    bool m_metersEnabled = true;
 
     QString m_title;
     bool m_isPrimary = true;
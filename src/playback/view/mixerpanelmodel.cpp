@@ -41,6 +41,16 @@ MixerPanelModel::MixerPanelModel(QObject* parent)
     controller()->currentTrackSequenceIdChanged().onNotify(this, [this]() {
         load(QVariant::fromValue(m_itemsNavigationSection), m_navigationPanelOrderStart);
     });
+
+    configuration()->isMixerSectionVisibleChanged().onReceive(this, [this](MixerSectionType sectionType, bool visible) {
+        if (sectionType != MixerSectionType::Fader) {
+            return;
+        }
+
+        for (MixerChannelItem* item : m_mixerChannelList) {
+            item->setMetersEnabled(visible);
+        }
+    });
 }
 
 void MixerPanelModel::load(const QVariant& navigationSection, int navigationPanelOrderStart)
@@ -329,6 +339,7 @@ MixerChannelItem* MixerPanelModel::buildTrackChannelItem(const audio::TrackId tr
 {
     TrackMixerChannelItem* item = new TrackMixerChannelItem(this, trackId, instrumentTrackId, isPrimary);
     item->setPanelSection(m_itemsNavigationSection);
+    item->setMetersEnabled(configuration()->isMixerSectionVisible(MixerSectionType::Fader));
 
     item->loadSoloMuteState(audioSettings()->soloMuteState(instrumentTrackId));
 
@@ -396,6 +407,7 @@ MixerChannelItem* MixerPanelModel::buildMasterChannelItem()
 {
     MixerChannelItem* item = new MasterMixerChannelItem(this);
     item->setPanelSection(m_itemsNavigationSection);
+    item->setMetersEnabled(configuration()->isMixerSectionVisible(MixerSectionType::Fader));
 
     item->setTitle(qtrc("playback", "Master"));
 
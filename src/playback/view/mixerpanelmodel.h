@@ -34,6 +34,7 @@
 #include "ui/view/navigationsection.h"
 
 #include "iplaybackcontroller.h"
+#include "iplaybackconfiguration.h"
 #include "internal/mixerchannelitem.h"
 
 namespace mu::playback {
@@ -43,6 +44,7 @@ class MixerPanelModel : public QAbstractListModel, public async::Asyncable
 
     INJECT(playback, audio::IPlayback, playback)
     INJECT(playback, IPlaybackController, controller)
+    INJECT(playback, IPlaybackConfiguration, configuration)
     INJECT(playback, context::IGlobalContext, context)
 
     Q_PROPERTY(int count READ rowCount NOTIFY rowCountChanged)
@@ -31,6 +31,8 @@
 #include "libmscore/segment.h"
 #include "libmscore/text.h"
 
+#include "log.h"
+
 using namespace mu::engraving;
 
 namespace mu::plugins::api {
@@ -246,4 +248,106 @@ void Score::endCmd(bool rollback)
 
     notation()->notationChanged().notify();
 }
+
+//---------------------------------------------------------
+//   collectItemsByType
+//---------------------------------------------------------
+
+static void collectItemsByType(mu::engraving::EngravingObject* obj, const QByteArray& typeName,
+                               std::vector<mu::engraving::EngravingItem*>& items)
+{
+    for (mu::engraving::EngravingObject* child : obj->scanChildren()) {
+        if (child->isEngravingItem() && typeName == child->typeName()) {
+            items.push_back(static_cast<mu::engraving::EngravingItem*>(child));
+        }
+
+        collectItemsByType(child, typeName, items);
+    }
+}
+
+//---------------------------------------------------------
+//   Score::batchGetProperties
+//---------------------------------------------------------
+
+QVariantList Score::batchGetProperties(const QString& elementType, const QStringList& propertyNames)
+{
+    TRACEFUNC;
+
+    std::vector<Pid> pids;
+    pids.reserve(propertyNames.size());
+    for (const QString& name : propertyNames) {
+        QByteArray latin = name.toLatin1();
+        Pid pid = mu::engraving::propertyId(AsciiStringView(latin.constData()));
+        if (pid == Pid::END) {
+            LOGW() << "unknown property: " << name;
+        }
+        pids.push_back(pid);
+    }
+
+    std::vector<mu::engraving::EngravingItem*> items;
+    collectItemsByType(score(), elementType.toLatin1(), items);
+
+    QVariantList result;
+    result.reserve(int(items.size()));
+
+    for (mu::engraving::EngravingItem* item : items) {
+        EngravingItem* wrapped = wrap(item, Ownership::SCORE);
+
+        QVariantMap entry;
+        entry[QStringLiteral("element")] = QVariant::fromValue<QObject*>(wrapped);
+        for (int i = 0; i < propertyNames.size(); ++i) {
+            if (pids[size_t(i)] != Pid::END) {
+                entry[propertyNames[i]] = wrapped->get(pids[size_t(i)]);
+            }
+        }
+
+        result.push_back(entry);
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   Score::batchSetProperties
+//---------------------------------------------------------
+
+bool Score::batchSetProperties(const QVariantList& changes)
+{
+    TRACEFUNC;
+
+    startCmd();
+
+    bool ok = true;
+
+    for (const QVariant& change : changes) {
+        QVariantMap map = change.toMap();
+
+        ScoreElement* wrapped = qobject_cast<ScoreElement*>(map.value(QStringLiteral("element")).value<QObject*>());
+        if (!wrapped || !wrapped->element()) {
+            LOGW() << "change entry without a valid element";
+            ok = false;
+            continue;
+        }
+
+        for (auto it = map.cbegin(); it != map.cend(); ++it) {
+            if (it.key() == QLatin1String("element")) {
+                continue;
+            }
+
+            QByteArray latin = it.key().toLatin1();
+            Pid pid = mu::engraving::propertyId(AsciiStringView(latin.constData()));
+            if (pid == Pid::END) {
+                LOGW() << "unknown property: " << it.key();
+                ok = false;
+                continue;
+            }
+
+            wrapped->set(pid, it.value());
+        }
+    }
+
+    endCmd();
+
+    return ok;
+}
 } // namespace mu::plugins::api
@@ -204,6 +204,35 @@ public:
 
     Q_INVOKABLE QString extractLyrics() { return score()->extractLyrics(); }
 
+    /**
+     * Collects properties of all elements of a given type in a single call.
+     * \param elementType name of the element type, e.g. \p "Note" or \p "Rest"
+     * (as returned by ScoreElement::name).
+     * \param propertyNames list of property names, e.g. \p ["pitch", "veloOffset"].
+     * \returns An array of objects, one per element in score order. Each object
+     * holds the requested properties plus an \p element member referring to the
+     * element itself, which can be handed back to batchSetProperties().
+     *
+     * Reading properties this way crosses the QML/C++ boundary once per call
+     * instead of once per property access, which matters for plugins scanning
+     * large scores.
+     */
+    Q_INVOKABLE QVariantList batchGetProperties(const QString& elementType, const QStringList& propertyNames);
+    /**
+     * Applies an array of property changes in one undoable transaction.
+     * \param changes array of objects of the form
+     * \code
+     * { element: <element>, pitch: 61, veloOffset: 10 }
+     * \endcode
+     * where \p element is an element obtained from batchGetProperties() (or any
+     * other element wrapper) and the remaining members name the properties to
+     * change. The whole batch is wrapped in a single command, so one undo
+     * reverts it entirely; do not combine with your own startCmd()/endCmd()
+     * around the call.
+     * \returns \p true if every change was applied.
+     */
+    Q_INVOKABLE bool batchSetProperties(const QVariantList& changes);
+
 //      //@ ??
 //      Q_INVOKABLE void updateRepeatList(bool expandRepeats) { score()->updateRepeatList(); } // TODO: needed?
 
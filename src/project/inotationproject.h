@@ -64,6 +64,10 @@ public:
     virtual Ret save(const io::path_t& path = io::path_t(), SaveMode saveMode = SaveMode::Save) = 0;
     virtual Ret writeToDevice(QIODevice* device) = 0;
 
+    //! NOTE save() may return before the bytes reach the disk; returns only
+    //! once any pending background write has finished
+    virtual void flushPendingWrites() = 0;
+
     virtual ProjectMeta metaInfo() const = 0;
     virtual void setMetaInfo(const ProjectMeta& meta, bool undoable = false) = 0;
 
@@ -23,6 +23,10 @@
 
 #include <sstream>
 
+#include <QCryptographicHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+
 #include "io/buffer.h"
 
 #include "stringutils.h"
@@ -36,6 +40,8 @@ using namespace mu::project;
 using namespace mu::framework;
 using namespace mu::engraving;
 
+static const int META_CACHE_VERSION = 1;
+
 mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) const
 {
     RetVal<ProjectMeta> meta;
@@ -46,6 +52,18 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) cons
         return meta;
     }
 
+    //! NOTE filling the recent-files grid opens (and on network shares: downloads
+    //! part of) every single project, so the extracted meta and thumbnail are kept
+    //! in a sidecar cache keyed by the file's path, mtime and size - as long as
+    //! the project is untouched, browsing it costs one small local read
+    DateTime lastModified = fileSystem()->lastModified(filePath);
+    uint64_t fileSize = fileSystem()->fileSize(filePath).val;
+
+    if (readCachedMeta(filePath, lastModified, fileSize, meta.val)) {
+        meta.val.filePath = filePath;
+        return meta;
+    }
+
     MscReader::Params params;
     params.filePath = filePath.toQString();
     params.mode = mscIoModeBySuffix(io::suffix(filePath));
@@ -73,9 +91,92 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) cons
 
     meta.val.filePath = filePath;
 
+    writeCachedMeta(filePath, lastModified, fileSize, meta.val, thumbnailData);
+
     return meta;
 }
 
+mu::io::path_t MscMetaReader::metaCachePath(const io::path_t& filePath) const
+{
+    QByteArray hash = QCryptographicHash::hash(filePath.toQString().toUtf8(), QCryptographicHash::Md5).toHex();
+    return globalConfiguration()->userAppDataPath() + "/project_meta_cache/" + hash.constData() + ".json";
+}
+
+bool MscMetaReader::readCachedMeta(const io::path_t& filePath, const DateTime& lastModified, uint64_t fileSize, ProjectMeta& meta) const
+{
+    RetVal<ByteArray> data = fileSystem()->readFile(metaCachePath(filePath));
+    if (!data.ret) {
+        return false;
+    }
+
+    QJsonParseError err;
+    QJsonDocument doc = QJsonDocument::fromJson(data.val.toQByteArray(), &err);
+    if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+        return false;
+    }
+
+    QJsonObject obj = doc.object();
+    if (obj.value("version").toInt() != META_CACHE_VERSION
+        || obj.value("filePath").toString() != filePath.toQString()
+        || obj.value("lastModified").toString() != lastModified.toString().toQString()
+        || obj.value("fileSize").toString() != QString::number(fileSize)) {
+        return false;
+    }
+
+    meta.title = obj.value("title").toString();
+    meta.subtitle = obj.value("subtitle").toString();
+    meta.composer = obj.value("composer").toString();
+    meta.lyricist = obj.value("lyricist").toString();
+    meta.copyright = obj.value("copyright").toString();
+    meta.translator = obj.value("translator").toString();
+    meta.arranger = obj.value("arranger").toString();
+    meta.partsCount = static_cast<size_t>(obj.value("partsCount").toInt());
+    meta.creationDate = QDate::fromString(obj.value("creationDate").toString(), Qt::ISODate);
+
+    QByteArray thumbnailData = QByteArray::fromBase64(obj.value("thumbnail").toString().toLatin1());
+    if (!thumbnailData.isEmpty()) {
+        meta.thumbnail.loadFromData(thumbnailData, "PNG");
+    }
+
+    return true;
+}
+
+void MscMetaReader::writeCachedMeta(const io::path_t& filePath, const DateTime& lastModified, uint64_t fileSize, const ProjectMeta& meta,
+                                    const ByteArray& thumbnailData) const
+{
+    io::path_t cachePath = metaCachePath(filePath);
+
+    Ret ret = fileSystem()->makePath(io::absoluteDirpath(cachePath));
+    if (!ret) {
+        LOGW() << "failed to create meta cache directory, err: " << ret.toString();
+        return;
+    }
+
+    QJsonObject obj;
+    obj["version"] = META_CACHE_VERSION;
+    obj["filePath"] = filePath.toQString();
+    obj["lastModified"] = lastModified.toString().toQString();
+    obj["fileSize"] = QString::number(fileSize);
+
+    obj["title"] = meta.title;
+    obj["subtitle"] = meta.subtitle;
+    obj["composer"] = meta.composer;
+    obj["lyricist"] = meta.lyricist;
+    obj["copyright"] = meta.copyright;
+    obj["translator"] = meta.translator;
+    obj["arranger"] = meta.arranger;
+    obj["partsCount"] = static_cast<int>(meta.partsCount);
+    obj["creationDate"] = meta.creationDate.toString(Qt::ISODate);
+
+    obj["thumbnail"] = QString::fromLatin1(thumbnailData.toQByteArray().toBase64());
+
+    QByteArray json = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+    ret = fileSystem()->writeFile(cachePath, ByteArray::fromQByteArray(json));
+    if (!ret) {
+        LOGW() << "failed to write meta cache, err: " << ret.toString();
+    }
+}
+
 MscMetaReader::RawMeta MscMetaReader::doReadBox(framework::XmlReader& xmlReader) const
 {
     RawMeta meta;
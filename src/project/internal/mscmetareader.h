@@ -24,8 +24,11 @@
 
 #include "imscmetareader.h"
 
+#include "global/iglobalconfiguration.h"
 #include "io/ifilesystem.h"
 #include "modularity/ioc.h"
+#include "types/bytearray.h"
+#include "types/datetime.h"
 
 namespace mu::framework {
 class XmlReader;
@@ -34,6 +37,7 @@ class XmlReader;
 namespace mu::project {
 class MscMetaReader : public IMscMetaReader
 {
+    INJECT(project, framework::IGlobalConfiguration, globalConfiguration)
     INJECT(project, io::IFileSystem, fileSystem)
 
 public:
@@ -67,6 +71,11 @@ private:
         size_t partsCount = 0;
     };
 
+    io::path_t metaCachePath(const io::path_t& filePath) const;
+    bool readCachedMeta(const io::path_t& filePath, const DateTime& lastModified, uint64_t fileSize, ProjectMeta& meta) const;
+    void writeCachedMeta(const io::path_t& filePath, const DateTime& lastModified, uint64_t fileSize, const ProjectMeta& meta,
+                         const ByteArray& thumbnailData) const;
+
     void doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const;
     RawMeta doReadBox(framework::XmlReader& xmlReader) const;
     RawMeta doReadRawMeta(framework::XmlReader& xmlReader) const;
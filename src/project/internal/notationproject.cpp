@@ -25,6 +25,7 @@
 #include <QDir>
 #include <QFile>
 
+#include "async/async.h"
 #include "io/buffer.h"
 
 #include "libmscore/undo.h"
@@ -115,6 +116,10 @@ static QString scoreDefaultTitle()
 
 NotationProject::~NotationProject()
 {
+    if (m_writeJob.valid()) {
+        m_writeJob.wait();
+    }
+
     m_projectAudioSettings = nullptr;
     m_masterNotation = nullptr;
     m_engravingProject = nullptr;
@@ -269,6 +274,16 @@ mu::Ret NotationProject::doImport(const io::path_t& path, const io::path_t& styl
     mu::engraving::ScoreLoad sl;
     m_engravingProject->setFileInfoProvider(std::make_shared<ProjectFileInfoProvider>(this));
     mu::engraving::MasterScore* score = m_engravingProject->masterScore();
+
+    //! NOTE same discipline as doLoad: the reader builds its elements and the
+    //! master score is set up with updates locked, so the import doesn't pay
+    //! for intermediate full layouts - the score is laid out once, below,
+    //! after everything is in place
+    score->lockUpdates(true);
+    DEFER {
+        score->lockUpdates(false);
+    };
+
     Ret ret = scoreReader->read(score, path, options);
     if (!ret) {
         return ret;
@@ -285,6 +300,10 @@ mu::Ret NotationProject::doImport(const io::path_t& path, const io::path_t& styl
         score->loadStyle(stylePath.toQString());
     }
 
+    score->lockUpdates(false);
+    score->setLayoutAll();
+    score->update();
+
     // Setup other stuff
     m_projectAudioSettings->makeDefault();
 
@@ -474,6 +493,10 @@ mu::Ret NotationProject::save(const io::path_t& path, SaveMode saveMode)
             suffix = engraving::MSCX;
         }
 
+        if (mscIoModeBySuffix(suffix) == MscIoMode::Zip) {
+            return autoSaveScore(path);
+        }
+
         return saveScore(path, suffix);
     }
 
@@ -509,6 +532,13 @@ mu::Ret NotationProject::writeToDevice(QIODevice* device)
     return ret;
 }
 
+void NotationProject::flushPendingWrites()
+{
+    if (m_writeJob.valid()) {
+        m_writeJob.wait();
+    }
+}
+
 mu::Ret NotationProject::saveScore(const io::path_t& path, const std::string& fileSuffix)
 {
     if (!isMuseScoreFile(fileSuffix) && !fileSuffix.empty()) {
@@ -520,6 +550,73 @@ mu::Ret NotationProject::saveScore(const io::path_t& path, const std::string& fi
     return doSave(path, true, ioMode);
 }
 
+mu::Ret NotationProject::autoSaveScore(const io::path_t& path)
+{
+    TRACEFUNC;
+
+    //! NOTE Autosaving a large project used to block typing for the whole
+    //! serialize + compress + disk write. The snapshot (serialization into an
+    //! in-memory buffer) still happens on the caller's thread, because the
+    //! score may not be read concurrently with editing, but the backup copy,
+    //! the disk write and the atomic replace are moved to a background job.
+
+    // only one background write at a time; the previous job has had a full
+    // autosave interval to finish, so this should not actually block
+    if (m_writeJob.valid()) {
+        m_writeJob.wait();
+    }
+
+    Buffer buf;
+    buf.open(IODevice::OpenMode::WriteOnly);
+
+    MscWriter::Params params;
+    params.device = &buf;
+    params.filePath = path.toQString();
+    params.mainFileName = engraving::mainFileName(path).toQString();
+    params.mode = MscIoMode::Zip;
+    params.compressionLevel = 1; // speed over ratio, nobody ships the autosave file
+
+    MscWriter msczWriter(params);
+    //! NOTE no thumbnail: the autosave file only exists for crash recovery,
+    //! and rendering the first page to a png is a big part of the snapshot cost
+    Ret ret = writeProject(msczWriter, false, false);
+    msczWriter.close();
+    buf.close();
+
+    if (!ret) {
+        LOGE() << "failed write project to buffer";
+        return ret;
+    }
+
+    ByteArray data = buf.data();
+    std::shared_ptr<io::IFileSystem> fs = fileSystem();
+
+    //! NOTE the backup decision depends on m_path and m_isNewlyCreated, which
+    //! the main thread is free to mutate while the job runs (e.g. a Save As
+    //! right after the autosave fired) - so resolve both here, on the caller's
+    //! thread, and hand the job plain values
+    bool needBackup = !isNewlyCreated();
+    io::path_t backupSourcePath = m_path;
+
+    m_writeJob = std::async(std::launch::async, [this, fs, path, data, needBackup, backupSourcePath]() {
+        if (needBackup) {
+            makeFileAsBackup(backupSourcePath);
+        }
+
+        io::path_t tmpPath = path.toQString() + "_saving";
+        Ret writeRet = fs->writeFile(tmpPath, data);
+        if (writeRet) {
+            writeRet = fs->move(tmpPath, path, true);
+        }
+
+        if (!writeRet) {
+            LOGE() << "[autosave] failed to write snapshot to " << path << ", err: " << writeRet.toString();
+        }
+    });
+
+    return make_ret(Ret::Code::Ok);
+}
+
 mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode)
 {
     QString targetContainerPath = engraving::containerPath(path).toQString();
@@ -544,6 +641,80 @@ mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, eng
         }
     }
 
+    //! NOTE a zip save is serialized and compressed into memory right here - the
+    //! score may not be read while it is being edited, so the snapshot has to be
+    //! taken on the caller's thread - but the disk round trip (the backup copy,
+    //! the temp write and the atomic replace) runs on a background job, so that
+    //! saving doesn't block input on slow drives
+    if (ioMode == MscIoMode::Zip) {
+        if (m_writeJob.valid()) {
+            m_writeJob.wait();
+        }
+
+        Buffer buf;
+        buf.open(IODevice::OpenMode::WriteOnly);
+
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = savePath;
+        params.mainFileName = targetMainFileName.toQString();
+        params.mode = ioMode;
+        // speed over ratio: the file gets a few percent bigger, deflate runs
+        // several times faster
+        params.compressionLevel = 1;
+
+        MscWriter msczWriter(params);
+        Ret ret = writeProject(msczWriter, false);
+        msczWriter.close();
+        buf.close();
+
+        if (!ret) {
+            LOGE() << "failed write project to buffer";
+            return ret;
+        }
+
+        ByteArray data = buf.data();
+        std::shared_ptr<io::IFileSystem> fs = fileSystem();
+        io::path_t tmpPath = savePath;
+        io::path_t targetPath = targetContainerPath;
+
+        //! NOTE save() updates m_path and m_isNewlyCreated as soon as we return,
+        //! so the backup source has to be pinned down here, on the caller's
+        //! thread - otherwise a Save As would nondeterministically back up
+        //! either the old or the new file depending on thread timing
+        bool needBackup = generateBackup && !isNewlyCreated();
+        io::path_t backupSourcePath = m_path;
+
+        m_writeJob = std::async(std::launch::async, [this, fs, data, tmpPath, targetPath, targetMainFilePath, needBackup,
+                                                     backupSourcePath]() {
+            if (needBackup) {
+                makeFileAsBackup(backupSourcePath);
+            }
+
+            Ret writeRet = fs->writeFile(tmpPath, data);
+            if (writeRet) {
+                writeRet = fs->move(tmpPath, targetPath, true);
+            }
+
+            if (writeRet) {
+                // make file readable by all
+                QFile::setPermissions(targetMainFilePath.toQString(),
+                                      QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
+                LOGI() << "success save file: " << targetPath;
+            } else {
+                LOGE() << "failed to save file: " << targetPath << ", err: " << writeRet.toString();
+                //! NOTE the save never reached the disk, so flag the project as
+                //! still needing a save back on the main thread - the user sees
+                //! the dirty marker again and the autosaver keeps covering them
+                async::Async::call(this, [this]() {
+                    m_masterNotation->setSaved(false);
+                });
+            }
+        });
+
+        return make_ret(Ret::Code::Ok);
+    }
+
     // Step 2: write project
     {
         MscWriter::Params params;
@@ -621,7 +792,11 @@ mu::Ret NotationProject::makeCurrentFileAsBackup()
         return make_ret(Ret::Code::Ok);
     }
 
-    io::path_t filePath = m_path;
+    return makeFileAsBackup(m_path);
+}
+
+mu::Ret NotationProject::makeFileAsBackup(const io::path_t& filePath)
+{
     if (io::suffix(filePath) != engraving::MSCZ) {
         LOGW() << "backup allowed only for MSCZ, currently: " << filePath;
         return make_ret(Ret::Code::Ok);
@@ -654,7 +829,7 @@ mu::Ret NotationProject::makeCurrentFileAsBackup()
     return ret;
 }
 
-mu::Ret NotationProject::writeProject(MscWriter& msczWriter, bool onlySelection)
+mu::Ret NotationProject::writeProject(MscWriter& msczWriter, bool onlySelection, bool createThumbnail)
 {
     // Create MsczWriter
     bool ok = msczWriter.open();
@@ -664,7 +839,7 @@ mu::Ret NotationProject::writeProject(MscWriter& msczWriter, bool onlySelection)
     }
 
     // Write engraving project
-    ok = m_engravingProject->writeMscz(msczWriter, onlySelection, true);
+    ok = m_engravingProject->writeMscz(msczWriter, onlySelection, createThumbnail);
     if (!ok) {
         LOGE() << "failed write engraving project to mscz";
         return make_ret(notation::Err::UnknownError);
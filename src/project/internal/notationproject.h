@@ -22,6 +22,8 @@
 #ifndef MU_PROJECT_NOTATIONPROJECT_H
 #define MU_PROJECT_NOTATIONPROJECT_H
 
+#include <future>
+
 #include "../inotationproject.h"
 
 #include "async/asyncable.h"
@@ -85,6 +87,8 @@ public:
     Ret save(const io::path_t& path = io::path_t(), SaveMode saveMode = SaveMode::Save) override;
     Ret writeToDevice(QIODevice* device) override;
 
+    void flushPendingWrites() override;
+
     ProjectMeta metaInfo() const override;
     void setMetaInfo(const ProjectMeta& meta, bool undoable = false) override;
 
@@ -100,11 +104,13 @@ private:
     Ret doImport(const io::path_t& path, const io::path_t& stylePath, bool forceMode);
 
     Ret saveScore(const io::path_t& path, const std::string& fileSuffix);
+    Ret autoSaveScore(const io::path_t& path);
     Ret saveSelectionOnScore(const io::path_t& path = io::path_t());
     Ret exportProject(const io::path_t& path, const std::string& suffix);
     Ret doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode);
     Ret makeCurrentFileAsBackup();
-    Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection);
+    Ret makeFileAsBackup(const io::path_t& filePath);
+    Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection, bool createThumbnail = true);
 
     mu::engraving::EngravingProjectPtr m_engravingProject = nullptr;
     notation::IMasterNotationPtr m_masterNotation = nullptr;
@@ -118,6 +124,10 @@ private:
 
     bool m_isNewlyCreated = false; /// true if the file has never been saved yet
     bool m_isImported = false;
+
+    //! NOTE single background disk-write job shared by save and autosave,
+    //! so the snapshots can never race each other on the project files
+    std::future<void> m_writeJob;
 };
 }
 
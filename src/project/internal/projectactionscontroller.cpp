@@ -22,6 +22,7 @@
 #include "projectactionscontroller.h"
 
 #include <QBuffer>
+#include <QFile>
 #include <QTemporaryFile>
 #include <QFileInfo>
 
@@ -615,7 +616,7 @@ bool ProjectActionsController::saveProjectToCloud(CloudProjectInfo info, SaveMod
         }
     }
 
-    uploadProject(info, audio, /*openEditUrl=*/ isPublic, /*publishMode=*/ false);
+    uploadProject(info, audio, /*openEditUrl=*/ isPublic, /*publishMode=*/ false, savingPath);
     isUploadingFinished = false;
 
     m_numberOfSavesToCloud++;
@@ -712,25 +713,49 @@ void ProjectActionsController::closeUploadProgressDialog()
     }
 }
 
-void ProjectActionsController::uploadProject(const CloudProjectInfo& info, const AudioFile& audio, bool openEditUrl, bool publishMode)
+void ProjectActionsController::uploadProject(const CloudProjectInfo& info, const AudioFile& audio, bool openEditUrl, bool publishMode,
+                                             const io::path_t& alreadySavedPath)
 {
     INotationProjectPtr project = globalContext()->currentProject();
     if (!project) {
         return;
     }
 
-    QBuffer* projectData = new QBuffer();
-    projectData->open(QIODevice::WriteOnly);
+    QIODevice* projectData = nullptr;
 
-    Ret ret = project->writeToDevice(projectData);
-    if (!ret) {
-        LOGE() << ret.toString();
-        delete projectData;
-        return;
+    if (!alreadySavedPath.empty()) {
+        //! NOTE the project has just been saved to this file, so upload
+        //! those bytes directly instead of serializing and compressing the
+        //! whole project a second time on the UI thread; the save may still
+        //! be writing on a background job, so wait for it to land first -
+        //! otherwise we would upload the previous revision (or, on a first
+        //! save, find no file at all)
+        project->flushPendingWrites();
+
+        QFile* savedFile = new QFile(alreadySavedPath.toQString());
+        if (savedFile->open(QIODevice::ReadOnly)) {
+            projectData = savedFile;
+        } else {
+            delete savedFile;
+        }
     }
 
-    projectData->close();
-    projectData->open(QIODevice::ReadOnly);
+    if (!projectData) {
+        QBuffer* buffer = new QBuffer();
+        buffer->open(QIODevice::WriteOnly);
+
+        Ret ret = project->writeToDevice(buffer);
+        if (!ret) {
+            LOGE() << ret.toString();
+            delete buffer;
+            return;
+        }
+
+        buffer->close();
+        buffer->open(QIODevice::ReadOnly);
+
+        projectData = buffer;
+    }
 
     bool isFirstSave = info.sourceUrl.isEmpty();
 
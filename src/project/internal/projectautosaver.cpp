@@ -69,10 +69,17 @@ void ProjectAutoSaver::init()
             });
 
             project->needSave().notification.onNotify(this, [this]() {
+                if (auto project = currentProject()) {
+                    m_hasChangesSinceAutoSave = project->needSave().val;
+                }
                 update();
             });
         }
 
+        if (auto project = currentProject()) {
+            m_hasChangesSinceAutoSave = project->needSave().val;
+        }
+
         update();
     });
 }
@@ -149,6 +156,11 @@ void ProjectAutoSaver::onTrySave()
         return;
     }
 
+    if (!m_hasChangesSinceAutoSave) {
+        LOGD() << "[autosave] no changes since last autosave";
+        return;
+    }
+
     if (!project->canSave()) {
         LOGD() << "[autosave] project could not be saved";
         return;
@@ -163,6 +175,8 @@ void ProjectAutoSaver::onTrySave()
         return;
     }
 
+    m_hasChangesSinceAutoSave = false;
+
     LOGD() << "[autosave] successfully saved project";
 }
 
@@ -64,6 +64,9 @@ private:
 
     QTimer m_timer;
     io::path_t m_lastProjectPathNeedingAutosave;
+    //! NOTE needSave stays true until the next real save, so without this flag
+    //! an untouched-but-dirty project would be fully re-serialized every interval
+    bool m_hasChangesSinceAutoSave = false;
 };
 }
 
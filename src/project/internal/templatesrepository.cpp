@@ -96,7 +96,7 @@ Templates TemplatesRepository::readTemplates(const io::paths_t& files, const QSt
 
     for (const io::path_t& file : files) {
         io::path_t path = dirPath.empty() ? file : dirPath + "/" + file;
-        RetVal<ProjectMeta> meta = mscReader()->readMeta(path);
+        RetVal<ProjectMeta> meta = readTemplateMeta(path);
         if (!meta.ret) {
             LOGE() << QString("failed read template %1: %2")
                 .arg(path.toQString())
@@ -113,3 +113,20 @@ Templates TemplatesRepository::readTemplates(const io::paths_t& files, const QSt
 
     return templates;
 }
+
+RetVal<ProjectMeta> TemplatesRepository::readTemplateMeta(const io::path_t& path) const
+{
+    DateTime lastModified = fileSystem()->lastModified(path);
+
+    auto cached = m_metaCache.find(path);
+    if (cached != m_metaCache.end() && cached->second.lastModified == lastModified) {
+        return RetVal<ProjectMeta>::make_ok(cached->second.meta);
+    }
+
+    RetVal<ProjectMeta> meta = mscReader()->readMeta(path);
+    if (meta.ret) {
+        m_metaCache[path] = CachedMeta { lastModified, meta.val };
+    }
+
+    return meta;
+}
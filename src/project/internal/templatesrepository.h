@@ -23,6 +23,8 @@
 #ifndef MU_PROJECT_TEMPLATESREPOSITORY_H
 #define MU_PROJECT_TEMPLATESREPOSITORY_H
 
+#include <map>
+
 #include "modularity/ioc.h"
 
 #include "itemplatesrepository.h"
@@ -43,6 +45,17 @@ public:
 private:
     Templates readTemplates(const io::path_t& dirPath) const;
     Templates readTemplates(const io::paths_t& files, const QString& category, const io::path_t& dirPath = io::path_t()) const;
+
+    RetVal<ProjectMeta> readTemplateMeta(const io::path_t& path) const;
+
+    //! NOTE the templates are re-enumerated on every New Score dialog open,
+    //! but the expensive part - reading the meta out of each mscz/mscx file -
+    //! is cached per file and invalidated by its modification time
+    struct CachedMeta {
+        DateTime lastModified;
+        ProjectMeta meta;
+    };
+    mutable std::map<io::path_t, CachedMeta> m_metaCache;
 };
 }
 
@@ -48,6 +48,11 @@ bool MultiInstancesStubProvider::openNewAppInstance(const QStringList&)
     return false;
 }
 
+bool MultiInstancesStubProvider::openNewAppInstances(const QList<QStringList>&)
+{
+    return false;
+}
+
 // Settings
 bool MultiInstancesStubProvider::isPreferencesAlreadyOpened() const
 {
@@ -350,6 +350,15 @@ async::Notification NotationConfigurationStub::isLimitCanvasScrollAreaChanged()
     return n;
 }
 
+bool NotationConfigurationStub::useGpuPainting() const
+{
+    return false;
+}
+
+void NotationConfigurationStub::setUseGpuPainting(bool)
+{
+}
+
 bool NotationConfigurationStub::colorNotesOutsideOfUsablePitchRange() const
 {
     return false;
@@ -133,6 +133,9 @@ public:
     void setIsLimitCanvasScrollArea(bool limited)  override;
     async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool useGpuPainting() const override;
+    void setUseGpuPainting(bool use) override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value)  override;
 
@@ -21,6 +21,8 @@
  */
 #include "workspacefile.h"
 
+#include <algorithm>
+
 #include <QBuffer>
 
 #include "stringutils.h"
@@ -49,14 +51,21 @@ mu::io::path_t WorkspaceFile::filePath() const
 
 mu::Ret WorkspaceFile::load()
 {
+    m_data.clear();
+    m_sectionNames.clear();
+
     RetVal<ByteArray> data = fileSystem()->readFile(m_filePath);
     if (!data.ret) {
         LOGE() << "failed read file, err: " << data.ret.toString();
         return data.ret;
     }
 
-    QByteArray ba = data.val.toQByteArrayNoCopy();
-    QBuffer buf(&ba);
+    //! NOTE keep the packed bytes; a section is only inflated when it is
+    //! first asked for in data(), so loading a workspace costs one meta
+    //! parse no matter how many sections it carries
+    m_fileData = data.val.toQByteArray();
+
+    QBuffer buf(&m_fileData);
     buf.open(QIODevice::ReadOnly);
     MQZipReader zip(&buf);
 
@@ -68,9 +77,10 @@ mu::Ret WorkspaceFile::load()
 
     QVector<MQZipReader::FileInfo> files = zip.fileInfoList();
     for (const MQZipReader::FileInfo& fi : files) {
-        if (fi.isFile) {
-            QByteArray fdata = zip.fileData(fi.filePath);
-            m_data[fi.filePath.toStdString()] = fdata;
+        //! NOTE META-INF entries are rewritten from m_meta on save,
+        //! they are not data sections
+        if (fi.isFile && !fi.filePath.startsWith("META-INF/")) {
+            m_sectionNames.push_back(fi.filePath.toStdString());
         }
     }
 
@@ -85,6 +95,12 @@ mu::Ret WorkspaceFile::load()
 
 mu::Ret WorkspaceFile::save()
 {
+    //! NOTE inflate the sections that were never asked for, otherwise
+    //! they would be dropped from the re-packed file
+    for (const std::string& name : m_sectionNames) {
+        data(name);
+    }
+
     std::vector<std::string> paths;
     for (const auto& d : m_data) {
         paths.push_back(d.first);
@@ -233,7 +249,29 @@ QByteArray WorkspaceFile::data(const std::string& name) const
     if (it != m_data.end()) {
         return it->second;
     }
-    return QByteArray();
+
+    if (m_fileData.isEmpty()) {
+        return QByteArray();
+    }
+
+    if (std::find(m_sectionNames.cbegin(), m_sectionNames.cend(), name) == m_sectionNames.cend()) {
+        return QByteArray();
+    }
+
+    QByteArray ba = m_fileData;
+    QBuffer buf(&ba);
+    buf.open(QIODevice::ReadOnly);
+    MQZipReader zip(&buf);
+
+    QByteArray fdata = zip.fileData(QString::fromStdString(name));
+    if (zip.status() != MQZipReader::NoError) {
+        LOGE() << "failed read section: " << name << ", status: " << zip.status();
+    }
+    zip.close();
+
+    m_data[name] = fdata;
+
+    return fdata;
 }
 
 void WorkspaceFile::setData(const std::string& name, const QByteArray& data)
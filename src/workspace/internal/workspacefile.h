@@ -68,7 +68,14 @@ private:
 
     io::path_t m_filePath;
     std::map<std::string, Val> m_meta;
-    std::map<std::string, QByteArray> m_data;
+
+    //! NOTE load() only reads the meta data and the list of sections;
+    //! a section is inflated from m_fileData on first access and cached
+    //! in m_data, so unused sections are never deserialized
+    mutable std::map<std::string, QByteArray> m_data;
+
+    QByteArray m_fileData;
+    std::vector<std::string> m_sectionNames;
 };
 }
 
@@ -24,12 +24,14 @@ HERE="$(dirname ${BASH_SOURCE[0]})"
 CURRENT_DIR="./current_pngs"
 REFERENCE_DIR="./reference_pngs"
 OUTPUT_DIR="./comparison"
+JOBS=$(nproc 2>/dev/null || echo 1)
 
 while [[ "$#" -gt 0 ]]; do
     case $1 in
         -c|--current-dir) CURRENT_DIR="$2"; shift ;;
         -r|--reference-dir) REFERENCE_DIR="$2"; shift ;;
         -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
+        -j|--jobs) JOBS="$2"; shift ;;
         *) echo "Unknown parameter passed: $1"; exit 1 ;;
     esac
     shift
@@ -39,27 +41,28 @@ echo "::group::Configuration:"
 echo "CURRENT_DIR: $CURRENT_DIR"
 echo "REFERENCE_DIR: $REFERENCE_DIR"
 echo "OUTPUT_DIR: $OUTPUT_DIR"
+echo "JOBS: $JOBS"
 echo "::endgroup::"
 
 rm -rf $OUTPUT_DIR
 mkdir $OUTPUT_DIR
 
-PNG_REF_LIST=$(ls $REFERENCE_DIR/*.png)
-DIFF_NAME_LIST=""
-for PNG_REF_FILE in $PNG_REF_LIST ; do
-    png_file_name=$(basename $PNG_REF_FILE)
-    FILE_NAME=${png_file_name%.png}
-    PNG_CUR_FILE=$CURRENT_DIR/${FILE_NAME}.png
-    PNG_DIFF_FILE=$OUTPUT_DIR/${FILE_NAME}.diff.png
-    GIF_DIFF_FILE=$OUTPUT_DIR/${FILE_NAME}.diff.gif
-    
+# compare one reference png against its current counterpart;
+# diffs are recorded as $FILE_NAME.isdiff marker files so the results
+# can be collected after the parallel workers have finished
+compare_png() {
+    local PNG_REF_FILE=$1
+    local png_file_name=$(basename $PNG_REF_FILE)
+    local FILE_NAME=${png_file_name%.png}
+    local PNG_CUR_FILE=$CURRENT_DIR/${FILE_NAME}.png
+    local PNG_DIFF_FILE=$OUTPUT_DIR/${FILE_NAME}.diff.png
+    local GIF_DIFF_FILE=$OUTPUT_DIR/${FILE_NAME}.diff.gif
+
     if test -f $PNG_CUR_FILE; then
-        code=$(compare -metric AE -fuzz 0.0% $PNG_REF_FILE $PNG_CUR_FILE $PNG_DIFF_FILE 2>&1)
+        local code=$(compare -metric AE -fuzz 0.0% $PNG_REF_FILE $PNG_CUR_FILE $PNG_DIFF_FILE 2>&1)
         if (( $code > 0 )); then
             echo "Different: ref: $PNG_REF_FILE, current: $PNG_CUR_FILE, code: $code"
-            export VTEST_DIFF_FOUND=true
-            echo "VTEST_DIFF_FOUND=$VTEST_DIFF_FOUND" >> $GITHUB_ENV
-            DIFF_NAME_LIST+=" "$FILE_NAME
+            touch $OUTPUT_DIR/$FILE_NAME.isdiff
 
             cp $PNG_REF_FILE $OUTPUT_DIR/$FILE_NAME.ref.png
             cp $PNG_CUR_FILE $OUTPUT_DIR
@@ -71,6 +74,29 @@ for PNG_REF_FILE in $PNG_REF_LIST ; do
             rm -f $PNG_DIFF_FILE 2>/dev/null
         fi
     fi
+}
+
+# the comparisons are independent of each other, so run up to JOBS of them
+# at a time; this is where nearly all of the wall time goes
+PNG_REF_LIST=$(ls $REFERENCE_DIR/*.png)
+for PNG_REF_FILE in $PNG_REF_LIST ; do
+    while (( $(jobs -rp | wc -l) >= JOBS )); do
+        wait -n
+    done
+    compare_png $PNG_REF_FILE &
+done
+wait
+
+# collect the workers' results in stable (alphabetical) order
+DIFF_NAME_LIST=""
+for MARKER_FILE in $OUTPUT_DIR/*.isdiff ; do
+    if test -f $MARKER_FILE; then
+        marker_file_name=$(basename $MARKER_FILE)
+        export VTEST_DIFF_FOUND=true
+        echo "VTEST_DIFF_FOUND=$VTEST_DIFF_FOUND" >> $GITHUB_ENV
+        DIFF_NAME_LIST+=" "${marker_file_name%.isdiff}
+        rm -f $MARKER_FILE
+    fi
 done
 
 # Generate html report
@@ -27,12 +27,14 @@ SCORES_DIR="$HERE/scores"
 OUTPUT_DIR="./vtest_pngs"
 MSCORE_BIN=build.debug/install/bin/mscore
 DPI=180
+JOBS=$(nproc 2>/dev/null || echo 1)
 
 while [[ "$#" -gt 0 ]]; do
     case $1 in
         -s|--scores) SCORES_DIR="$2"; shift ;;
         -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
         -m|--mscore) MSCORE_BIN="$2"; shift ;;
+        -j|--jobs) JOBS="$2"; shift ;;
         *) echo "Unknown parameter passed: $1"; exit 1 ;;
     esac
     shift
@@ -43,27 +45,51 @@ echo "SCORES_DIR: $SCORES_DIR"
 echo "OUTPUT_DIR: $OUTPUT_DIR"
 echo "MSCORE_BIN: $MSCORE_BIN"
 echo "DPI: $DPI"
+echo "JOBS: $JOBS"
 echo "::endgroup::"
 
 rm -rf $OUTPUT_DIR
 mkdir -p $OUTPUT_DIR
 
 LOG_FILE=$OUTPUT_DIR/convert.log
-JSON_FILE=$OUTPUT_DIR/vtestjob.json
 
-echo "::group::Generating JSON job file"
-echo "[" >> $JSON_FILE
+# The scores are independent, so split them round-robin into one JSON job file
+# per worker and run the workers concurrently. Chunked invocations (rather than
+# one process per score) keep each worker's font/style caches warm across its
+# whole chunk while still paying mscore startup only JOBS times.
+echo "::group::Generating JSON job files"
 SCORES_LIST=$(ls -p $SCORES_DIR | grep -v /)
+SCORES_COUNT=$(echo "$SCORES_LIST" | wc -w)
+if (( JOBS > SCORES_COUNT )); then
+    JOBS=$SCORES_COUNT
+fi
+for (( i = 0; i < JOBS; ++i )); do
+    echo "[" > $OUTPUT_DIR/vtestjob-$i.json
+done
+n=0
 for score in $SCORES_LIST ; do
     OUT_FILE=$OUTPUT_DIR/${score%.*}.png
+    JSON_FILE=$OUTPUT_DIR/vtestjob-$(( n % JOBS )).json
     echo "{ \"in\" : \"$SCORES_DIR/$score\", \"out\" : \"$OUT_FILE\" }," >> $JSON_FILE;
+    n=$(( n + 1 ))
+done
+for (( i = 0; i < JOBS; ++i )); do
+    echo "{}]" >> $OUTPUT_DIR/vtestjob-$i.json
+    cat $OUTPUT_DIR/vtestjob-$i.json
 done
-echo "{}]" >> $JSON_FILE
-cat $JSON_FILE
 echo "::endgroup::"
 
 echo "::group::Generating PNG files"
-$MSCORE_BIN -j $JSON_FILE -r $DPI 2>&1 | tee $LOG_FILE && SUCCESS="true"
+PIDS=""
+for (( i = 0; i < JOBS; ++i )); do
+    $MSCORE_BIN -j $OUTPUT_DIR/vtestjob-$i.json -r $DPI > $OUTPUT_DIR/convert-$i.log 2>&1 &
+    PIDS+=" $!"
+done
+SUCCESS="true"
+for pid in $PIDS ; do
+    wait $pid || SUCCESS=""
+done
+cat $OUTPUT_DIR/convert-*.log | tee $LOG_FILE
 echo "::endgroup::"
 
 if [ -z "$SUCCESS" ]; then
@@ -0,0 +1,134 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2021 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+echo "MuseScore VTest Performance"
+
+set -o pipefail
+
+HERE="$(dirname ${BASH_SOURCE[0]})"
+SCORES_DIR="$HERE/scores"
+OUTPUT_DIR="./vtest_perf"
+MSCORE_BIN=build.debug/install/bin/mscore
+DPI=180
+RUNS=3
+REFERENCE_FILE=""
+THRESHOLD=10
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+        -s|--scores) SCORES_DIR="$2"; shift ;;
+        -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
+        -m|--mscore) MSCORE_BIN="$2"; shift ;;
+        -n|--runs) RUNS="$2"; shift ;;
+        -r|--reference) REFERENCE_FILE="$2"; shift ;;
+        -t|--threshold) THRESHOLD="$2"; shift ;;
+        *) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+echo "::group::Configuration:"
+echo "SCORES_DIR: $SCORES_DIR"
+echo "OUTPUT_DIR: $OUTPUT_DIR"
+echo "MSCORE_BIN: $MSCORE_BIN"
+echo "DPI: $DPI"
+echo "RUNS: $RUNS"
+echo "REFERENCE_FILE: $REFERENCE_FILE"
+echo "THRESHOLD: $THRESHOLD%"
+echo "::endgroup::"
+
+rm -rf $OUTPUT_DIR
+mkdir -p $OUTPUT_DIR/pngs
+
+JSON_FILE=$OUTPUT_DIR/vtestjob.json
+RESULT_FILE=$OUTPUT_DIR/vtest_perf.txt
+
+echo "::group::Generating JSON job file"
+echo "[" >> $JSON_FILE
+SCORES_LIST=$(ls -p $SCORES_DIR | grep -v /)
+for score in $SCORES_LIST ; do
+    OUT_FILE=$OUTPUT_DIR/pngs/${score%.*}.png
+    echo "{ \"in\" : \"$SCORES_DIR/$score\", \"out\" : \"$OUT_FILE\" }," >> $JSON_FILE;
+done
+echo "{}]" >> $JSON_FILE
+echo "::endgroup::"
+
+for RUN in $(seq 1 $RUNS) ; do
+    echo "::group::Run $RUN of $RUNS"
+    LOG_FILE=$OUTPUT_DIR/run$RUN.log
+    $MSCORE_BIN -j $JSON_FILE -r $DPI 2>&1 | tee $LOG_FILE && SUCCESS="true"
+    echo "::endgroup::"
+
+    if [ -z "$SUCCESS" ]; then
+        echo -e "\033[0;31mGenerating PNGs failed!\033[0m"
+        exit 1
+    fi
+done
+
+# Min-of-N per score, to filter out scheduling noise
+grep -h "ConvertPerf:" $OUTPUT_DIR/run*.log \
+    | sed -E 's|.*ConvertPerf: in: .*/([^/,]+), load_ms: ([0-9]+), export_ms: ([0-9]+).*|\1 \2 \3|' \
+    | awk '{
+        if (!($1 in load) || $2 < load[$1]) load[$1] = $2;
+        if (!($1 in exprt) || $3 < exprt[$1]) exprt[$1] = $3;
+      }
+      END { for (s in load) print s, load[s], exprt[s]; }' \
+    | sort > $RESULT_FILE
+
+echo "::group::Results (score load_ms export_ms, min of $RUNS runs):"
+cat $RESULT_FILE
+echo "::endgroup::"
+
+if [ -z "$REFERENCE_FILE" ]; then
+    echo "No reference file given, skipping comparison"
+    echo "To use this run as a reference: cp $RESULT_FILE <reference>"
+    exit 0
+fi
+
+echo "::group::Comparison against $REFERENCE_FILE"
+REGRESSION_FOUND=""
+while read -r SCORE LOAD_MS EXPORT_MS ; do
+    REF_LINE=$(grep "^$SCORE " $REFERENCE_FILE)
+    if [ -z "$REF_LINE" ]; then
+        echo "New: $SCORE, load: ${LOAD_MS}ms, export: ${EXPORT_MS}ms"
+        continue
+    fi
+
+    REF_LOAD_MS=$(echo $REF_LINE | cut -d' ' -f2)
+    REF_EXPORT_MS=$(echo $REF_LINE | cut -d' ' -f3)
+
+    # a fixed 5ms slack on top of the percentage keeps tiny scores
+    # from tripping the threshold on millisecond jitter
+    SLOWER=$(awk -v l=$LOAD_MS -v rl=$REF_LOAD_MS -v e=$EXPORT_MS -v re=$REF_EXPORT_MS -v t=$THRESHOLD \
+        'BEGIN { print (l > rl * (1 + t / 100) + 5 || e > re * (1 + t / 100) + 5) ? 1 : 0 }')
+
+    if [ "$SLOWER" == "1" ]; then
+        echo "Regression: $SCORE, load: ${REF_LOAD_MS}ms -> ${LOAD_MS}ms, export: ${REF_EXPORT_MS}ms -> ${EXPORT_MS}ms"
+        REGRESSION_FOUND="true"
+    else
+        echo "Ok: $SCORE, load: ${REF_LOAD_MS}ms -> ${LOAD_MS}ms, export: ${REF_EXPORT_MS}ms -> ${EXPORT_MS}ms"
+    fi
+done < $RESULT_FILE
+echo "::endgroup::"
+
+if [ -n "$REGRESSION_FOUND" ]; then
+    echo -e "\033[0;31mPerformance regressions found!\033[0m"
+    exit 1
+fi